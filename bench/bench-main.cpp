@@ -0,0 +1,306 @@
+#include "bench/bench.hpp"
+#include "unicorn/utf.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <new>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+using namespace std::chrono;
+using namespace std::literals;
+using namespace Unicorn;
+using namespace Unicorn::Bench;
+
+// Count every heap allocation made through the global operator new
+
+namespace {
+
+    std::atomic<size_t> alloc_count(0);
+
+}
+
+void* operator new(size_t n) {
+    ++alloc_count;
+    if (void* p = std::malloc(n ? n : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t n) {
+    return operator new(n);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+    std::free(p);
+}
+
+namespace Unicorn {
+
+    namespace Bench {
+
+        namespace {
+
+            // Representative characters for each kind of sample text
+
+            const char32_t latin_chars[] = {
+                0xe0, 0xe1, 0xe2, 0xe4, 0xe7, 0xe8, 0xe9, 0xea, 0xed, 0xf1, 0xf3, 0xf6, 0xfa, 0xfc, 0xdf, 0x153,
+            };
+
+            char32_t random_char(Text kind, std::mt19937& rng) {
+                std::uniform_int_distribution<int> letter(0, 25), pick(0, 99);
+                switch (kind) {
+                    case Text::ascii:
+                        return char32_t('a' + letter(rng));
+                    case Text::latin:
+                        return pick(rng) < 15 ? latin_chars[pick(rng) % 16] : char32_t('a' + letter(rng));
+                    case Text::greek:
+                        return char32_t(0x3b1 + letter(rng) % 24);
+                    case Text::cjk:
+                        return char32_t(0x4e00 + pick(rng) * 97 + letter(rng));
+                    default:
+                        switch (pick(rng) % 5) {
+                            case 0:   return char32_t(0x3b1 + letter(rng) % 24);
+                            case 1:   return char32_t(0x4e00 + pick(rng) * 97);
+                            case 2:   return char32_t(0x1f600 + letter(rng));
+                            default:  return char32_t('a' + letter(rng));
+                        }
+                }
+            }
+
+            u8string random_word(Text kind, std::mt19937& rng) {
+                std::uniform_int_distribution<int> length(2, 9);
+                u32string word;
+                for (int i = length(rng); i > 0; --i)
+                    word += random_char(kind, rng);
+                return to_utf8(word);
+            }
+
+        }
+
+        u8string sample_text(Text kind, size_t bytes) {
+            std::mt19937 rng(42);
+            std::uniform_int_distribution<int> punct(0, 11);
+            u8string text;
+            while (text.size() < bytes) {
+                text += random_word(kind, rng);
+                auto p = punct(rng);
+                text += p == 0 ? ". " : p == 1 ? ", " : p == 2 ? "\n" : " ";
+            }
+            return text;
+        }
+
+        vector<u8string> sample_words(Text kind, size_t count) {
+            std::mt19937 rng(42);
+            vector<u8string> words;
+            for (size_t i = 0; i < count; ++i)
+                words.push_back(random_word(kind, rng));
+            return words;
+        }
+
+        u8string decode_hex_chars(const u8string& hex) {
+            u32string chars;
+            std::istringstream in(hex);
+            u8string code;
+            while (in >> code)
+                chars += char32_t(std::strtoul(code.data(), nullptr, 16));
+            return to_utf8(chars);
+        }
+
+    }
+
+}
+
+namespace {
+
+    struct Result {
+        double mbps = 0;
+        double ns = 0;
+        double allocs = 0;
+    };
+
+    using ResultMap = std::map<u8string, Result>;
+
+    Result run_benchmark(const Benchmark& b, double min_time) {
+        using clock = steady_clock;
+        b.op();
+        size_t iterations = 1;
+        for (;;) {
+            size_t allocs = alloc_count;
+            auto start = clock::now();
+            for (size_t i = 0; i < iterations; ++i)
+                b.op();
+            double elapsed = duration<double>(clock::now() - start).count();
+            allocs = alloc_count - allocs;
+            if (elapsed >= min_time || iterations >= (size_t(1) << 40)) {
+                Result r;
+                r.mbps = elapsed > 0 ? double(b.bytes) * iterations / elapsed / 1e6 : 0;
+                r.ns = elapsed * 1e9 / iterations;
+                r.allocs = double(allocs) / iterations;
+                return r;
+            }
+            double factor = elapsed > 0 ? std::min(std::max(1.5 * min_time / elapsed, 2.0), 100.0) : 100.0;
+            iterations = size_t(std::ceil(iterations * factor));
+        }
+    }
+
+    // The baseline file is a flat JSON object mapping each benchmark name
+    // to its results; the parser only needs to read back what we write.
+
+    void save_results(const u8string& file, const ResultMap& results) {
+        std::ofstream out(file);
+        if (! out)
+            throw std::runtime_error("Cannot write " + file);
+        out.precision(10);
+        out << "{\n";
+        size_t n = 0;
+        for (auto& kv: results) {
+            out << "    \"" << kv.first << "\": {\"mbps\": " << kv.second.mbps << ", \"ns\": " << kv.second.ns
+                << ", \"allocs\": " << kv.second.allocs << "}" << (++n < results.size() ? "," : "") << "\n";
+        }
+        out << "}\n";
+    }
+
+    ResultMap load_results(const u8string& file) {
+        std::ifstream in(file);
+        if (! in)
+            throw std::runtime_error("Cannot read " + file);
+        ResultMap results;
+        u8string line;
+        while (std::getline(in, line)) {
+            auto q1 = line.find('"'), q2 = line.find('"', q1 + 1);
+            if (q1 == npos || q2 == npos)
+                continue;
+            Result r;
+            auto field = [&] (const char* key) {
+                auto pos = line.find("\""s + key + "\":");
+                return pos == npos ? 0.0 : std::strtod(line.data() + pos + std::strlen(key) + 3, nullptr);
+            };
+            r.mbps = field("mbps");
+            r.ns = field("ns");
+            r.allocs = field("allocs");
+            results[line.substr(q1 + 1, q2 - q1 - 1)] = r;
+        }
+        return results;
+    }
+
+    void usage() {
+        std::cout << "Usage: unicorn-bench [options] [filter...]\n"
+            << "    --compare FILE    Compare results against a saved baseline\n"
+            << "    --min-time SEC    Minimum time per benchmark (default 0.2)\n"
+            << "    --save FILE       Save results as a JSON baseline\n"
+            << "    --threshold PCT   Percentage increase in ns/op reported as a regression (default 10)\n"
+            << "Only benchmarks whose names contain one of the filter strings are run.\n";
+    }
+
+}
+
+int main(int argc, char** argv) {
+
+    u8string compare_file, save_file;
+    double min_time = 0.2, threshold = 10;
+    vector<u8string> filters;
+
+    try {
+
+        for (int i = 1; i < argc; ++i) {
+            u8string arg = argv[i];
+            auto value = [&] () -> u8string {
+                if (i + 1 >= argc)
+                    throw std::invalid_argument("Missing value for " + arg);
+                return argv[++i];
+            };
+            if (arg == "--compare")
+                compare_file = value();
+            else if (arg == "--min-time")
+                min_time = std::stod(value());
+            else if (arg == "--save")
+                save_file = value();
+            else if (arg == "--threshold")
+                threshold = std::stod(value());
+            else if (arg == "--help" || arg == "-h")
+                { usage(); return 0; }
+            else if (! arg.empty() && arg[0] == '-')
+                throw std::invalid_argument("Unknown option: " + arg);
+            else
+                filters.push_back(arg);
+        }
+
+        Suite suite;
+        utf_benchmarks(suite);
+        character_benchmarks(suite);
+        normal_benchmarks(suite);
+        segment_benchmarks(suite);
+        string_algorithm_benchmarks(suite);
+        string_case_benchmarks(suite);
+        regex_benchmarks(suite);
+        lexer_benchmarks(suite);
+        io_benchmarks(suite);
+        mbcs_benchmarks(suite);
+        format_benchmarks(suite);
+
+        ResultMap baseline, results;
+        if (! compare_file.empty())
+            baseline = load_results(compare_file);
+        size_t regressions = 0;
+
+        std::printf("%-44s %12s %12s %10s", "Benchmark", "MB/s", "ns/op", "allocs/op");
+        if (! baseline.empty())
+            std::printf(" %10s", "change");
+        std::printf("\n");
+
+        for (auto& b: suite.benchmarks()) {
+            if (! filters.empty() && std::none_of(filters.begin(), filters.end(),
+                    [&] (const u8string& f) { return b.name.find(f) != npos; }))
+                continue;
+            auto r = run_benchmark(b, min_time);
+            results[b.name] = r;
+            std::printf("%-44s %12.2f %12.0f %10.2f", b.name.data(), r.mbps, r.ns, r.allocs);
+            auto it = baseline.find(b.name);
+            if (it != baseline.end() && it->second.ns > 0) {
+                double change = 100 * (r.ns / it->second.ns - 1);
+                bool slower = change > threshold || r.allocs > it->second.allocs + 0.5;
+                std::printf(" %+9.1f%%%s", change, slower ? "  REGRESSION" : "");
+                if (slower)
+                    ++regressions;
+            }
+            std::printf("\n");
+        }
+
+        if (! save_file.empty())
+            save_results(save_file, results);
+        if (regressions > 0) {
+            std::printf("%zu regression(s) against %s\n", regressions, compare_file.data());
+            return 1;
+        }
+
+    }
+
+    catch (const std::exception& ex) {
+        std::cerr << "*** " << ex.what() << "\n";
+        return 2;
+    }
+
+    return 0;
+
+}
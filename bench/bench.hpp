@@ -0,0 +1,68 @@
+// Benchmark harness, not part of the library
+
+#pragma once
+
+#include "unicorn/core.hpp"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Unicorn {
+
+    namespace Bench {
+
+        // Each benchmark runs its operation repeatedly for at least the
+        // minimum time, and reports the throughput (bytes of input processed
+        // per second) and the number of heap allocations per operation.
+
+        struct Benchmark {
+            u8string name;
+            size_t bytes;
+            std::function<void()> op;
+        };
+
+        class Suite {
+        public:
+            void add(const u8string& name, size_t bytes, const std::function<void()>& op)
+                { list.push_back({name, bytes, op}); }
+            const std::vector<Benchmark>& benchmarks() const noexcept { return list; }
+        private:
+            std::vector<Benchmark> list;
+        };
+
+        // Stop the optimizer from discarding a result
+
+        template <typename T> inline void keep(const T& t) {
+            #if defined(__GNUC__)
+                asm volatile("" : : "g"(&t) : "memory");
+            #else
+                static const T* volatile sink;
+                sink = &t;
+            #endif
+        }
+
+        // Sample text
+
+        enum class Text { ascii, latin, greek, cjk, mixed };
+
+        u8string sample_text(Text kind, size_t bytes = 65536);
+        vector<u8string> sample_words(Text kind, size_t count = 10000);
+        u8string decode_hex_chars(const u8string& hex);
+
+        // Benchmarks for each module
+
+        void utf_benchmarks(Suite& suite);
+        void character_benchmarks(Suite& suite);
+        void normal_benchmarks(Suite& suite);
+        void segment_benchmarks(Suite& suite);
+        void string_algorithm_benchmarks(Suite& suite);
+        void string_case_benchmarks(Suite& suite);
+        void regex_benchmarks(Suite& suite);
+        void lexer_benchmarks(Suite& suite);
+        void io_benchmarks(Suite& suite);
+        void mbcs_benchmarks(Suite& suite);
+        void format_benchmarks(Suite& suite);
+
+    }
+
+}
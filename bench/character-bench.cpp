@@ -0,0 +1,106 @@
+#include "bench/bench.hpp"
+#include "unicorn/character.hpp"
+#include "unicorn/utf.hpp"
+#include <memory>
+
+using namespace Unicorn;
+using namespace std::literals;
+using namespace Unicorn::Bench;
+
+namespace {
+
+    template <typename F>
+    void add_property(Suite& suite, const u8string& name, const std::shared_ptr<u32string>& text, F f) {
+        suite.add("character/" + name, text->size() * sizeof(char32_t), [=] {
+            size_t count = 0;
+            for (auto c: *text)
+                count += size_t(f(c));
+            keep(count);
+        });
+    }
+
+}
+
+void Unicorn::Bench::character_benchmarks(Suite& suite) {
+
+    static const std::pair<const char*, Text> kinds[] = {
+        {"ascii", Text::ascii}, {"latin", Text::latin}, {"mixed", Text::mixed},
+    };
+
+    for (auto& kind: kinds) {
+        u8string name = kind.first;
+        auto text = std::make_shared<u32string>(to_utf32(sample_text(kind.second)));
+        add_property(suite, "general_category/" + name, text, [] (char32_t c) { return char_general_category(c); });
+        add_property(suite, "is_alphanumeric/" + name, text, [] (char32_t c) { return char_is_alphanumeric(c); });
+        add_property(suite, "is_white_space/" + name, text, [] (char32_t c) { return char_is_white_space(c); });
+        add_property(suite, "is_uppercase/" + name, text, [] (char32_t c) { return char_is_uppercase(c); });
+        add_property(suite, "is_id_continue/" + name, text, [] (char32_t c) { return char_is_id_continue(c); });
+        add_property(suite, "is_pattern_syntax/" + name, text, [] (char32_t c) { return char_is_pattern_syntax(c); });
+        add_property(suite, "is_punctuation/" + name, text, [] (char32_t c) { return char_is_punctuation(c); });
+        add_property(suite, "all_predicates/" + name, text, [] (char32_t c) {
+            return char_is_alphanumeric(c) + char_is_white_space(c) + char_is_line_break(c) + char_is_id_start(c)
+                + char_is_xid_continue(c) + char_is_pattern_syntax(c) + char_is_default_ignorable(c) + char_is_cased(c)
+                + char_is_case_ignorable(c) + char_is_uppercase(c) + char_is_lowercase(c) + char_is_bidi_mirrored(c);
+        });
+        add_property(suite, "bidi_class/" + name, text, [] (char32_t c) { return bidi_class(c); });
+        add_property(suite, "combining_class/" + name, text, [] (char32_t c) { return combining_class(c); });
+        add_property(suite, "simple_uppercase/" + name, text, [] (char32_t c) { return char_to_simple_uppercase(c); });
+        add_property(suite, "simple_lowercase/" + name, text, [] (char32_t c) { return char_to_simple_lowercase(c); });
+        add_property(suite, "simple_casefold/" + name, text, [] (char32_t c) { return char_to_simple_casefold(c); });
+        add_property(suite, "grapheme_break/" + name, text, [] (char32_t c) { return grapheme_cluster_break(c); });
+        add_property(suite, "east_asian_width/" + name, text, [] (char32_t c) { return east_asian_width(c); });
+        add_property(suite, "char_script/" + name, text, [] (char32_t c) { return char_script(c).size(); });
+        add_property(suite, "char_script_id/" + name, text, [] (char32_t c) { return char_script_id(c); });
+        add_property(suite, "char_script_list/" + name, text, [] (char32_t c) { return char_script_list(c).size(); });
+        add_property(suite, "char_script_set/" + name, text, [] (char32_t c) { return char_script_set(c).contains(Script::Latn); });
+        add_property(suite, "char_block/" + name, text, [] (char32_t c) { return char_block(c).size(); });
+        add_property(suite, "char_block_id/" + name, text, [] (char32_t c) { return char_block_id(c); });
+    }
+
+    for (auto& kind: kinds) {
+        auto text = std::make_shared<u32string>(to_utf32(sample_text(kind.second)));
+        add_property(suite, "gc_predicate/"s + kind.first, text, gc_predicate("L,Nd,Pc"));
+    }
+
+    for (auto& kind: kinds) {
+        auto text = std::make_shared<u8string>(sample_text(kind.second));
+        auto out = std::make_shared<vector<uint8_t>>();
+        suite.add("character/classify/"s + kind.first, text->size(), [text, out] {
+            classify(*text, PropertyKind::word_break, *out);
+            keep(*out);
+        });
+        suite.add("character/classify_loop/"s + kind.first, text->size(), [text, out] {
+            out->clear();
+            for (auto c: utf_range(*text))
+                out->push_back(uint8_t(word_break(c)));
+            keep(*out);
+        });
+    }
+
+    suite.add("character/char_name/latin", 256 * sizeof(char32_t), [] {
+        size_t n = 0;
+        for (char32_t c = 0xa0; c < 0x1a0; ++c)
+            n += char_name(c).size();
+        keep(n);
+    });
+
+    auto names = std::make_shared<vector<u8string>>();
+    size_t name_bytes = 0;
+    for (char32_t c: {0x41, 0xe9, 0x3a9, 0x20ac, 0x2603, 0x4e00, 0xd4db, 0x1d11e, 0xe01ef}) {
+        names->push_back(char_name(c));
+        name_bytes += names->back().size();
+    }
+    suite.add("character/char_from_name/exact", name_bytes, [names] {
+        char32_t n = 0;
+        for (auto& name: *names)
+            n += char_from_name(name);
+        keep(n);
+    });
+    suite.add("character/char_from_name/loose", name_bytes, [names] {
+        char32_t n = 0;
+        for (auto& name: *names)
+            n += char_from_name(name, cn_loose);
+        keep(n);
+    });
+
+}
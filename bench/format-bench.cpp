@@ -0,0 +1,36 @@
+#include "bench/bench.hpp"
+#include "unicorn/format.hpp"
+#include <memory>
+
+using namespace Unicorn;
+using namespace Unicorn::Bench;
+
+void Unicorn::Bench::format_benchmarks(Suite& suite) {
+
+    auto words = std::make_shared<vector<u8string>>(sample_words(Text::mixed, 1000));
+    size_t n = 0;
+    for (auto& w: *words)
+        n += w.size();
+
+    auto simple = std::make_shared<Format>("$1: $2 ($3x)");
+    suite.add("format/simple", n, [=] {
+        size_t k = 0;
+        for (size_t i = 0; i < words->size(); ++i)
+            k += (*simple)(i, (*words)[i], i * 31).size();
+        keep(k);
+    });
+    auto padded = std::make_shared<Format>("[$1<20] [$2>12] [$3f4]");
+    suite.add("format/padded", n, [=] {
+        size_t k = 0;
+        for (size_t i = 0; i < words->size(); ++i)
+            k += (*padded)((*words)[i], i, i / 7.0).size();
+        keep(k);
+    });
+    suite.add("format/oneshot", n, [=] {
+        size_t k = 0;
+        for (size_t i = 0; i < words->size(); ++i)
+            k += format("$1 = $2")((*words)[i], i).size();
+        keep(k);
+    });
+
+}
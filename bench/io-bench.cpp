@@ -0,0 +1,64 @@
+#include "bench/bench.hpp"
+#include "unicorn/io.hpp"
+#include <cstdio>
+#include <memory>
+
+using namespace Unicorn;
+using namespace Unicorn::Bench;
+
+namespace {
+
+    const u8string output_file = "__bench_out__";
+    const u8string utf8_file = "__bench_utf8__";
+    const u8string utf16_file = "__bench_utf16__";
+    const u8string utf16le = "utf-16le";
+
+    struct RemoveFiles {
+        ~RemoveFiles() {
+            for (auto& file: {output_file, utf8_file, utf16_file})
+                std::remove(file.data());
+        }
+    };
+
+}
+
+void Unicorn::Bench::io_benchmarks(Suite& suite) {
+
+    static RemoveFiles cleanup;
+    auto lines = std::make_shared<vector<u8string>>(sample_words(Text::mixed, 20000));
+    size_t n = 0;
+    for (auto& line: *lines)
+        n += line.size() + 1;
+
+    suite.add("io/write-lines/utf8", n, [=] {
+        FileWriter out(output_file);
+        for (auto& line: *lines)
+            out = line + "\n";
+    });
+    suite.add("io/write-lines/utf16-crlf", n, [=] {
+        FileWriter out(output_file, io_crlf, utf16le);
+        for (auto& line: *lines)
+            out = line + "\n";
+    });
+
+    auto text = sample_text(Text::mixed, 1 << 20);
+    save_file(utf8_file, text);
+    {
+        FileWriter out(utf16_file, 0, utf16le);
+        out = text;
+    }
+
+    suite.add("io/read-lines/utf8", text.size(), [=] {
+        size_t count = 0;
+        for (auto& line: read_lines(utf8_file, io_striplf))
+            count += line.size();
+        keep(count);
+    });
+    suite.add("io/read-lines/utf16", text.size(), [=] {
+        size_t count = 0;
+        for (auto& line: read_lines(utf16_file, io_striptws, utf16le))
+            count += line.size();
+        keep(count);
+    });
+
+}
@@ -0,0 +1,36 @@
+#include "bench/bench.hpp"
+#include "unicorn/lexer.hpp"
+#include <memory>
+
+using namespace Unicorn;
+using namespace Unicorn::Bench;
+
+void Unicorn::Bench::lexer_benchmarks(Suite& suite) {
+
+    // A small programming language style token stream
+
+    u8string code;
+    auto words = sample_words(Text::mixed, 2000);
+    for (size_t i = 0; i < words.size(); ++i)
+        code += "let " + words[i] + " = " + std::to_string(i * 37) + " + \"" + words[(i * 7) % words.size()] + "\"; // note\n";
+    auto text = std::make_shared<u8string>(code);
+
+    auto lex = std::make_shared<Lexer>(rx_caseless);
+    lex->match(0, "\\s+");
+    lex->match(0, "//[^\\n]*");
+    lex->exact(1, "let");
+    lex->match(2, "\\p{L}\\w*");
+    lex->match(3, "\\d+");
+    lex->match(4, "\"[^\"]*\"");
+    lex->exact(5, "=");
+    lex->exact(5, "+");
+    lex->exact(5, ";");
+
+    suite.add("lexer/tokens/mixed", text->size(), [=] {
+        size_t count = 0;
+        for (auto& token: (*lex)(*text))
+            count += size_t(token.tag);
+        keep(count);
+    });
+
+}
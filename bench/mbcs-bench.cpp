@@ -0,0 +1,37 @@
+#include "bench/bench.hpp"
+#include "unicorn/mbcs.hpp"
+#include "unicorn/utf.hpp"
+#include <memory>
+
+using namespace Unicorn;
+using namespace Unicorn::Bench;
+using namespace std::literals;
+
+void Unicorn::Bench::mbcs_benchmarks(Suite& suite) {
+
+    static const std::pair<const char*, Text> kinds[] = {
+        {"latin", Text::latin}, {"greek", Text::greek}, {"cjk", Text::cjk},
+    };
+
+    static const char* const encodings[] = {"utf-8", "utf-16le", "utf-32be", "iso-8859-1", "iso-8859-7", "gb18030"};
+
+    for (auto& kind: kinds) {
+        u8string name = kind.first;
+        auto text = std::make_shared<u8string>(sample_text(kind.second));
+        for (auto enc: encodings) {
+            auto bytes = std::make_shared<string>();
+            export_string(*text, *bytes, enc, err_replace);
+            suite.add("mbcs/export/"s + enc + "/" + name, text->size(), [=] {
+                string dst;
+                export_string(*text, dst, enc, err_replace);
+                keep(dst);
+            });
+            suite.add("mbcs/import/"s + enc + "/" + name, bytes->size(), [=] {
+                u8string dst;
+                import_string(*bytes, dst, enc, err_replace);
+                keep(dst);
+            });
+        }
+    }
+
+}
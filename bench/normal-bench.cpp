@@ -0,0 +1,81 @@
+#include "bench/bench.hpp"
+#include "unicorn/normal.hpp"
+#include "unicorn/ucd-tables.hpp"
+#include "unicorn/utf.hpp"
+#include <algorithm>
+#include <memory>
+
+using namespace Unicorn;
+using namespace Unicorn::Bench;
+using namespace std::literals;
+
+void Unicorn::Bench::normal_benchmarks(Suite& suite) {
+
+    // The first column of the UCD normalization tests exercises every
+    // decomposable character and a wide range of reordering cases
+
+    auto ucd = std::make_shared<u8string>();
+    for (auto& row: UnicornDetail::normalization_test_table)
+        *ucd += decode_hex_chars(row[0]) + " ";
+
+    static const std::pair<const char*, Text> kinds[] = {
+        {"ascii", Text::ascii}, {"latin", Text::latin}, {"cjk", Text::cjk},
+    };
+
+    static const std::pair<const char*, NormalizationForm> forms[] = {
+        {"NFC", NFC}, {"NFD", NFD}, {"NFKC", NFKC}, {"NFKD", NFKD},
+    };
+
+    for (auto& form: forms) {
+        auto nf = form.second;
+        suite.add("normal/"s + form.first + "/ucd-test", ucd->size(), [=] { auto r = normalize(*ucd, nf); keep(r); });
+        for (auto& kind: kinds) {
+            auto text = std::make_shared<u8string>(sample_text(kind.second));
+            suite.add("normal/"s + form.first + "/" + kind.first, text->size(), [=] { auto r = normalize(*text, nf); keep(r); });
+            suite.add("normal/is-normalized/"s + form.first + "/" + kind.first, text->size(), [=] { auto r = is_normalized(*text, nf); keep(r); });
+        }
+    }
+
+    // Text that fails the quick check and needs the full algorithm
+
+    auto latin_nfd = std::make_shared<u8string>(normalize(sample_text(Text::latin), NFD));
+    suite.add("normal/NFC/latin-nfd", latin_nfd->size(), [=] { auto r = normalize(*latin_nfd, NFC); keep(r); });
+
+    // Adversarial input: one long run of combining marks in reverse order,
+    // and long runs of composable pairs and Hangul jamo
+
+    auto marks = std::make_shared<u8string>("a");
+    for (int i = 0; i < 5000; ++i)
+        *marks += u8"\u0301\u0316";
+    auto pairs = std::make_shared<u8string>();
+    for (int i = 0; i < 10000; ++i)
+        *pairs += u8"e\u0301";
+    auto jamo = std::make_shared<u8string>();
+    for (int i = 0; i < 5000; ++i)
+        *jamo += u8"\u1100\u1161\u11a8";
+    suite.add("normal/NFC/adversarial-marks", marks->size(), [=] { auto r = normalize(*marks, NFC); keep(r); });
+    suite.add("normal/NFD/adversarial-marks", marks->size(), [=] { auto r = normalize(*marks, NFD); keep(r); });
+    suite.add("normal/NFC/adversarial-pairs", pairs->size(), [=] { auto r = normalize(*pairs, NFC); keep(r); });
+    suite.add("normal/NFC/adversarial-jamo", jamo->size(), [=] { auto r = normalize(*jamo, NFC); keep(r); });
+
+    auto ucd16 = std::make_shared<u16string>(to_utf16(*ucd));
+    suite.add("normal/NFC/ucd-test-utf16", ucd->size(), [=] { auto r = normalize(*ucd16, NFC); keep(r); });
+
+    // Streaming normalization in 4k chunks, against a single call on the
+    // whole text above
+
+    auto stream = [] (const u8string& text, NormalizationForm nf) {
+        Normalizer<char> norm(nf);
+        u8string out;
+        out.reserve(text.size() + text.size() / 8);
+        for (size_t pos = 0; pos < text.size(); pos += 4096)
+            norm.feed(text.data() + pos, std::min(text.size() - pos, size_t(4096)), out);
+        norm.finish(out);
+        return out;
+    };
+    auto latin = std::make_shared<u8string>(sample_text(Text::latin));
+    suite.add("normal/stream/NFC/latin", latin->size(), [=] { auto r = stream(*latin, NFC); keep(r); });
+    suite.add("normal/stream/NFC/latin-nfd", latin_nfd->size(), [=] { auto r = stream(*latin_nfd, NFC); keep(r); });
+    suite.add("normal/stream/NFC/ucd-test", ucd->size(), [=] { auto r = stream(*ucd, NFC); keep(r); });
+
+}
@@ -0,0 +1,41 @@
+#include "bench/bench.hpp"
+#include "unicorn/regex.hpp"
+#include "unicorn/utf.hpp"
+#include <memory>
+
+using namespace Unicorn;
+using namespace Unicorn::Bench;
+
+void Unicorn::Bench::regex_benchmarks(Suite& suite) {
+
+    static const std::pair<const char*, Text> kinds[] = {
+        {"ascii", Text::ascii}, {"greek", Text::greek}, {"mixed", Text::mixed},
+    };
+
+    for (auto& kind: kinds) {
+        u8string name = kind.first;
+        auto text = std::make_shared<u8string>(sample_text(kind.second));
+        size_t n = text->size();
+        auto words = std::make_shared<Regex>("\\w+");
+        auto letters = std::make_shared<Regex>("\\p{L}{3,}");
+        auto literal = std::make_shared<Regex>("zzq");
+        auto sentence = std::make_shared<Regex>("[^.]+\\.");
+        suite.add("regex/count-words/" + name, n, [=] { size_t k = words->count(*text); keep(k); });
+        suite.add("regex/count-letters/" + name, n, [=] { size_t k = letters->count(*text); keep(k); });
+        suite.add("regex/search-literal/" + name, n, [=] { auto m = literal->search(*text); keep(m); });
+        suite.add("regex/grep-sentences/" + name, n, [=] {
+            size_t bytes = 0;
+            for (auto& m: sentence->grep(*text))
+                bytes += m.count();
+            keep(bytes);
+        });
+        suite.add("regex/replace/" + name, n, [=] { auto r = words->format("<$0>", *text); keep(r); });
+    }
+
+    #if defined(UNICORN_PCRE32)
+        auto text32 = std::make_shared<u32string>(to_utf32(sample_text(Text::mixed)));
+        auto pattern32 = std::make_shared<Regex32>(U"\\w+");
+        suite.add("regex/count-words-utf32/mixed", text32->size() * sizeof(char32_t), [=] { size_t k = pattern32->count(*text32); keep(k); });
+    #endif
+
+}
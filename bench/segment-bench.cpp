@@ -0,0 +1,70 @@
+#include "bench/bench.hpp"
+#include "unicorn/segment.hpp"
+#include "unicorn/string.hpp"
+#include "unicorn/ucd-tables.hpp"
+#include "unicorn/utf.hpp"
+#include <algorithm>
+#include <memory>
+
+using namespace Unicorn;
+using namespace Unicorn::Bench;
+
+namespace {
+
+    // Join the UCD segmentation test cases into one string, dropping the
+    // break markers
+
+    u8string segmentation_text(const Irange<char const* const*>& table) {
+        u8string text;
+        for (auto line: table) {
+            u8string hex = line;
+            std::replace(hex.begin(), hex.end(), '/', ' ');
+            text += decode_hex_chars(hex);
+        }
+        return text;
+    }
+
+    template <typename F>
+    void add_segments(Suite& suite, const u8string& name, const std::shared_ptr<u8string>& text, F f) {
+        suite.add("segment/" + name, text->size(), [=] {
+            size_t count = 0;
+            for (auto& range: f(*text)) {
+                (void)range;
+                ++count;
+            }
+            keep(count);
+        });
+    }
+
+}
+
+void Unicorn::Bench::segment_benchmarks(Suite& suite) {
+
+    auto graphemes = [] (const u8string& s) { return grapheme_range(s); };
+    auto words = [] (const u8string& s) { return word_range(s); };
+    auto sentences = [] (const u8string& s) { return sentence_range(s); };
+    auto lines = [] (const u8string& s) { return line_range(s); };
+
+    auto gtest = std::make_shared<u8string>(segmentation_text(UnicornDetail::grapheme_break_test_table));
+    auto wtest = std::make_shared<u8string>(segmentation_text(UnicornDetail::word_break_test_table));
+    auto stest = std::make_shared<u8string>(segmentation_text(UnicornDetail::sentence_break_test_table));
+    add_segments(suite, "graphemes/ucd-test", gtest, graphemes);
+    add_segments(suite, "words/ucd-test", wtest, words);
+    add_segments(suite, "sentences/ucd-test", stest, sentences);
+
+    static const std::pair<const char*, Text> kinds[] = {
+        {"ascii", Text::ascii}, {"greek", Text::greek}, {"mixed", Text::mixed},
+    };
+
+    for (auto& kind: kinds) {
+        u8string name = kind.first;
+        auto text = std::make_shared<u8string>(sample_text(kind.second));
+        add_segments(suite, "graphemes/" + name, text, graphemes);
+        add_segments(suite, "words/" + name, text, words);
+        add_segments(suite, "sentences/" + name, text, sentences);
+        add_segments(suite, "lines/" + name, text, lines);
+        suite.add("segment/str_width/" + name, text->size(), [=] { size_t n = str_length(*text, grapheme_units | narrow_context); keep(n); });
+        suite.add("segment/str_width_chars/" + name, text->size(), [=] { size_t n = str_length(*text, narrow_context); keep(n); });
+    }
+
+}
@@ -0,0 +1,57 @@
+#include "bench/bench.hpp"
+#include "unicorn/character.hpp"
+#include "unicorn/string.hpp"
+#include "unicorn/utf.hpp"
+#include <memory>
+
+using namespace Unicorn;
+using namespace Unicorn::Bench;
+
+void Unicorn::Bench::string_algorithm_benchmarks(Suite& suite) {
+
+    static const std::pair<const char*, Text> kinds[] = {
+        {"ascii", Text::ascii}, {"latin", Text::latin}, {"mixed", Text::mixed},
+    };
+
+    // A typical tokenizer delimiter set: ASCII punctuation and white space
+
+    auto delims = std::make_shared<u8string>(u8" \t\n\r,.;:!?\"'()[]{}<>/\\|@#$%^&*+=~`");
+    auto delim_set = std::make_shared<CharacterSet>(*delims);
+    auto wide_set = std::make_shared<CharacterSet>(*delim_set | CharacterSet(u8"«»“”‘’–—…"));
+
+    // Symbols that never occur in the sample text, so a search scans it all
+
+    auto rare = std::make_shared<u8string>(u8"<>[]{}|@#$%^&*+=~`\\/");
+    auto rare_set = std::make_shared<CharacterSet>(*rare);
+
+    for (auto& kind: kinds) {
+        u8string name = kind.first;
+        auto text = std::make_shared<u8string>(sample_text(kind.second, 1 << 20));
+        auto text16 = std::make_shared<u16string>(to_utf16(*text));
+        size_t n = text->size();
+        auto tokenize = [] (const auto& str, const auto& set) {
+            size_t count = 0;
+            auto i = utf_begin(str), e = utf_end(str);
+            while (i != e) {
+                i = str_find_first_not_of(i, e, set);
+                if (i == e)
+                    break;
+                ++count;
+                i = str_find_first_of(i, e, set);
+            }
+            return count;
+        };
+        suite.add("string-algorithm/scan-string/" + name, n, [=] { auto r = str_find_first_of(*text, *rare); keep(r); });
+        suite.add("string-algorithm/scan-set/" + name, n, [=] { auto r = str_find_first_of(*text, *rare_set); keep(r); });
+        suite.add("string-algorithm/scan-set-utf16/" + name, n, [=] { auto r = str_find_first_of(*text16, *rare_set); keep(r); });
+        suite.add("string-algorithm/tokenize-string/" + name, n, [=] { auto r = tokenize(*text, *delims); keep(r); });
+        suite.add("string-algorithm/tokenize-set/" + name, n, [=] { auto r = tokenize(*text, *delim_set); keep(r); });
+        suite.add("string-algorithm/tokenize-wide-set/" + name, n, [=] { auto r = tokenize(*text, *wide_set); keep(r); });
+        suite.add("string-algorithm/tokenize-set-utf16/" + name, n, [=] { auto r = tokenize(*text16, *delim_set); keep(r); });
+        suite.add("string-algorithm/remove-string/" + name, n, [=] { auto r = str_remove(*text, *delims); keep(r); });
+        suite.add("string-algorithm/remove-set/" + name, n, [=] { auto r = str_remove(*text, *delim_set); keep(r); });
+        suite.add("string-algorithm/squeeze-string/" + name, n, [=] { auto r = str_squeeze(*text, *delims); keep(r); });
+        suite.add("string-algorithm/squeeze-set/" + name, n, [=] { auto r = str_squeeze(*text, *delim_set); keep(r); });
+    }
+
+}
@@ -0,0 +1,41 @@
+#include "bench/bench.hpp"
+#include "unicorn/string.hpp"
+#include "unicorn/string-compare.hpp"
+#include "unicorn/utf.hpp"
+#include <memory>
+
+using namespace Unicorn;
+using namespace Unicorn::Bench;
+
+void Unicorn::Bench::string_case_benchmarks(Suite& suite) {
+
+    static const std::pair<const char*, Text> kinds[] = {
+        {"ascii", Text::ascii}, {"latin", Text::latin}, {"greek", Text::greek}, {"mixed", Text::mixed},
+    };
+
+    for (auto& kind: kinds) {
+        u8string name = kind.first;
+        auto text = std::make_shared<u8string>(sample_text(kind.second));
+        auto text16 = std::make_shared<u16string>(to_utf16(*text));
+        auto upper = std::make_shared<u8string>(str_uppercase(*text));
+        size_t n = text->size();
+        suite.add("string-case/uppercase/" + name, n, [=] { auto r = str_uppercase(*text); keep(r); });
+        suite.add("string-case/lowercase/" + name, n, [=] { auto r = str_lowercase(*text); keep(r); });
+        suite.add("string-case/titlecase/" + name, n, [=] { auto r = str_titlecase(*text); keep(r); });
+        suite.add("string-case/casefold/" + name, n, [=] { auto r = str_casefold(*text); keep(r); });
+        suite.add("string-case/casefold-utf16/" + name, n, [=] { auto r = str_casefold(*text16); keep(r); });
+        suite.add("string-case/lowercase-upper/" + name, upper->size(), [=] { auto r = str_lowercase(*upper); keep(r); });
+        suite.add("string-case/casefold-upper/" + name, upper->size(), [=] { auto r = str_casefold(*upper); keep(r); });
+        auto words = std::make_shared<vector<u8string>>(sample_words(kind.second, 1000));
+        size_t wbytes = 0;
+        for (auto& w: *words)
+            wbytes += w.size();
+        suite.add("string-case/icase-compare/" + name, wbytes, [=] {
+            size_t less = 0;
+            for (size_t i = 1; i < words->size(); ++i)
+                less += size_t(str_icase_compare((*words)[i - 1], (*words)[i]));
+            keep(less);
+        });
+    }
+
+}
@@ -0,0 +1,42 @@
+#include "bench/bench.hpp"
+#include "unicorn/utf.hpp"
+#include "unicorn/string.hpp"
+#include <memory>
+
+using namespace Unicorn;
+using namespace Unicorn::Bench;
+
+void Unicorn::Bench::utf_benchmarks(Suite& suite) {
+
+    static const std::pair<const char*, Text> kinds[] = {
+        {"ascii", Text::ascii}, {"latin", Text::latin}, {"greek", Text::greek}, {"cjk", Text::cjk}, {"mixed", Text::mixed},
+    };
+
+    for (auto& kind: kinds) {
+        u8string name = kind.first;
+        auto s8 = std::make_shared<u8string>(sample_text(kind.second));
+        auto s16 = std::make_shared<u16string>(to_utf16(*s8));
+        auto s32 = std::make_shared<u32string>(to_utf32(*s8));
+        size_t n = s8->size();
+        suite.add("utf/valid/utf8/" + name, n, [=] { bool b = valid_string(*s8); keep(b); });
+        suite.add("utf/valid/utf16/" + name, n, [=] { bool b = valid_string(*s16); keep(b); });
+        suite.add("utf/length/utf8/" + name, n, [=] { size_t k = str_length(*s8); keep(k); });
+        suite.add("utf/recode/8to16/" + name, n, [=] { auto r = to_utf16(*s8); keep(r); });
+        suite.add("utf/recode/8to32/" + name, n, [=] { auto r = to_utf32(*s8); keep(r); });
+        suite.add("utf/recode/16to8/" + name, n, [=] { auto r = to_utf8(*s16); keep(r); });
+        suite.add("utf/recode/32to8/" + name, n, [=] { auto r = to_utf8(*s32); keep(r); });
+        auto dst16 = std::make_shared<u16string>();
+        suite.add("utf/recode/8to16-into/" + name, n, [=] {
+            recode(*s8, *dst16);
+            keep(*dst16);
+        });
+        suite.add("utf/iterate/utf8/" + name, n, [=] {
+            char32_t sum = 0;
+            for (auto c: utf_range(*s8))
+                sum += c;
+            keep(sum);
+        });
+        suite.add("utf/sanitize/utf8/" + name, n, [=] { auto r = *s8; sanitize(r); keep(r); });
+    }
+
+}
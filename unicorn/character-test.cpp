@@ -2,8 +2,13 @@
 #include "unicorn/character.hpp"
 #include "unicorn/ucd-tables.hpp"
 #include "prion/unit-test.hpp"
+#include <algorithm>
+#include <bitset>
 #include <map>
+#include <random>
+#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 using namespace Unicorn;
@@ -655,6 +660,46 @@ namespace {
         TEST(char_is_separator(0x20));
         TEST(char_is_separator(0x2006));
 
+        CharPredicate pred, letters("L"), digits("Nd"), cased("LC"), bogus("Lx,Qq");
+
+        TEST(pred.empty());
+        TEST(! pred('A'));
+        TEST(bogus.empty());
+        TEST(! letters.empty());
+        TEST(letters('A'));
+        TEST(! letters('1'));
+        TEST(digits('1'));
+        TEST((letters | digits)('A'));
+        TEST((letters | digits)('1'));
+        TEST(! (letters | digits)('+'));
+        TEST((letters & cased) == cased);
+        TEST((letters & digits).empty());
+        TEST((~ letters)('1'));
+        TEST(! (~ letters)('A'));
+        TEST((~ pred) == CharPredicate("C,L,M,N,P,S,Z"));
+        TEST((~~ letters) == letters);
+        TEST(CharPredicate(GC::Lu) == CharPredicate("Lu"));
+        TEST(CharPredicate(GC::Lu) != CharPredicate("Ll"));
+        TEST(CharPredicate(nullptr).empty());
+
+        uint16_t categories[] = {GC::Cc, GC::Cf, GC::Cn, GC::Co, GC::Cs, GC::Ll, GC::Lm, GC::Lo, GC::Lt, GC::Lu,
+            GC::Mc, GC::Me, GC::Mn, GC::Nd, GC::Nl, GC::No, GC::Pc, GC::Pd, GC::Pe, GC::Pf,
+            GC::Pi, GC::Po, GC::Ps, GC::Sc, GC::Sk, GC::Sm, GC::So, GC::Zl, GC::Zp, GC::Zs};
+        uint64_t bits = 0;
+        for (auto cat: categories)
+            bits |= uint64_t(1) << UnicornDetail::gc_bit(cat);
+        TEST_EQUAL(std::bitset<64>(bits).count(), 30);
+
+        pred = gc_predicate("L,Nd,Pcd");
+        size_t errors = 0;
+        for (char32_t c = 0; c <= 0x30000; ++c) {
+            auto cat = char_general_category(c);
+            bool expect = char_primary_category(c) == 'L' || cat == GC::Nd || cat == GC::Pc || cat == GC::Pd;
+            if (pred(c) != expect && ++errors <= 10)
+                FAIL("Predicate for L,Nd,Pcd at U+" + hex(c));
+        }
+        TEST_EQUAL(errors, 0);
+
     }
 
     void check_boolean_properties() {
@@ -984,6 +1029,18 @@ namespace {
         TEST_EQUAL(blocks[0].first, 0);
         TEST_EQUAL(blocks[0].last, 0x7f);
 
+        TEST_EQUAL(char_block_id(0), 1);
+        TEST_EQUAL(char_block_id('A'), 1);
+        TEST_EQUAL(char_block_id(0xb5), 2);
+        TEST_EQUAL(char_block_id(0x860), 0);
+        TEST_EQUAL(char_block_id(0x110000), 0);
+        TEST_EQUAL(char_block_id(0x10fffd), blocks.size());
+        TEST_EQUAL(block_name(0), "");
+        TEST_EQUAL(block_name(1), "Basic Latin");
+        TEST_EQUAL(block_name(char_block_id(0x391)), "Greek and Coptic");
+        TEST_EQUAL(block_name(char_block_id(0x20ac)), "Currency Symbols");
+        TEST_EQUAL(block_name(uint16_t(blocks.size() + 1)), "");
+
     }
 
     void check_case_folding_properties() {
@@ -1207,6 +1264,89 @@ namespace {
         for (char32_t c = 0; c <= 0x10ffff; ++c)
             TEST_COMPARE(char_name(c, cn_control | cn_label), !=, "");
 
+        // Names on either side of a block boundary in the name table,
+        // looked up out of order so that blocks are reloaded
+
+        TEST_EQUAL(char_name(0x5e), "CIRCUMFLEX ACCENT");
+        TEST_EQUAL(char_name(0x5f), "LOW LINE");
+        TEST_EQUAL(char_name(0x20), "SPACE");
+        TEST_EQUAL(char_name(0x60), "GRAVE ACCENT");
+        TEST_EQUAL(char_name(0x9f), "");
+        TEST_EQUAL(char_name(0xa0), "NO-BREAK SPACE");
+        TEST_EQUAL(char_name(0x5f), "LOW LINE");
+        TEST_EQUAL(char_name(0xe01ef), "VARIATION SELECTOR-256");
+        TEST_EQUAL(char_name(0xe01f0), "");
+
+        TEST_EQUAL(char_from_name(""), not_a_char);
+        TEST_EQUAL(char_from_name("SPACE"), 0x20);
+        TEST_EQUAL(char_from_name("LATIN CAPITAL LETTER A"), 'A');
+        TEST_EQUAL(char_from_name("EURO SIGN"), 0x20ac);
+        TEST_EQUAL(char_from_name("VARIATION SELECTOR-256"), 0xe01ef);
+        TEST_EQUAL(char_from_name("CJK UNIFIED IDEOGRAPH-4E00"), 0x4e00);
+        TEST_EQUAL(char_from_name("CJK COMPATIBILITY IDEOGRAPH-F900"), 0xf900);
+        TEST_EQUAL(char_from_name("HANGUL SYLLABLE PWILH"), 0xd4db);
+        TEST_EQUAL(char_from_name("HANGUL SYLLABLE GA"), 0xac00);
+        TEST_EQUAL(char_from_name("HANGUL SYLLABLE GAX"), not_a_char);
+        TEST_EQUAL(char_from_name("HANGUL SYLLABLE A"), 0xc544);
+        TEST_EQUAL(char_from_name("HANGUL SYLLABLE GGWAELH"), 0xaf73);
+        TEST_EQUAL(char_from_name("HANGUL SYLLABLE GG"), not_a_char);
+        TEST_EQUAL(char_from_name("HANGUL SYLLABLE AGA"), not_a_char);
+        TEST_EQUAL(char_from_name("HANGUL SYLLABLE"), not_a_char);
+        TEST_EQUAL(char_from_name("NO SUCH CHARACTER"), not_a_char);
+        TEST_EQUAL(char_from_name("euro sign"), not_a_char);
+        TEST_EQUAL(char_from_name("CJK UNIFIED IDEOGRAPH-4e00"), not_a_char);
+        TEST_EQUAL(char_from_name("CJK UNIFIED IDEOGRAPH-E000"), not_a_char);
+
+        TEST_EQUAL(char_from_name("euro sign", cn_lower), 0x20ac);
+        TEST_EQUAL(char_from_name("Euro Sign", cn_lower), 0x20ac);
+        TEST_EQUAL(char_from_name("euro_sign", cn_lower), not_a_char);
+        TEST_EQUAL(char_from_name("cjk unified ideograph-4e00", cn_lower), 0x4e00);
+        TEST_EQUAL(char_from_name("hangul syllable pwilh", cn_lower), 0xd4db);
+
+        TEST_EQUAL(char_from_name("euro_sign", cn_loose), 0x20ac);
+        TEST_EQUAL(char_from_name("EuroSign", cn_loose), 0x20ac);
+        TEST_EQUAL(char_from_name("variation selector 256", cn_loose), 0xe01ef);
+        TEST_EQUAL(char_from_name("cjk unified ideograph 4e00", cn_loose), 0x4e00);
+        TEST_EQUAL(char_from_name("hangul_syllable_pwilh", cn_loose), 0xd4db);
+        TEST_EQUAL(char_from_name("hangul jungseong oe", cn_loose), 0x116c);
+        TEST_EQUAL(char_from_name("hangul jungseong o-e", cn_loose), 0x1180);
+        TEST_EQUAL(char_from_name("tibetan mark tsa -phru", cn_loose), 0xf39);
+        TEST_EQUAL(char_from_name("tibetan mark tsa-phru", cn_loose), not_a_char);
+
+        TEST_EQUAL(char_from_name("LINE FEED"), not_a_char);
+        TEST_EQUAL(char_from_name("LINE FEED", cn_control), 0xa);
+        TEST_EQUAL(char_from_name("line feed", cn_control | cn_lower), 0xa);
+        TEST_EQUAL(char_from_name("NULL"), not_a_char);
+        TEST_EQUAL(char_from_name("NULL", cn_control), 0);
+        TEST_EQUAL(char_from_name("<control-000A>"), not_a_char);
+        TEST_EQUAL(char_from_name("<control-000A>", cn_label), 0xa);
+        TEST_EQUAL(char_from_name("<control-0000>", cn_label), 0);
+        TEST_EQUAL(char_from_name("<reserved-20FF>", cn_label), 0x20ff);
+        TEST_EQUAL(char_from_name("<reserved-0041>", cn_label), not_a_char);
+        TEST_EQUAL(char_from_name("<private-use-E000>", cn_label), 0xe000);
+        TEST_EQUAL(char_from_name("<surrogate-D800>", cn_label), 0xd800);
+        TEST_EQUAL(char_from_name("<noncharacter-110000>", cn_label), not_a_char);
+
+        TEST_EQUAL(char_from_name("LATIN CAPITAL LETTER GHA"), not_a_char);
+        TEST_EQUAL(char_from_name("LATIN CAPITAL LETTER GHA", cn_update), 0x1a2);
+        TEST_EQUAL(char_from_name("LATIN CAPITAL LETTER OI", cn_update), 0x1a2);
+
+        TEST_EQUAL(char_from_name("U+0041 LATIN CAPITAL LETTER A"), not_a_char);
+        TEST_EQUAL(char_from_name("U+0041 LATIN CAPITAL LETTER A", cn_prefix), 'A');
+        TEST_EQUAL(char_from_name("U+0042 LATIN CAPITAL LETTER A", cn_prefix), not_a_char);
+        TEST_EQUAL(char_from_name("U+0378", cn_prefix), 0x378);
+        TEST_EQUAL(char_from_name("U+0000", cn_prefix), 0);
+        TEST_EQUAL(char_from_name("U+0000 NULL", cn_prefix | cn_control), 0);
+        TEST_EQUAL(char_from_name("U+0000 NULL", cn_prefix), not_a_char);
+
+        size_t errors = 0;
+        for (char32_t c = 0; c <= 0x10ffff; ++c) {
+            auto name = char_name(c);
+            if (! name.empty() && (char_from_name(name) != c || char_from_name(name, cn_loose) != c) && ++errors <= 10)
+                FAIL("char_from_name(" + name + ")");
+        }
+        TEST_EQUAL(errors, 0);
+
     }
 
     void check_decomposition_properties() {
@@ -1262,6 +1402,31 @@ namespace {
         TEST_EQUAL(canonical_composition(0x1111, 0x1171), 0xd4cc); // Hangul
         TEST_EQUAL(canonical_composition(0xd4cc, 0x11b6), 0xd4db); // Hangul
 
+        // The composition hash table must agree with the sorted table for
+        // every pair, whether or not it composes
+
+        std::set<char32_t> firsts, seconds;
+        std::map<std::pair<char32_t, char32_t>, char32_t> pairs;
+        for (auto&& entry: UnicornDetail::composition_table) {
+            firsts.insert(entry.key[0]);
+            seconds.insert(entry.key[1]);
+            pairs[{entry.key[0], entry.key[1]}] = entry.value;
+        }
+        auto slots = range_count(UnicornDetail::composition_hash_table);
+        TEST_COMPARE(slots, >=, pairs.size());
+        TEST_EQUAL(slots & (slots - 1), 0);
+        size_t errors = 0;
+        for (auto u1: firsts) {
+            for (auto u2: seconds) {
+                auto it = pairs.find({u1, u2});
+                char32_t expect = it == pairs.end() ? 0 : it->second, c = 0;
+                TRY(c = canonical_composition(u1, u2));
+                if (c != expect && ++errors <= 10)
+                    FAIL("Composition of U+" + hex(u1) + " U+" + hex(u2) + ": expected U+" + hex(expect) + ", got U+" + hex(c));
+            }
+        }
+        TEST_EQUAL(errors, 0);
+
     }
 
     void check_enumeration_properties() {
@@ -1652,6 +1817,494 @@ namespace {
         TEST_EQUAL(to_str(char_script_list(0x964)), "[Beng,Deva,Gran,Gujr,Guru,Knda,Mahj,Mlym,Orya,Sind,"
                                                     "Sinh,Sylo,Takr,Taml,Telu,Tirh]");
 
+        TEST_EQUAL(script_count, 132);
+        TEST_EQUAL(char_script_id(0), Script::Zyyy);
+        TEST_EQUAL(char_script_id(0x41), Script::Latn);
+        TEST_EQUAL(char_script_id(0x370), Script::Grek);
+        TEST_EQUAL(char_script_id(0x400), Script::Cyrl);
+        TEST_EQUAL(char_script_id(0x600), Script::Arab);
+        TEST_EQUAL(char_script_id(0x300), Script::Zinh);
+        TEST_EQUAL(char_script_id(0x10fffd), Script::Zzzz);
+        TEST_EQUAL(char_script_id(0x110000), Script::Zzzz);
+
+        TEST_EQUAL(script_code(Script::Latn), "Latn"s);
+        TEST_EQUAL(script_code(Script::Zzzz), "Zzzz"s);
+        TEST_EQUAL(script_code(Script::Zyyy), "Zyyy"s);
+        TEST_EQUAL(script_code(Script(200)), ""s);
+        TEST_EQUAL(to_str(Script::Grek), "Grek");
+        TEST_EQUAL(script_from_code("Latn"), Script::Latn);
+        TEST_EQUAL(script_from_code("LATN"), Script::Latn);
+        TEST_EQUAL(script_from_code("latn"), Script::Latn);
+        TEST_EQUAL(script_from_code("Aghb"), Script::Aghb);
+        TEST_EQUAL(script_from_code("Zyyy"), Script::Zyyy);
+        TEST_EQUAL(script_from_code("Aran"), Script::Arab);
+        TEST_EQUAL(script_from_code("Cyrs"), Script::Cyrl);
+        TEST_EQUAL(script_from_code("Aaaa"), Script::Zzzz);
+        TEST_EQUAL(script_from_code("Lat"), Script::Zzzz);
+        TEST_EQUAL(script_from_code(""), Script::Zzzz);
+        TEST_EQUAL(script_name(Script::Latn), "Latin");
+        TEST_EQUAL(script_name(Script::Arab), "Arabic");
+        TEST_EQUAL(script_name(Script::Zzzz), "Unknown");
+
+        ScriptSet set;
+
+        TEST(set.empty());
+        TEST_EQUAL(set.size(), 0);
+        TEST_EQUAL(to_str(set), "[]");
+        TEST(set.begin() == set.end());
+        TRY(set = char_script_set(0x41));
+        TEST_EQUAL(to_str(set), "[Latn]");
+        TEST(set.contains(Script::Latn));
+        TEST(! set.contains(Script::Grek));
+        TEST_EQUAL(to_str(char_script_set(0)), "[Zyyy]");
+        TEST_EQUAL(to_str(char_script_set(0x10fffd)), "[Zzzz]");
+        TEST_EQUAL(to_str(char_script_set(0x64b)), "[Arab,Syrc]");
+        TEST_EQUAL(to_str(char_script_set(0x640)), "[Arab,Mand,Mani,Phlp,Syrc]");
+        TEST_EQUAL(to_str(char_script_set(0x964)), "[Beng,Deva,Gran,Gujr,Guru,Knda,Mahj,Mlym,Orya,Sind,"
+                                                   "Sinh,Sylo,Takr,Taml,Telu,Tirh]");
+        TRY(set = char_script_set(0x964));
+        TEST_EQUAL(set.size(), 16);
+        auto it = set.begin();
+        TEST_EQUAL(*it, Script::Beng);
+        TEST_EQUAL(std::distance(set.begin(), set.end()), 16);
+        TRY(set &= (ScriptSet{Script::Deva, Script::Latn, Script::Tirh}));
+        TEST_EQUAL(to_str(set), "[Deva,Tirh]");
+        TRY(set |= Script::Zzzz);
+        TEST_EQUAL(to_str(set), "[Zzzz,Deva,Tirh]");
+        TRY(set.erase(Script::Deva));
+        TEST_EQUAL(to_str(set), "[Zzzz,Tirh]");
+        TEST(set == (ScriptSet{Script::Tirh, Script::Zzzz}));
+        TEST(set != ScriptSet(Script::Tirh));
+        TEST_EQUAL(to_str(ScriptSet(Script::Zyyy) | ScriptSet(Script::Zinh)), "[Zinh,Zyyy]");
+        TEST((ScriptSet(Script::Zyyy) & ScriptSet(Script::Zinh)).empty());
+
+        size_t errors = 0;
+
+        for (char32_t c = 0; c <= 0x110100; ++c) {
+            if (char_script_id(c) != script_from_code(char_script(c)) && ++errors <= 10)
+                FAIL("char_script_id(U+" + hex(c) + ")");
+            ScriptSet expect;
+            for (auto& code: char_script_list(c))
+                expect.insert(script_from_code(code));
+            if (char_script_set(c) != expect && ++errors <= 10)
+                FAIL("char_script_set(U+" + hex(c) + ")");
+            if (block_name(char_block_id(c)) != char_block(c) && ++errors <= 10)
+                FAIL("char_block_id(U+" + hex(c) + ")");
+        }
+
+        TEST_EQUAL(errors, 0);
+
+    }
+
+    void check_packed_properties() {
+
+        size_t errors = 0;
+        char32_t buf[max_compatibility_decomposition];
+
+        auto changes = [&] (size_t (*f)(char32_t, char32_t*), char32_t c) {
+            auto n = f(c, buf);
+            return n != 1 || buf[0] != c;
+        };
+
+        for (char32_t c = 0; c <= 0x110100; ++c) {
+            auto& p = char_properties(c);
+            if (p.general_category != char_general_category(c)
+                    || p.combining_class != combining_class(c)
+                    || p.bidi_class != bidi_class(c)
+                    || p.east_asian_width != east_asian_width(c)
+                    || p.grapheme_cluster_break != grapheme_cluster_break(c)
+                    || p.line_break != line_break(c)
+                    || p.sentence_break != sentence_break(c)
+                    || p.word_break != word_break(c))
+                if (++errors <= 10)
+                    FAIL("Enumerated properties of U+" + hex(c));
+            if (p.has(CharProps::cased) != char_is_cased(c)
+                    || p.has(CharProps::case_ignorable) != char_is_case_ignorable(c)
+                    || p.has(CharProps::white_space) != char_is_white_space(c)
+                    || p.has(CharProps::decomposable) != (canonical_decomposition(c, buf) != 0)
+                    || p.has(CharProps::compat_decomposable) != (compatibility_decomposition(c, buf) != 0)
+                    || p.has(CharProps::uppercase_changes) != changes(char_to_full_uppercase, c)
+                    || p.has(CharProps::lowercase_changes) != changes(char_to_full_lowercase, c)
+                    || p.has(CharProps::titlecase_changes) != changes(char_to_full_titlecase, c)
+                    || p.has(CharProps::casefold_changes) != changes(char_to_full_casefold, c))
+                if (++errors <= 10)
+                    FAIL("Property flags of U+" + hex(c));
+        }
+
+        TEST_EQUAL(errors, 0);
+
+        auto& a = char_properties('A');
+        TEST_EQUAL(a.general_category, GC::Lu);
+        TEST_EQUAL(a.primary_category(), 'L');
+        TEST(a.has(CharProps::cased));
+        TEST(a.has(CharProps::lowercase_changes));
+        TEST(! a.has(CharProps::uppercase_changes));
+        TEST(! a.has(CharProps::decomposable));
+        TEST_EQUAL(a.word_break, Word_Break::ALetter);
+
+        auto& e = char_properties(0xe9);
+        TEST(e.has(CharProps::decomposable));
+        TEST(e.has(CharProps::compat_decomposable));
+        TEST(e.has(CharProps::uppercase_changes));
+
+        auto& fi = char_properties(0xfb01);
+        TEST(! fi.has(CharProps::decomposable));
+        TEST(fi.has(CharProps::compat_decomposable));
+        TEST(fi.has(CharProps::uppercase_changes));
+        TEST(! fi.has(CharProps::lowercase_changes));
+
+        auto& acute = char_properties(0x301);
+        TEST_EQUAL(acute.combining_class, 230);
+        TEST(acute.has(CharProps::case_ignorable));
+        TEST_EQUAL(acute.grapheme_cluster_break, Grapheme_Cluster_Break::Extend);
+
+        auto& ideo = char_properties(0x4e00);
+        TEST_EQUAL(ideo.east_asian_width, East_Asian_Width::W);
+        TEST_EQUAL(ideo.line_break, Line_Break::ID);
+
+    }
+
+    void check_bulk_classification() {
+
+        for (uint8_t i = 0; i < 30; ++i)
+            TEST_EQUAL(gc_index(gc_from_index(i)), i);
+        TEST_EQUAL(gc_from_index(0), GC::Cc);
+        TEST_EQUAL(gc_from_index(29), GC::Zs);
+        TEST_EQUAL(gc_from_index(30), GC::Cn);
+        TEST_EQUAL(gc_index(GC::Lu), 9);
+        TEST_EQUAL(gc_index(encode_gc("Xx")), gc_index(GC::Cn));
+
+        vector<uint8_t> out;
+        u8string s8 = "Ab 1\xce\xb1\xe2\x82\xac\xff\xf0\x9d\x84\x9e.";
+        u16string s16 = u"Ab 1\u03b1\u20ac\xd800\U0001d11e.";
+        u32string s32 = U"Ab 1\u03b1\u20ac\ufffd\U0001d11e.";
+        wstring sw = L"Ab 1\u03b1\u20ac\ufffd\U0001d11e.";
+        vector<uint8_t> expect;
+        for (auto c: s32)
+            expect.push_back(gc_index(char_general_category(c)));
+
+        TRY(classify(s8, PropertyKind::general_category, out));
+        TEST(out == expect);
+        TRY(classify(s16, PropertyKind::general_category, out));
+        TEST(out == expect);
+        TRY(classify(s32, PropertyKind::general_category, out));
+        TEST(out == expect);
+        TRY(classify(sw, PropertyKind::general_category, out));
+        TEST(out == expect);
+        TRY(classify(u8string(), PropertyKind::general_category, out));
+        TEST(out.empty());
+
+        TRY(classify(s8, PropertyKind::word_break, out));
+        TEST_EQUAL(out.size(), 9);
+        TEST_EQUAL(Word_Break(out[0]), Word_Break::ALetter);
+        TEST_EQUAL(Word_Break(out[2]), Word_Break::Other);
+        TEST_EQUAL(Word_Break(out[3]), Word_Break::Numeric);
+        TEST_EQUAL(Word_Break(out[8]), Word_Break::MidNumLet);
+        TRY(classify(s8, PropertyKind::script, out));
+        TEST_EQUAL(out.size(), 9);
+        TEST_EQUAL(Script(out[0]), Script::Latn);
+        TEST_EQUAL(Script(out[4]), Script::Grek);
+        TEST_EQUAL(Script(out[5]), Script::Zyyy);
+
+        u8string text;
+        for (int i = 0; i < 100; ++i)
+            text += "The quick brown fox \xce\xb1\xce\xb2\xce\xb3 ";
+        TRY(classify(text, PropertyKind::east_asian_width, out));
+        TEST_EQUAL(out.size(), 2400);
+        TEST_EQUAL(std::count(out.begin(), out.end(), uint8_t(East_Asian_Width::Na)), 2100);
+        TEST_EQUAL(std::count(out.begin(), out.end(), uint8_t(East_Asian_Width::A)), 300);
+
+        u32string all;
+        for (char32_t c = 0; c <= 0x10ffff; ++c)
+            if (char_is_unicode(c))
+                all += c;
+        auto gc = [] (char32_t c) { return gc_index(char_general_category(c)); };
+        size_t errors = 0;
+
+        #define COMPARE_CLASSIFY(kind, f) \
+            do { \
+                classify(all, PropertyKind::kind, out); \
+                if (out.size() != all.size()) \
+                    FAIL("classify(" # kind ") output size"); \
+                else \
+                    for (size_t i = 0; i < all.size(); ++i) \
+                        if (out[i] != uint8_t(f(all[i])) && ++errors <= 10) \
+                            FAIL("classify(" # kind ") of U+" + hex(all[i])); \
+            } while (false)
+
+        COMPARE_CLASSIFY(bidi_class, bidi_class);
+        COMPARE_CLASSIFY(combining_class, combining_class);
+        COMPARE_CLASSIFY(east_asian_width, east_asian_width);
+        COMPARE_CLASSIFY(general_category, gc);
+        COMPARE_CLASSIFY(grapheme_cluster_break, grapheme_cluster_break);
+        COMPARE_CLASSIFY(line_break, line_break);
+        COMPARE_CLASSIFY(script, char_script_id);
+        COMPARE_CLASSIFY(sentence_break, sentence_break);
+        COMPARE_CLASSIFY(word_break, word_break);
+
+        #undef COMPARE_CLASSIFY
+
+        TEST_EQUAL(errors, 0);
+
+    }
+
+    void check_character_sets() {
+
+        CharacterSet a, b, c;
+        vector<CharacterSet::range_type> r;
+
+        TEST(a.empty());
+        TEST(a.is_ascii());
+        TEST_EQUAL(a.size(), 0);
+        TEST(! a.contains(U'a'));
+
+        TRY(a = CharacterSet(u8"hello world"));
+        TEST(! a.empty());
+        TEST(a.is_ascii());
+        TEST_EQUAL(a.size(), 8);
+        TRY(r = a.ranges());
+        TEST_EQUAL(r.size(), 7);
+        TEST(a.contains(U' '));
+        TEST(a.contains(U'd'));
+        TEST(a.contains(U'e'));
+        TEST(! a.contains(U'f'));
+        TEST(a(U'w'));
+        TEST(! a(U'x'));
+
+        TRY(b = CharacterSet(U"αβγ€"));
+        TEST(! b.is_ascii());
+        TEST_EQUAL(b.size(), 4);
+        TRY(r = b.ranges());
+        TEST_EQUAL(r.size(), 2);
+        TEST_EQUAL(uint32_t(r[0].first), 0x3b1);
+        TEST_EQUAL(uint32_t(r[0].second), 0x3b3);
+        TEST(b.contains(U'β'));
+        TEST(! b.contains(U'δ'));
+        TEST(b == CharacterSet(u8"€γβα"));
+        TEST(b == CharacterSet(u"€γβα"));
+        TEST(b == CharacterSet(L"€γβα"));
+        TEST(b != a);
+
+        TRY(c = a | b);
+        TEST_EQUAL(c.size(), 12);
+        TEST(c.contains(U'h'));
+        TEST(c.contains(U'γ'));
+        TEST(! c.contains(U'x'));
+        TRY(c = a & b);
+        TEST(c.empty());
+        TRY(c = a & CharacterSet(U'a', U'k'));
+        TEST(c == CharacterSet(u8"dhe"));
+        TRY(c = a - CharacterSet(U'a', U'k'));
+        TEST(c == CharacterSet(u8" lorw"));
+        TRY(c = CharacterSet(U'0', U'9'));
+        TRY(c |= CharacterSet(U'a', U'f'));
+        TRY(c |= CharacterSet(U'A', U'F'));
+        TRY(c.insert(U'g'));
+        TEST_EQUAL(c.size(), 23);
+        TEST_EQUAL(c.ranges().size(), 3);
+        TRY(c.insert(U'8', U'A'));
+        TEST_EQUAL(c.ranges().size(), 2);
+
+        TRY(c = ~ a);
+        TEST_EQUAL(c.size(), 0x110000 - 8);
+        TEST(! c.is_ascii());
+        TEST(! c.contains(U'h'));
+        TEST(c.contains(U'x'));
+        TEST(c.contains(0x10ffff));
+        TEST(~ c == a);
+        TEST(~ CharacterSet() == CharacterSet(0, last_unicode_char));
+        TEST((~ CharacterSet()).contains(0));
+        TEST(~~ b == b);
+
+        TRY(c = CharacterSet(U'x', U'a'));
+        TEST(c.empty());
+        TRY(c = CharacterSet(0x10fff0, 0x7fffffff));
+        TEST_EQUAL(c.size(), 16);
+
+        TRY(c = CharacterSet(gc_predicate("Nd")));
+        TEST(c.contains(U'0'));
+        TEST(c.contains(0x660));
+        TEST(! c.contains(U'a'));
+        TEST(c == CharacterSet::from_predicate([] (char32_t u) { return char_general_category(u) == GC::Nd; }));
+        for (auto& p: {gc_predicate("Cn"), gc_predicate("L"), ~ gc_predicate("L"), gc_predicate("Cc,Cs,Co")})
+            TEST(CharacterSet(p) == CharacterSet::from_predicate(p));
+        TRY(c = CharacterSet::from_predicate(char_is_white_space));
+        TEST(c.contains(U' '));
+        TEST(c.contains(0x3000));
+        TEST(! c.contains(U'a'));
+
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> pick(0, 300);
+        for (int i = 0; i < 100; ++i) {
+            u32string chars;
+            for (int j = 0; j < 20; ++j)
+                chars += char32_t(pick(rng));
+            TRY(a = CharacterSet(chars));
+            for (char32_t u = 0; u <= 310; ++u)
+                TEST_EQUAL(a.contains(u), chars.find(u) != npos);
+        }
+
+    }
+
+    void check_trie_tables() {
+
+        using namespace UnicornDetail;
+
+        // The trie based lookups must agree with a search of the original
+        // tables for every code point, and beyond the Unicode range
+
+        size_t errors;
+
+        // Mismatches are counted, and only the first few are reported
+
+        #define COMPARE_TRIE(function, table) \
+            errors = 0; \
+            for (char32_t c = 0; c <= 0x110100; ++c) \
+                if (function(c) != sparse_table_lookup(table, c) && ++errors <= 10) \
+                    FAIL(# function "(U+" + hex(c) + ")"); \
+            TEST_EQUAL(errors, 0);
+
+        #define COMPARE_SET_TRIE(function, table) \
+            errors = 0; \
+            for (char32_t c = 0; c <= 0x110100; ++c) \
+                if (function(c) != sparse_set_lookup(table, c) && ++errors <= 10) \
+                    FAIL(# function "(U+" + hex(c) + ")"); \
+            TEST_EQUAL(errors, 0);
+
+        COMPARE_TRIE(char_general_category, general_category_table);
+        COMPARE_TRIE(combining_class, combining_class_table);
+        COMPARE_TRIE(east_asian_width, east_asian_width_table);
+        COMPARE_TRIE(grapheme_cluster_break, grapheme_cluster_break_table);
+        COMPARE_TRIE(hangul_syllable_type, hangul_syllable_type_table);
+        COMPARE_TRIE(indic_positional_category, indic_positional_category_table);
+        COMPARE_TRIE(indic_syllabic_category, indic_syllabic_category_table);
+        COMPARE_TRIE(joining_group, joining_group_table);
+        COMPARE_TRIE(line_break, line_break_table);
+        COMPARE_TRIE(numeric_type, numeric_type_table);
+        COMPARE_TRIE(sentence_break, sentence_break_table);
+        COMPARE_TRIE(word_break, word_break_table);
+        COMPARE_SET_TRIE(char_is_default_ignorable, default_ignorable_table);
+        COMPARE_SET_TRIE(char_is_soft_dotted, soft_dotted_table);
+        COMPARE_SET_TRIE(char_is_white_space, white_space_table);
+        COMPARE_SET_TRIE(char_is_id_start, id_start_table);
+        COMPARE_SET_TRIE(char_is_id_nonstart, id_nonstart_table);
+        COMPARE_SET_TRIE(char_is_xid_start, xid_start_table);
+        COMPARE_SET_TRIE(char_is_xid_nonstart, xid_nonstart_table);
+        COMPARE_SET_TRIE(char_is_pattern_syntax, pattern_syntax_table);
+        COMPARE_SET_TRIE(char_is_pattern_white_space, pattern_white_space_table);
+
+        errors = 0;
+        for (char32_t c = 0; c <= 0x110100; ++c) {
+            if (char_block(c) != cstr(sparse_table_lookup(blocks_table, c)) && ++errors <= 10)
+                FAIL("char_block(U+" + hex(c) + ")");
+            if (numeric_value(c).first != sparse_table_lookup(numeric_value_table, c).first && ++errors <= 10)
+                FAIL("numeric_value(U+" + hex(c) + ")");
+            if (char_is_bidi_mirrored(c) != std::binary_search(bidi_mirrored_table.begin(), bidi_mirrored_table.end(), c) && ++errors <= 10)
+                FAIL("char_is_bidi_mirrored(U+" + hex(c) + ")");
+            if (bidi_mirroring_glyph(c) != table_lookup(bidi_mirroring_glyph_table, c, char32_t(0)) && ++errors <= 10)
+                FAIL("bidi_mirroring_glyph(U+" + hex(c) + ")");
+            if (bidi_paired_bracket_type(c) != char(table_lookup(bidi_paired_bracket_type_table, c, char32_t('n'))) && ++errors <= 10)
+                FAIL("bidi_paired_bracket_type(U+" + hex(c) + ")");
+        }
+        TEST_EQUAL(errors, 0);
+
+        // The case mapping tries hold both the simple and full mappings
+
+        auto simple_upper = [] (char32_t c) { return table_lookup(simple_uppercase_table, c, c); };
+        auto simple_lower = [] (char32_t c) { return table_lookup(simple_lowercase_table, c, c); };
+        auto simple_title = [=] (char32_t c) {
+            auto t = table_lookup(simple_titlecase_table, c, not_found);
+            return t == not_found ? simple_upper(c) : t;
+        };
+        auto simple_fold = [=] (char32_t c) {
+            auto t = table_lookup(simple_casefold_table, c, not_found);
+            return t == not_found ? simple_lower(c) : t;
+        };
+
+        char32_t buf1[max_case_decomposition], buf2[max_case_decomposition];
+        size_t n1, n2;
+
+        #define COMPARE_FULL_CASE(function, table, simple) \
+            n1 = function(c, buf1); \
+            n2 = extended_table_lookup(c, buf2, table); \
+            if (n2 == 0) { \
+                buf2[0] = simple(c); \
+                n2 = 1; \
+            } \
+            if ((n1 != n2 || ! std::equal(buf1, buf1 + n1, buf2)) && ++errors <= 10) \
+                FAIL(# function "(U+" + hex(c) + ")");
+
+        #define COMPARE_SIMPLE_CASE(function, simple) \
+            if (function(c) != simple(c) && ++errors <= 10) \
+                FAIL(# function "(U+" + hex(c) + ")");
+
+        errors = 0;
+        for (char32_t c = 0; c <= 0x110100; ++c) {
+            COMPARE_SIMPLE_CASE(char_to_simple_uppercase, simple_upper);
+            COMPARE_SIMPLE_CASE(char_to_simple_lowercase, simple_lower);
+            COMPARE_SIMPLE_CASE(char_to_simple_titlecase, simple_title);
+            COMPARE_SIMPLE_CASE(char_to_simple_casefold, simple_fold);
+            COMPARE_FULL_CASE(char_to_full_uppercase, full_uppercase_table, simple_upper);
+            COMPARE_FULL_CASE(char_to_full_lowercase, full_lowercase_table, simple_lower);
+            COMPARE_FULL_CASE(char_to_full_titlecase, full_titlecase_table, simple_title);
+            COMPARE_FULL_CASE(char_to_full_casefold, full_casefold_table, simple_fold);
+        }
+        TEST_EQUAL(errors, 0);
+
+        // The generated tries are views of static arrays
+
+        TEST_EQUAL(general_category_trie[0x41], 0x4c75);
+        TEST_EQUAL(general_category_trie[0x110000], 0x436e);
+        TEST_EQUAL(general_category_trie[0xffffffff], 0x436e);
+        TEST_EQUAL(white_space_trie[0x20], true);
+        TEST_EQUAL(white_space_trie[0xffffffff], false);
+        TEST_EQUAL(bidi_paired_bracket_type_trie[0x28], 'o');
+        TEST_EQUAL(bidi_paired_bracket_type_trie[0xffffffff], 'n');
+        TEST_COMPARE(white_space_trie.bytes(), <, 2000);
+        TEST_COMPARE(general_category_trie.bytes(), <, 100000);
+
+    }
+
+    void check_latin1_tables() {
+
+        using namespace UnicornDetail;
+
+        // The Latin-1 fast path must agree with the full tables
+
+        size_t errors;
+
+        #define COMPARE_LATIN1(function, lookup) \
+            errors = 0; \
+            for (char32_t c = 0; c <= last_latin1_char; ++c) \
+                if (function(c) != lookup(c) && ++errors <= 10) \
+                    FAIL(# function "(U+" + hex(c) + ")"); \
+            TEST_EQUAL(errors, 0);
+
+        COMPARE_LATIN1(char_general_category, general_category_lookup);
+        COMPARE_LATIN1(char_is_white_space, white_space_lookup);
+        COMPARE_LATIN1(char_is_id_start, id_start_lookup);
+        COMPARE_LATIN1(char_is_id_nonstart, id_nonstart_lookup);
+        COMPARE_LATIN1(char_is_xid_start, xid_start_lookup);
+        COMPARE_LATIN1(char_is_xid_nonstart, xid_nonstart_lookup);
+        COMPARE_LATIN1(char_is_pattern_syntax, pattern_syntax_lookup);
+        COMPARE_LATIN1(char_is_pattern_white_space, pattern_white_space_lookup);
+        COMPARE_LATIN1(char_is_default_ignorable, default_ignorable_lookup);
+        COMPARE_LATIN1(char_is_soft_dotted, soft_dotted_lookup);
+        COMPARE_LATIN1(char_is_bidi_mirrored, bidi_mirrored_lookup);
+        COMPARE_LATIN1(char_is_uppercase, uppercase_lookup);
+        COMPARE_LATIN1(char_is_lowercase, lowercase_lookup);
+        COMPARE_LATIN1(char_is_cased, cased_lookup);
+        COMPARE_LATIN1(char_is_case_ignorable, case_ignorable_lookup);
+        COMPARE_LATIN1(char_to_simple_uppercase, simple_uppercase_lookup);
+        COMPARE_LATIN1(char_to_simple_lowercase, simple_lowercase_lookup);
+        COMPARE_LATIN1(char_to_simple_titlecase, simple_titlecase_lookup);
+        COMPARE_LATIN1(char_to_simple_casefold, simple_casefold_lookup);
+
+        TEST_EQUAL(char_to_simple_uppercase(0xb5), 0x39c);
+        TEST_EQUAL(char_to_simple_casefold(0xb5), 0x3bc);
+        TEST_EQUAL(char_to_simple_uppercase(0xff), 0x178);
+        TEST_EQUAL(char_to_simple_lowercase(0x100), 0x101);
+
     }
 
     void check_all_the_things() {
@@ -1756,6 +2409,11 @@ TEST_MODULE(unicorn, character) {
     check_enumeration_properties();
     check_numeric_properties();
     check_script_properties();
+    check_packed_properties();
+    check_bulk_classification();
+    check_character_sets();
+    check_trie_tables();
+    check_latin1_tables();
     check_all_the_things();
 
 }
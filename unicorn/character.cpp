@@ -1,40 +1,52 @@
 #include "unicorn/character.hpp"
 #include "unicorn/iso-script-names.hpp"
 #include "unicorn/ucd-tables.hpp"
+#include "unicorn/utf.hpp"
+#include <algorithm>
 #include <array>
+#include <bitset>
 #include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <type_traits>
 #include <unordered_map>
 #include <zlib.h>
 
+#if defined(__SSE2__)
+    #include <immintrin.h>
+#endif
+
 using namespace std::literals;
 
 namespace Unicorn {
 
     namespace {
 
-        static constexpr uint32_t sbase = 0xac00;
-        static constexpr uint32_t lbase = 0x1100;
-        static constexpr uint32_t vbase = 0x1161;
-        static constexpr uint32_t tbase = 0x11a7;
-        static constexpr uint32_t tcount = 28;
-        static constexpr uint32_t ncount = 588;
+        using UnicornDetail::hangul_sbase;
+        using UnicornDetail::hangul_lbase;
+        using UnicornDetail::hangul_vbase;
+        using UnicornDetail::hangul_tbase;
+        using UnicornDetail::hangul_lcount;
+        using UnicornDetail::hangul_vcount;
+        using UnicornDetail::hangul_tcount;
+        using UnicornDetail::hangul_ncount;
+        using UnicornDetail::hangul_scount;
 
         size_t hangul_decomposition(char32_t c, char32_t* dst) {
             auto type = hangul_syllable_type(c);
             if (type != Hangul_Syllable_Type::LV && type != Hangul_Syllable_Type::LVT)
                 return 0;
-            uint32_t sindex = c - sbase;
+            uint32_t sindex = c - hangul_sbase;
             if (type == Hangul_Syllable_Type::LV) {
-                uint32_t lindex = sindex / ncount;
-                uint32_t vindex = (sindex % ncount) / tcount;
-                dst[0] = lbase + lindex;
-                dst[1] = vbase + vindex;
+                uint32_t lindex = sindex / hangul_ncount;
+                uint32_t vindex = (sindex % hangul_ncount) / hangul_tcount;
+                dst[0] = hangul_lbase + lindex;
+                dst[1] = hangul_vbase + vindex;
             } else {
-                uint32_t lvindex = (sindex / tcount) * tcount;
-                uint32_t tindex = sindex % tcount;
-                dst[0] = sbase + lvindex;
-                dst[1] = tbase + tindex;
+                uint32_t lvindex = (sindex / hangul_tcount) * hangul_tcount;
+                uint32_t tindex = sindex % hangul_tcount;
+                dst[0] = hangul_sbase + lvindex;
+                dst[1] = hangul_tbase + tindex;
             }
             return 2;
         }
@@ -42,18 +54,18 @@ namespace Unicorn {
         char32_t hangul_composition(char32_t u1, char32_t u2) noexcept {
             auto type1 = hangul_syllable_type(u1), type2 = hangul_syllable_type(u2);
             if (type1 == Hangul_Syllable_Type::L && type2 == Hangul_Syllable_Type::V) {
-                uint32_t lindex = u1 - lbase;
-                uint32_t vindex = u2 - vbase;
-                uint32_t lvindex = lindex * ncount + vindex * tcount;
-                return sbase + lvindex;
+                uint32_t lindex = u1 - hangul_lbase;
+                uint32_t vindex = u2 - hangul_vbase;
+                uint32_t lvindex = lindex * hangul_ncount + vindex * hangul_tcount;
+                return hangul_sbase + lvindex;
             } else if (type1 == Hangul_Syllable_Type::LV && type2 == Hangul_Syllable_Type::T) {
                 char32_t lv[2];
                 hangul_decomposition(u1, lv);
-                uint32_t lindex = lv[0] - lbase;
-                uint32_t vindex = lv[1] - vbase;
-                uint32_t tindex = u2 - tbase;
-                uint32_t lvindex = lindex * ncount + vindex * tcount;
-                return sbase + lvindex + tindex;
+                uint32_t lindex = lv[0] - hangul_lbase;
+                uint32_t vindex = lv[1] - hangul_vbase;
+                uint32_t tindex = u2 - hangul_tbase;
+                uint32_t lvindex = lindex * hangul_ncount + vindex * hangul_tcount;
+                return hangul_sbase + lvindex + tindex;
             } else {
                 return 0;
             }
@@ -65,57 +77,60 @@ namespace Unicorn {
 
     namespace {
 
-        using CategoryTable = vector<std::pair<uint16_t, uint16_t>>;
+        constexpr uint16_t all_categories[] = {
+            GC::Cc, GC::Cf, GC::Cn, GC::Co, GC::Cs, GC::Ll, GC::Lm, GC::Lo, GC::Lt, GC::Lu,
+            GC::Mc, GC::Me, GC::Mn, GC::Nd, GC::Nl, GC::No, GC::Pc, GC::Pd, GC::Pe, GC::Pf,
+            GC::Pi, GC::Po, GC::Ps, GC::Sc, GC::Sk, GC::Sm, GC::So, GC::Zl, GC::Zp, GC::Zs,
+        };
 
-        std::function<bool(char32_t)> make_category_function(const CategoryTable& table) {
-            return [=] (char32_t c) {
-                auto cat = char_general_category(c);
-                for (auto& pair: table)
-                    if (cat >= pair.first && cat <= pair.second)
-                        return true;
-                return false;
-            };
-        }
+    }
 
-        CategoryTable make_category_table(const char* cat, size_t n) {
-            CategoryTable table;
-            static constexpr auto L0 = encode_gc('L', 0);
-            if (! cat)
-                return table;
-            int entries = 0;
-            uint16_t prefix = 0;
-            for (size_t i = 0; i < n; ++i) {
-                char c = cat[i];
-                if (ascii_isalpha(c)) {
-                    if (prefix == 0) {
-                        prefix = encode_gc(ascii_toupper(c), 0);
-                    } else if ((c == 'C' || c == 'c') && prefix == L0) {
-                        table.push_back({GC::Ll, GC::Ll});
-                        table.push_back({GC::Lt, GC::Lu});
-                        entries += 2;
-                    } else {
-                        uint16_t code = prefix + uint8_t(ascii_tolower(c));
-                        table.push_back({code, code});
-                        ++entries;
-                    }
-                } else if (c == '&') {
-                    if (prefix == L0) {
-                        table.push_back({GC::Ll, GC::Ll});
-                        table.push_back({GC::Lt, GC::Lu});
-                        entries += 2;
-                    }
+    CharPredicate CharPredicate::operator~() const noexcept {
+        CharPredicate p;
+        p.add(0, 0xffff);
+        p.mask &= ~ mask;
+        return p;
+    }
+
+    void CharPredicate::add(uint16_t first, uint16_t last) noexcept {
+        for (auto cat: all_categories)
+            if (cat >= first && cat <= last)
+                mask |= uint64_t(1) << UnicornDetail::gc_bit(cat);
+    }
+
+    void CharPredicate::parse(const char* cat, size_t n) noexcept {
+        static constexpr auto L0 = encode_gc('L', 0);
+        int entries = 0;
+        uint16_t prefix = 0;
+        for (size_t i = 0; i < n; ++i) {
+            char c = cat[i];
+            if (ascii_isalpha(c)) {
+                if (prefix == 0) {
+                    prefix = encode_gc(ascii_toupper(c), 0);
+                } else if ((c == 'C' || c == 'c') && prefix == L0) {
+                    add(GC::Ll, GC::Ll);
+                    add(GC::Lt, GC::Lu);
+                    entries += 2;
                 } else {
-                    if (entries == 0 && prefix != 0)
-                        table.push_back({prefix, prefix + 0xff});
-                    entries = 0;
-                    prefix = 0;
+                    uint16_t code = prefix + uint8_t(ascii_tolower(c));
+                    add(code, code);
+                    ++entries;
+                }
+            } else if (c == '&') {
+                if (prefix == L0) {
+                    add(GC::Ll, GC::Ll);
+                    add(GC::Lt, GC::Lu);
+                    entries += 2;
                 }
+            } else {
+                if (entries == 0 && prefix != 0)
+                    add(prefix, prefix + 0xff);
+                entries = 0;
+                prefix = 0;
             }
-            if (entries == 0 && prefix != 0)
-                table.push_back({prefix, prefix + 0xff});
-            return table;
         }
-
+        if (entries == 0 && prefix != 0)
+            add(prefix, prefix + 0xff);
     }
 
     const char* gc_name(uint16_t cat) noexcept {
@@ -154,81 +169,68 @@ namespace Unicorn {
         }
     }
 
-    uint16_t char_general_category(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::general_category_table, c);
+    uint16_t UnicornDetail::general_category_lookup(char32_t c) noexcept {
+        return UnicornDetail::general_category_trie[c];
+    }
+
+    // Boolean properties
+
+    bool UnicornDetail::default_ignorable_lookup(char32_t c) noexcept {
+        return UnicornDetail::default_ignorable_trie[c];
     }
 
-    std::function<bool(char32_t)> gc_predicate(uint16_t cat) {
-        CategoryTable table;
-        table.push_back({cat, cat});
-        return make_category_function(table);
+    bool UnicornDetail::soft_dotted_lookup(char32_t c) noexcept {
+        return UnicornDetail::soft_dotted_trie[c];
     }
 
-    std::function<bool(char32_t)> gc_predicate(const u8string& cat) {
-        auto table = make_category_table(cat.data(), cat.size());
-        return make_category_function(table);
+    bool UnicornDetail::white_space_lookup(char32_t c) noexcept {
+        return UnicornDetail::white_space_trie[c];
     }
 
-    std::function<bool(char32_t)> gc_predicate(const char* cat) {
-        auto table = make_category_table(cat, strlen(cat));
-        return make_category_function(table);
+    bool UnicornDetail::id_start_lookup(char32_t c) noexcept {
+        return UnicornDetail::id_start_trie[c];
     }
 
-    // Boolean properties
+    bool UnicornDetail::id_nonstart_lookup(char32_t c) noexcept {
+        return UnicornDetail::id_nonstart_trie[c];
+    }
+
+    bool UnicornDetail::xid_start_lookup(char32_t c) noexcept {
+        return UnicornDetail::xid_start_trie[c];
+    }
+
+    bool UnicornDetail::xid_nonstart_lookup(char32_t c) noexcept {
+        return UnicornDetail::xid_nonstart_trie[c];
+    }
+
+    bool UnicornDetail::pattern_syntax_lookup(char32_t c) noexcept {
+        return UnicornDetail::pattern_syntax_trie[c];
+    }
 
-    bool char_is_default_ignorable(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::default_ignorable_table, c); }
-    bool char_is_soft_dotted(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::soft_dotted_table, c); }
-    bool char_is_white_space(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::white_space_table, c); }
-    bool char_is_id_start(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::id_start_table, c); }
-    bool char_is_id_nonstart(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::id_nonstart_table, c); }
-    bool char_is_xid_start(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::xid_start_table, c); }
-    bool char_is_xid_nonstart(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::xid_nonstart_table, c); }
-    bool char_is_pattern_syntax(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::pattern_syntax_table, c); }
-    bool char_is_pattern_white_space(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::pattern_white_space_table, c); }
+    bool UnicornDetail::pattern_white_space_lookup(char32_t c) noexcept {
+        return UnicornDetail::pattern_white_space_trie[c];
+    }
 
     // Bidirectional properties
 
     Bidi_Class bidi_class(char32_t c) noexcept {
-        using namespace UnicornDetail;
-        auto rc = sparse_table_lookup(bidi_class_table, c);
-        if (rc != Bidi_Class::Default)
-            return rc;
-        else if ((c >= 0x600 && c <= 0x7bf)
-                || (c >= 0x8a0 && c <= 0x8ff)
-                || (c >= 0xfb50 && c <= 0xfdcf)
-                || (c >= 0xfdf0 && c <= 0xfdff)
-                || (c >= 0xfe70 && c <= 0xfeff)
-                || (c >= 0x1ee00 && c <= 0x1eeff))
-            return Bidi_Class::AL;
-        else if ((c >= 0x590 && c <= 0x5ff)
-                || (c >= 0x7c0 && c <= 0x89f)
-                || (c >= 0xfb1d && c <= 0xfb4f)
-                || (c >= 0x10800 && c <= 0x10fff)
-                || (c >= 0x1e800 && c <= 0x1edff)
-                || (c >= 0x1ef00 && c <= 0x1efff))
-            return Bidi_Class::R;
-        else if (c >= 0x20a0 && c <= 0x20cf)
-            return Bidi_Class::ET;
-        else if (char_is_default_ignorable(c) || char_is_noncharacter(c))
-            return Bidi_Class::BN;
-        else
-            return Bidi_Class::L;
+        return UnicornDetail::bidi_class_trie[c];
     }
 
-    bool char_is_bidi_mirrored(char32_t c) noexcept {
-        return std::binary_search(std::begin(UnicornDetail::bidi_mirrored_table), std::end(UnicornDetail::bidi_mirrored_table), c);
+    bool UnicornDetail::bidi_mirrored_lookup(char32_t c) noexcept {
+        return UnicornDetail::bidi_mirrored_trie[c];
     }
 
     char32_t bidi_mirroring_glyph(char32_t c) noexcept {
-        return table_lookup(UnicornDetail::bidi_mirroring_glyph_table, c, 0);
+        return UnicornDetail::bidi_mirroring_glyph_trie[c];
     }
 
     char32_t bidi_paired_bracket(char32_t c) noexcept {
-        return table_lookup(UnicornDetail::bidi_paired_bracket_table, c, 0);
+        return UnicornDetail::bidi_paired_bracket_trie[c];
     }
 
     char bidi_paired_bracket_type(char32_t c) noexcept {
-        return char(table_lookup(UnicornDetail::bidi_paired_bracket_type_table, c, 'n'));
+        return UnicornDetail::bidi_paired_bracket_type_trie[c];
     }
 
     // Block properties
@@ -251,7 +253,16 @@ namespace Unicorn {
     }
 
     u8string char_block(char32_t c) {
-        return cstr(sparse_table_lookup(UnicornDetail::blocks_table, c));
+        return cstr(UnicornDetail::blocks_table.begin()[UnicornDetail::blocks_trie[c]].value);
+    }
+
+    uint16_t char_block_id(char32_t c) noexcept {
+        return UnicornDetail::block_ids_trie[c];
+    }
+
+    u8string block_name(uint16_t id) {
+        auto& blocks = unicode_block_list();
+        return id > 0 && id <= blocks.size() ? blocks[id - 1].name : u8string();
     }
 
     const vector<BlockInfo>& unicode_block_list() {
@@ -261,66 +272,118 @@ namespace Unicorn {
 
     // Case folding properties
 
-    bool char_is_uppercase(char32_t c) noexcept {
-        return sparse_set_lookup(UnicornDetail::other_uppercase_table, c) || char_general_category(c) == GC::Lu;
+    bool UnicornDetail::uppercase_lookup(char32_t c) noexcept {
+        return UnicornDetail::uppercase_trie[c];
     }
 
-    bool char_is_lowercase(char32_t c) noexcept {
-        return sparse_set_lookup(UnicornDetail::other_lowercase_table, c) || char_general_category(c) == GC::Ll;
+    bool UnicornDetail::lowercase_lookup(char32_t c) noexcept {
+        return UnicornDetail::lowercase_trie[c];
     }
 
-    bool char_is_cased(char32_t c) noexcept {
-        if (sparse_set_lookup(UnicornDetail::other_uppercase_table, c)
-                || sparse_set_lookup(UnicornDetail::other_lowercase_table, c))
-            return true;
-        auto gc = char_general_category(c);
-        return gc == GC::Ll || gc == GC::Lt || gc == GC::Lu;
+    bool UnicornDetail::cased_lookup(char32_t c) noexcept {
+        return UnicornDetail::cased_trie[c];
     }
 
-    bool char_is_case_ignorable(char32_t c) noexcept {
-        auto wb = word_break(c);
-        if (wb == Word_Break::MidLetter
-                || wb == Word_Break::MidNumLet
-                || wb == Word_Break::Single_Quote)
-            return true;
-        auto gc = char_general_category(c);
-        return gc == GC::Cf || gc == GC::Lm || gc == GC::Me || gc == GC::Mn || gc == GC::Sk;
+    bool UnicornDetail::case_ignorable_lookup(char32_t c) noexcept {
+        return UnicornDetail::case_ignorable_trie[c];
     }
 
-    char32_t char_to_simple_uppercase(char32_t c) noexcept {
-        return table_lookup(UnicornDetail::simple_uppercase_table, c, c);
+    namespace {
+
+        // Each case mapping is held in a trie, generated by make-tables, that
+        // maps a code point to an integer in one lookup. The low three bits
+        // are flags; the rest is either the distance from the character to
+        // its mapping, which is then both the simple and the full mapping, or
+        // (if the exception flag is set) an index into a list of characters
+        // whose full mapping is not the same single character as their simple
+        // mapping. The cased and case ignorable properties ride along so that
+        // final sigma can be handled without a separate property lookup.
+
+        class CaseTable {
+        public:
+            static constexpr int32_t exception_flag = 1;
+            static constexpr int32_t cased_flag = 2;
+            static constexpr int32_t ignorable_flag = 4;
+            CaseTable(const UnicornDetail::CharacterTrie<int32_t>& mapping, const Irange<UnicornDetail::CaseException const*>& except) noexcept:
+                trie(mapping), exceptions(except.begin()) {}
+            int32_t operator[](char32_t c) const noexcept { return trie[c]; }
+            char32_t simple(char32_t c) const noexcept {
+                auto v = trie[c];
+                return v & exception_flag ? exceptions[payload(v)].simple : char32_t(int32_t(c) + payload(v));
+            }
+            size_t full(char32_t c, char32_t* dst) const noexcept { return expand(c, trie[c], dst); }
+            size_t expand(char32_t c, int32_t v, char32_t* dst) const noexcept {
+                if (! (v & exception_flag)) {
+                    *dst = char32_t(int32_t(c) + payload(v));
+                    return 1;
+                }
+                auto& x = exceptions[payload(v)];
+                std::copy_n(x.full.begin(), x.length, dst);
+                return x.length;
+            }
+            static bool unchanged(int32_t v) noexcept { return (v & ~ (cased_flag | ignorable_flag)) == 0; }
+        private:
+            const UnicornDetail::CharacterTrie<int32_t>& trie;
+            const UnicornDetail::CaseException* exceptions;
+            static int32_t payload(int32_t v) noexcept { return (v - (v & 7)) / 8; }
+        };
+
+        constexpr int32_t CaseTable::exception_flag;
+        constexpr int32_t CaseTable::cased_flag;
+        constexpr int32_t CaseTable::ignorable_flag;
+
+        const CaseTable& uppercase_table() {
+            static const CaseTable table(UnicornDetail::uppercase_mapping_trie, UnicornDetail::uppercase_exceptions_table);
+            return table;
+        }
+
+        const CaseTable& lowercase_table() {
+            static const CaseTable table(UnicornDetail::lowercase_mapping_trie, UnicornDetail::lowercase_exceptions_table);
+            return table;
+        }
+
+        const CaseTable& titlecase_table() {
+            static const CaseTable table(UnicornDetail::titlecase_mapping_trie, UnicornDetail::titlecase_exceptions_table);
+            return table;
+        }
+
+        const CaseTable& casefold_table() {
+            static const CaseTable table(UnicornDetail::casefold_mapping_trie, UnicornDetail::casefold_exceptions_table);
+            return table;
+        }
+
     }
 
-    char32_t char_to_simple_lowercase(char32_t c) noexcept {
-        return table_lookup(UnicornDetail::simple_lowercase_table, c, c);
+    char32_t UnicornDetail::simple_uppercase_lookup(char32_t c) noexcept {
+        return uppercase_table().simple(c);
     }
 
-    char32_t char_to_simple_titlecase(char32_t c) noexcept {
-        using namespace UnicornDetail;
-        auto t = table_lookup(simple_titlecase_table, c, not_found);
-        return t == not_found ? char_to_simple_uppercase(c) : t;
+    char32_t UnicornDetail::simple_lowercase_lookup(char32_t c) noexcept {
+        return lowercase_table().simple(c);
     }
 
-    char32_t char_to_simple_casefold(char32_t c) noexcept {
-        using namespace UnicornDetail;
-        auto t = table_lookup(simple_casefold_table, c, not_found);
-        return t == not_found ? char_to_simple_lowercase(c) : t;
+    char32_t UnicornDetail::simple_titlecase_lookup(char32_t c) noexcept {
+        return titlecase_table().simple(c);
+    }
+
+    char32_t UnicornDetail::simple_casefold_lookup(char32_t c) noexcept {
+        return casefold_table().simple(c);
     }
 
     size_t char_to_full_uppercase(char32_t c, char32_t* dst) noexcept {
-        return extended_table_lookup(c, dst, UnicornDetail::full_uppercase_table, char_to_simple_uppercase);
+        return uppercase_table().full(c, dst);
     }
 
     size_t char_to_full_lowercase(char32_t c, char32_t* dst) noexcept {
-        return extended_table_lookup(c, dst, UnicornDetail::full_lowercase_table, char_to_simple_lowercase);
+        return lowercase_table().full(c, dst);
     }
 
     size_t char_to_full_titlecase(char32_t c, char32_t* dst) noexcept {
-        return extended_table_lookup(c, dst, UnicornDetail::full_titlecase_table, char_to_simple_titlecase);
+        return titlecase_table().full(c, dst);
     }
 
     size_t char_to_full_casefold(char32_t c, char32_t* dst) noexcept {
-        return extended_table_lookup(c, dst, UnicornDetail::full_casefold_table, char_to_simple_casefold);
+        return casefold_table().full(c, dst);
     }
 
     // Character names
@@ -346,39 +409,88 @@ namespace Unicorn {
             }
         };
 
-        class CharacterNameMap {
+        // The main name table is split into blocks that are decompressed on
+        // demand; each thread keeps its most recently used blocks.
+
+        class CharacterNameCache {
         public:
-            CharacterNameMap();
-            const u8string& operator[](char32_t c) const;
+            u8string operator()(char32_t c);
         private:
-            std::unordered_map<char32_t, u8string> map;
+            static constexpr size_t slots = 16;
+            struct block_type {
+                size_t index = npos;
+                size_t used = 0;
+                u8string text;
+                vector<uint16_t> starts;
+            };
+            std::array<block_type, slots> cache;
+            size_t clock = 0;
+            block_type* recent = nullptr;
+            const UnicornDetail::KeyValue<char32_t, uint32_t>* run = nullptr;
+            const block_type& load(size_t index);
         };
 
-        CharacterNameMap::CharacterNameMap() {
+        u8string CharacterNameCache::operator()(char32_t c) {
             using namespace UnicornDetail;
-            u8string names_list(main_names_expanded, 0);
-            auto src = reinterpret_cast<const uint8_t*>(main_names_data);
-            auto dst = reinterpret_cast<uint8_t*>(&names_list[0]);
-            unsigned long dstlen = main_names_expanded;
-            auto rc = uncompress(dst, &dstlen, src, main_names_compressed);
+            auto& table = main_names_index_table;
+            if (! run || c < run[0].key || c >= run[1].key) {
+                KeyValue<char32_t, uint32_t> key;
+                key.key = c;
+                auto it = std::upper_bound(table.begin(), table.end(), key);
+                if (it == table.begin() || it == table.end())
+                    return {};
+                run = it - 1;
+            }
+            size_t ordinal = run[0].value + (c - run[0].key);
+            if (ordinal >= run[1].value)
+                return {};
+            auto& block = load(ordinal / main_names_per_block);
+            size_t i = ordinal % main_names_per_block;
+            return block.text.substr(block.starts[i], block.starts[i + 1] - block.starts[i] - 1);
+        }
+
+        void expand_name_block(size_t index, u8string& text) {
+            using namespace UnicornDetail;
+            auto offsets = main_names_offsets_table.begin();
+            auto src = reinterpret_cast<const uint8_t*>(main_names_data) + offsets[index];
+            text.resize(main_names_max_block);
+            auto dst = reinterpret_cast<uint8_t*>(&text[0]);
+            unsigned long dstlen = text.size();
+            auto rc = uncompress(dst, &dstlen, src, offsets[index + 1] - offsets[index]);
             if (rc != Z_OK)
                 throw ZlibError(rc);
-            size_t i = 0;
-            while (i < main_names_expanded) {
-                auto j = names_list.find(';', i);
-                auto k = names_list.find(';', j + 1);
-                if (j == npos || k == npos)
-                    break;
-                auto c = char32_t(strtoul(names_list.data() + i, nullptr, 16));
-                map[c] = names_list.substr(j + 1, k - j - 1);
-                i = k + 1;
+            text.resize(dstlen);
+        }
+
+        const CharacterNameCache::block_type& CharacterNameCache::load(size_t index) {
+            if (recent && recent->index == index)
+                return *recent;
+            auto* oldest = &cache[0];
+            for (auto& block: cache) {
+                if (block.index == index) {
+                    block.used = ++clock;
+                    recent = &block;
+                    return block;
+                }
+                if (block.used < oldest->used)
+                    oldest = &block;
             }
+            auto& block = *oldest;
+            block.index = npos;
+            block.used = ++clock;
+            expand_name_block(index, block.text);
+            block.starts.assign(1, 0);
+            for (size_t i = 0; i < block.text.size(); ++i)
+                if (block.text[i] == ';')
+                    block.starts.push_back(uint16_t(i + 1));
+            block.index = index;
+            recent = &block;
+            return block;
         }
 
-        const u8string& CharacterNameMap::operator[](char32_t c) const {
-            static const u8string dummy;
-            auto i = map.find(c);
-            return i == map.end() ? dummy : i->second;
+        u8string main_name(char32_t c) {
+            static thread_local CharacterNameCache cache;
+            return cache(c);
         }
 
         bool is_unified_ideograph(char32_t c) noexcept {
@@ -390,35 +502,71 @@ namespace Unicorn {
             return (c >= 0xf900 && c <= 0xfaff) || (c >= 0x2f800 && c <= 0x2fa1f);
         }
 
+        // Based on code in section 3.12 of the Unicode Standard
+
+        constexpr const char* jamo_l_table[] {
+            "G", "GG", "N", "D", "DD", "R", "M", "B", "BB",
+            "S", "SS", "", "J", "JJ", "C", "K", "T", "P", "H"
+        };
+
+        constexpr const char* jamo_v_table[] {
+            "A", "AE", "YA", "YAE", "EO", "E", "YEO", "YE", "O",
+            "WA", "WAE", "OE", "YO", "U", "WEO", "WE", "WI",
+            "YU", "EU", "YI", "I"
+        };
+
+        constexpr const char* jamo_t_table[] {
+            "", "G", "GG", "GS", "N", "NJ", "NH", "D", "L", "LG", "LM",
+            "LB", "LS", "LT", "LP", "LH", "M", "B", "BS",
+            "S", "SS", "NG", "J", "C", "K", "T", "P", "H"
+        };
+
         u8string hangul_name(char32_t c) {
-            // Based on code in section 3.12 of the Unicode Standard
-            static constexpr uint32_t s_base = 0xac00,
-                l_count = 19, v_count = 21, t_count = 28,
-                n_count = v_count * t_count, s_count = l_count * n_count;
-            static constexpr const char* jamo_l_table[] {
-                "G", "GG", "N", "D", "DD", "R", "M", "B", "BB",
-                "S", "SS", "", "J", "JJ", "C", "K", "T", "P", "H"
-            };
-            static constexpr const char* jamo_v_table[] {
-                "A", "AE", "YA", "YAE", "EO", "E", "YEO", "YE", "O",
-                "WA", "WAE", "OE", "YO", "U", "WEO", "WE", "WI",
-                "YU", "EU", "YI", "I"
-            };
-            static constexpr const char* jamo_t_table[] {
-                "", "G", "GG", "GS", "N", "NJ", "NH", "D", "L", "LG", "LM",
-                "LB", "LS", "LT", "LP", "LH", "M", "B", "BS",
-                "S", "SS", "NG", "J", "C", "K", "T", "P", "H"
-            };
-            if (c < s_base || c - s_base >= s_count)
+            if (c < hangul_sbase || c - hangul_sbase >= hangul_scount)
                 return {};
-            auto s_index = c - s_base;
-            auto l_index = s_index / n_count;
-            auto v_index = (s_index % n_count) / t_count;
-            auto t_index = s_index % t_count;
+            auto s_index = c - hangul_sbase;
+            auto l_index = s_index / hangul_ncount;
+            auto v_index = (s_index % hangul_ncount) / hangul_tcount;
+            auto t_index = s_index % hangul_tcount;
             return "HANGUL SYLLABLE "s + jamo_l_table[l_index]
                 + jamo_v_table[v_index] + jamo_t_table[t_index];
         }
 
+        // Inverse of hangul_name(), given the part of the name after the
+        // prefix; returns zero if the jamo do not spell a syllable. The
+        // leading and trailing jamo are spelled only with consonants, and the
+        // vowel jamo only with A, E, I, O, U, W, and Y, so the name splits
+        // unambiguously around the run of vowel letters, and each part is
+        // looked up in its own short table.
+
+        bool is_jamo_vowel(char c) noexcept {
+            return c == 'A' || c == 'E' || c == 'I' || c == 'O' || c == 'U' || c == 'W' || c == 'Y';
+        }
+
+        template <size_t N>
+        uint32_t jamo_index(const char* const (&table)[N], const char* begin, const char* end) noexcept {
+            size_t n = end - begin;
+            for (uint32_t i = 0; i < N; ++i)
+                if (std::strlen(table[i]) == n && std::memcmp(table[i], begin, n) == 0)
+                    return i;
+            return N;
+        }
+
+        char32_t hangul_from_jamo(const char* jamo) {
+            auto v = jamo;
+            while (*v && ! is_jamo_vowel(*v))
+                ++v;
+            auto t = v;
+            while (is_jamo_vowel(*t))
+                ++t;
+            auto l_index = jamo_index(jamo_l_table, jamo, v);
+            auto v_index = jamo_index(jamo_v_table, v, t);
+            auto t_index = jamo_index(jamo_t_table, t, t + std::strlen(t));
+            if (l_index == hangul_lcount || v_index == hangul_vcount || t_index == hangul_tcount)
+                return 0;
+            return hangul_sbase + (l_index * hangul_vcount + v_index) * hangul_tcount + t_index;
+        }
+
         const char* control_character_name(char32_t c) {
             switch (c) {
                 case 0x00: return "NULL";
@@ -490,11 +638,66 @@ namespace Unicorn {
             }
         }
 
+        // Reduce a name to the form used for comparison: unchanged for exact
+        // matching, upper case for cn_lower, and the UAX44-LM2 loose form
+        // (ignoring case, whitespace, underscores, and medial hyphens, except
+        // the one in U+1180 HANGUL JUNGSEONG O-E) for cn_loose.
+
+        u8string name_key(const u8string& name, uint32_t flags) {
+            if (flags & cn_loose) {
+                u8string key;
+                bool hyphen = false;
+                for (size_t i = 0; i < name.size(); ++i) {
+                    char c = name[i];
+                    if (c == '-' && i > 0 && i + 1 < name.size() && ascii_isalnum(name[i - 1]) && ascii_isalnum(name[i + 1]))
+                        hyphen = true;
+                    else if (c != '_' && ! ascii_isspace(c))
+                        key += ascii_toupper(c);
+                }
+                if (hyphen && key == "HANGULJUNGSEONGOE")
+                    key = "HANGULJUNGSEONGO-E";
+                return key;
+            } else if (flags & cn_lower) {
+                return ascii_uppercase(name);
+            } else {
+                return name;
+            }
+        }
+
+        // Looks up the loose form of a name in the perfect hash of the main
+        // table, returning the only character that could have that name (its
+        // actual name still needs to be checked), or not_a_char.
+
+        char32_t main_name_candidate(const u8string& loose) noexcept {
+            using namespace UnicornDetail;
+            auto seeds = main_names_seed_table.begin();
+            auto slots = main_names_hash_table.begin();
+            uint32_t seed = seeds[character_name_hash(loose, 0) & (range_count(main_names_seed_table) - 1)];
+            uint16_t ordinal = slots[character_name_hash(loose, seed) & (range_count(main_names_hash_table) - 1)];
+            if (ordinal == 0xffff)
+                return not_a_char;
+            auto run = std::upper_bound(main_names_index_table.begin(), main_names_index_table.end(), ordinal,
+                [] (uint32_t n, const KeyValue<char32_t, uint32_t>& kv) { return n < kv.value; }) - 1;
+            return char32_t(run->key + (ordinal - run->value));
+        }
+
+        bool parse_hex_suffix(const u8string& str, size_t pos, char32_t& c) {
+            if (pos >= str.size() || str.size() - pos > 8)
+                return false;
+            uint32_t n = 0;
+            for (size_t i = pos; i < str.size(); ++i) {
+                if (! ascii_isxdigit(str[i]))
+                    return false;
+                n = 16 * n + (ascii_isdigit(str[i]) ? str[i] - '0' : ascii_toupper(str[i]) - 'A' + 10);
+            }
+            c = n;
+            return true;
+        }
+
     }
 
     u8string char_name(char32_t c, uint32_t flags) {
         using namespace UnicornDetail;
-        static const CharacterNameMap map;
         u8string name;
         if (flags & cn_control) {
             auto name_ptr = control_character_name(c);
@@ -507,7 +710,7 @@ namespace Unicorn {
                 name = name_ptr;
         }
         if (name.empty())
-            name = map[c];
+            name = main_name(c);
         if (name.empty()) {
             if (is_unified_ideograph(c))
                 name = "CJK UNIFIED IDEOGRAPH-" + ascii_uppercase(hex(c, 4));
@@ -550,18 +753,71 @@ namespace Unicorn {
         return name;
     }
 
+    char32_t char_from_name(const u8string& name, uint32_t flags) {
+        using namespace UnicornDetail;
+        if (name.empty())
+            return not_a_char;
+        if ((flags & cn_prefix) && name.size() > 2 && (name[0] == 'U' || name[0] == 'u') && name[1] == '+') {
+            size_t end = name.find(' ', 2);
+            char32_t c = 0;
+            if (! parse_hex_suffix(name.substr(0, end), 2, c) || c > last_unicode_char)
+                return not_a_char;
+            if (end == npos)
+                return c;
+            return char_from_name(name.substr(end + 1), flags & ~ cn_prefix) == c ? c : not_a_char;
+        }
+        auto key = name_key(name, flags);
+        auto match = [&] (const u8string& actual) {
+            return flags & (cn_loose | cn_lower) ? name_key(actual, flags) == key : actual == name;
+        };
+        if (flags & cn_control)
+            for (char32_t c = 0; c <= 0x9f; ++c)
+                if (auto ptr = control_character_name(c))
+                    if (match(ptr))
+                        return c;
+        if (flags & cn_update)
+            for (auto& kv: corrected_names_table)
+                if (match(kv.value))
+                    return kv.key;
+        auto loose = name_key(name, cn_loose);
+        char32_t c = main_name_candidate(loose);
+        if (c != not_a_char && match(main_name(c)))
+            return c;
+        static const u8string cjk_unified = "CJKUNIFIEDIDEOGRAPH", cjk_compatibility = "CJKCOMPATIBILITYIDEOGRAPH",
+            hangul_syllable = "HANGULSYLLABLE";
+        c = 0;
+        if (loose.compare(0, cjk_unified.size(), cjk_unified) == 0)
+            parse_hex_suffix(loose, cjk_unified.size(), c);
+        else if (loose.compare(0, cjk_compatibility.size(), cjk_compatibility) == 0)
+            parse_hex_suffix(loose, cjk_compatibility.size(), c);
+        else if (loose.compare(0, hangul_syllable.size(), hangul_syllable) == 0)
+            c = hangul_from_jamo(loose.data() + hangul_syllable.size());
+        if (c && match(char_name(c)))
+            return c;
+        if ((flags & cn_label) && name.back() == '>') {
+            auto pos = name.rfind('-');
+            if (pos != npos && parse_hex_suffix(name.substr(0, name.size() - 1), pos + 1, c) && c <= last_unicode_char
+                    && char_name(c).empty() && match(char_name(c, cn_label)))
+                return c;
+        }
+        return not_a_char;
+    }
+
     // Decomposition properties
 
     int combining_class(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::combining_class_table, c);
+        return UnicornDetail::combining_class_trie[c];
     }
 
     char32_t canonical_composition(char32_t u1, char32_t u2) noexcept {
         using namespace UnicornDetail;
         char32_t c(hangul_composition(u1, u2));
         if (! c) {
-            std::array<char32_t, 2> key{{u1, u2}};
-            c = table_lookup(composition_table, key, char32_t(0));
+            size_t buckets = range_count(composition_seed_table), slots = range_count(composition_hash_table);
+            auto seed = composition_seed_table.begin()[composition_hash(u1, u2, 0) & (buckets - 1)];
+            auto& slot = composition_hash_table.begin()[composition_hash(u1, u2, seed) & (slots - 1)];
+            if (slot.key[0] == u1 && slot.key[1] == u2)
+                c = slot.value;
         }
         return c;
     }
@@ -587,54 +843,47 @@ namespace Unicorn {
     // Enumeration properties
 
     East_Asian_Width east_asian_width(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::east_asian_width_table, c);
+        return UnicornDetail::east_asian_width_trie[c];
     }
 
     Grapheme_Cluster_Break grapheme_cluster_break(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::grapheme_cluster_break_table, c);
+        return UnicornDetail::grapheme_cluster_break_trie[c];
     }
 
     Hangul_Syllable_Type hangul_syllable_type(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::hangul_syllable_type_table, c);
+        return UnicornDetail::hangul_syllable_type_trie[c];
     }
 
     Indic_Positional_Category indic_positional_category(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::indic_positional_category_table, c);
+        return UnicornDetail::indic_positional_category_trie[c];
     }
 
     Indic_Syllabic_Category indic_syllabic_category(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::indic_syllabic_category_table, c);
+        return UnicornDetail::indic_syllabic_category_trie[c];
     }
 
     Joining_Group joining_group(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::joining_group_table, c);
+        return UnicornDetail::joining_group_trie[c];
     }
 
     Joining_Type joining_type(char32_t c) noexcept {
-        auto rc = sparse_table_lookup(UnicornDetail::joining_type_table, c);
-        if (rc != Joining_Type::Default)
-            return rc;
-        auto gc = char_general_category(c);
-        if (gc == GC::Cf || gc == GC::Me || gc == GC::Mn)
-            return Joining_Type::Transparent;
-        else
-            return Joining_Type::Non_Joining;
+        return UnicornDetail::joining_type_trie[c];
     }
 
     Line_Break line_break(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::line_break_table, c);
+        return UnicornDetail::line_break_trie[c];
     }
 
     Numeric_Type numeric_type(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::numeric_type_table, c);
+        return UnicornDetail::numeric_type_trie[c];
     }
 
     Sentence_Break sentence_break(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::sentence_break_table, c);
+        return UnicornDetail::sentence_break_trie[c];
     }
 
     Word_Break word_break(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::word_break_table, c);
+        return UnicornDetail::word_break_trie[c];
     }
 
     #define PROPHEAD using T = decltype(x); switch (x) {
@@ -975,7 +1224,7 @@ namespace Unicorn {
     // Numeric properties
 
     std::pair<long long, long long> numeric_value(char32_t c) {
-        const auto pair = sparse_table_lookup(UnicornDetail::numeric_value_table, c);
+        const auto pair = UnicornDetail::numeric_value_table.begin()[UnicornDetail::numeric_value_trie[c]].value;
         return {pair.first, pair.second};
     }
 
@@ -999,6 +1248,31 @@ namespace Unicorn {
             return code;
         }
 
+        // ISO 15924 variant codes that the script table uses in place of the
+        // Unicode property value aliases (these must match script_variants in
+        // make-tables)
+
+        constexpr std::pair<const char*, Script> script_variants[] = {
+            {"Aran", Script::Arab},
+            {"Cyrs", Script::Cyrl},
+            {"Hant", Script::Hani},
+            {"Syrn", Script::Syrc},
+        };
+
+        Script find_script(const char* abbr, size_t n) noexcept {
+            if (n != 4)
+                return Script::Zzzz;
+            char code[5] = {ascii_toupper(abbr[0]), ascii_tolower(abbr[1]), ascii_tolower(abbr[2]), ascii_tolower(abbr[3]), 0};
+            auto& codes = UnicornDetail::script_codes_table;
+            auto it = std::lower_bound(codes.begin() + 1, codes.end(), code, [] (const char* a, const char* b) { return std::strcmp(a, b) < 0; });
+            if (it != codes.end() && std::strcmp(*it, code) == 0)
+                return Script(it - codes.begin());
+            for (auto& v: script_variants)
+                if (std::strcmp(v.first, code) == 0)
+                    return v.second;
+            return Script::Zzzz;
+        }
+
         class ScriptNameMap {
         public:
             ScriptNameMap();
@@ -1048,12 +1322,12 @@ namespace Unicorn {
     }
 
     u8string char_script(char32_t c) {
-        return decode_script(sparse_table_lookup(UnicornDetail::scripts_table, c));
+        return decode_script(UnicornDetail::scripts_trie[c]);
     }
 
     vector<u8string> char_script_list(char32_t c) {
         static const ScriptExtensionMap map;
-        auto cp = sparse_table_lookup(UnicornDetail::script_extensions_table, c);
+        auto cp = UnicornDetail::script_extensions_table.begin()[UnicornDetail::script_extensions_trie[c]].value;
         if (cp)
             return map[cp];
         else
@@ -1065,4 +1339,677 @@ namespace Unicorn {
         return map[abbr];
     }
 
+    bool ScriptSet::empty() const noexcept {
+        return std::all_of(bits.begin(), bits.end(), [] (uint64_t w) { return w == 0; });
+    }
+
+    size_t ScriptSet::size() const noexcept {
+        size_t n = 0;
+        for (auto w: bits)
+            n += std::bitset<64>(w).count();
+        return n;
+    }
+
+    Script ScriptSet::next(size_t i) const noexcept {
+        for (; i < script_count; ++i)
+            if (contains(Script(i)))
+                return Script(i);
+        return end_marker;
+    }
+
+    std::ostream& operator<<(std::ostream& o, Script x) {
+        return o << script_code(x);
+    }
+
+    std::ostream& operator<<(std::ostream& o, const ScriptSet& x) {
+        o << '[';
+        bool first = true;
+        for (auto s: x) {
+            if (! first)
+                o << ',';
+            o << script_code(s);
+            first = false;
+        }
+        return o << ']';
+    }
+
+    Script char_script_id(char32_t c) noexcept {
+        return UnicornDetail::script_ids_trie[c];
+    }
+
+    ScriptSet char_script_set(char32_t c) noexcept {
+        using namespace UnicornDetail;
+        ScriptSet set;
+        set.bits = script_sets_table.begin()[script_sets_trie[c]];
+        return set;
+    }
+
+    const char* script_code(Script s) noexcept {
+        return size_t(s) < script_count ? UnicornDetail::script_codes_table.begin()[size_t(s)] : "";
+    }
+
+    Script script_from_code(const u8string& abbr) noexcept {
+        return find_script(abbr.data(), abbr.size());
+    }
+
+    u8string script_name(Script s) {
+        return script_name(script_code(s));
+    }
+
+    // Packed properties
+
+    constexpr uint16_t CharProps::cased;
+    constexpr uint16_t CharProps::case_ignorable;
+    constexpr uint16_t CharProps::white_space;
+    constexpr uint16_t CharProps::decomposable;
+    constexpr uint16_t CharProps::compat_decomposable;
+    constexpr uint16_t CharProps::uppercase_changes;
+    constexpr uint16_t CharProps::lowercase_changes;
+    constexpr uint16_t CharProps::titlecase_changes;
+    constexpr uint16_t CharProps::casefold_changes;
+
+    const CharProps& char_properties(char32_t c) noexcept {
+        return UnicornDetail::property_records_table.begin()[UnicornDetail::property_records_trie[c]];
+    }
+
+    // Bulk classification
+
+    namespace {
+
+        struct GcIndexTable {
+            uint8_t index[64];
+        };
+
+        constexpr GcIndexTable make_gc_index_table() noexcept {
+            GcIndexTable t = {};
+            for (uint8_t i = 0; i < std::extent<decltype(all_categories)>::value; ++i)
+                t.index[UnicornDetail::gc_bit(all_categories[i])] = i;
+            return t;
+        }
+
+        constexpr GcIndexTable gc_index_table = make_gc_index_table();
+
+        template <PropertyKind K> uint8_t property_value(char32_t c) noexcept;
+
+        template <> uint8_t property_value<PropertyKind::bidi_class>(char32_t c) noexcept
+            { return uint8_t(char_properties(c).bidi_class); }
+        template <> uint8_t property_value<PropertyKind::combining_class>(char32_t c) noexcept
+            { return char_properties(c).combining_class; }
+        template <> uint8_t property_value<PropertyKind::east_asian_width>(char32_t c) noexcept
+            { return uint8_t(char_properties(c).east_asian_width); }
+        template <> uint8_t property_value<PropertyKind::general_category>(char32_t c) noexcept
+            { return gc_index_table.index[UnicornDetail::gc_bit(char_properties(c).general_category)]; }
+        template <> uint8_t property_value<PropertyKind::grapheme_cluster_break>(char32_t c) noexcept
+            { return uint8_t(char_properties(c).grapheme_cluster_break); }
+        template <> uint8_t property_value<PropertyKind::line_break>(char32_t c) noexcept
+            { return uint8_t(char_properties(c).line_break); }
+        template <> uint8_t property_value<PropertyKind::script>(char32_t c) noexcept
+            { return uint8_t(char_script_id(c)); }
+        template <> uint8_t property_value<PropertyKind::sentence_break>(char32_t c) noexcept
+            { return uint8_t(char_properties(c).sentence_break); }
+        template <> uint8_t property_value<PropertyKind::word_break>(char32_t c) noexcept
+            { return uint8_t(char_properties(c).word_break); }
+
+        // ASCII characters are classified through a small table; in UTF-8,
+        // whole runs of them are found with the SIMD ASCII span kernel.
+
+        template <PropertyKind K>
+        const std::array<uint8_t, 128>& ascii_property_table() noexcept {
+            static const auto table = [] {
+                std::array<uint8_t, 128> t;
+                for (char32_t c = 0; c < 128; ++c)
+                    t[c] = property_value<K>(c);
+                return t;
+            }();
+            return table;
+        }
+
+        template <PropertyKind K, typename C>
+        size_t classify_kind(const C* src, size_t n, bool check, uint8_t* dst, size_t& count) noexcept {
+            using namespace UnicornDetail;
+            auto& ascii = ascii_property_table<K>();
+            size_t pos = 0, k = 0;
+            while (pos < n && k < count) {
+                auto unit = std::make_unsigned_t<C>(src[pos]);
+                if (unit < 0x80) {
+                    if (sizeof(C) == 1) {
+                        size_t run = ascii_span(reinterpret_cast<const char*>(src) + pos, std::min(n - pos, count - k));
+                        for (size_t end = pos + run; pos < end; ++pos)
+                            dst[k++] = ascii[uint8_t(src[pos])];
+                    } else {
+                        dst[k++] = ascii[unit];
+                        ++pos;
+                    }
+                    continue;
+                }
+                char32_t u = 0;
+                if (check) {
+                    pos += UtfEncoding<C>::decode(src + pos, n - pos, u);
+                    if (! char_is_unicode(u))
+                        u = replacement_char;
+                } else {
+                    pos += UtfEncoding<C>::decode_fast(src + pos, n - pos, u);
+                }
+                dst[k++] = property_value<K>(u);
+            }
+            count = k;
+            return pos;
+        }
+
+        template <typename C>
+        size_t classify_any(const C* src, size_t n, PropertyKind kind, bool check, uint8_t* dst, size_t& count) noexcept {
+            switch (kind) {
+                case PropertyKind::bidi_class:              return classify_kind<PropertyKind::bidi_class>(src, n, check, dst, count);
+                case PropertyKind::combining_class:         return classify_kind<PropertyKind::combining_class>(src, n, check, dst, count);
+                case PropertyKind::east_asian_width:        return classify_kind<PropertyKind::east_asian_width>(src, n, check, dst, count);
+                case PropertyKind::general_category:        return classify_kind<PropertyKind::general_category>(src, n, check, dst, count);
+                case PropertyKind::grapheme_cluster_break:  return classify_kind<PropertyKind::grapheme_cluster_break>(src, n, check, dst, count);
+                case PropertyKind::line_break:              return classify_kind<PropertyKind::line_break>(src, n, check, dst, count);
+                case PropertyKind::script:                  return classify_kind<PropertyKind::script>(src, n, check, dst, count);
+                case PropertyKind::sentence_break:          return classify_kind<PropertyKind::sentence_break>(src, n, check, dst, count);
+                case PropertyKind::word_break:              return classify_kind<PropertyKind::word_break>(src, n, check, dst, count);
+                default:                                    count = 0; return 0;
+            }
+        }
+
+        template <typename C>
+        void classify_string(const basic_string<C>& src, PropertyKind kind, vector<uint8_t>& out) {
+            out.resize(src.size());
+            size_t count = src.size();
+            UnicornDetail::classify_units(src.data(), src.size(), kind, true, out.data(), count);
+            out.resize(count);
+        }
+
+    }
+
+    uint8_t gc_index(uint16_t cat) noexcept {
+        auto i = gc_index_table.index[UnicornDetail::gc_bit(cat)];
+        return all_categories[i] == cat ? i : gc_index(GC::Cn);
+    }
+
+    uint16_t gc_from_index(uint8_t index) noexcept {
+        return index < std::extent<decltype(all_categories)>::value ? all_categories[index] : uint16_t(GC::Cn);
+    }
+
+    void classify(const u8string& src, PropertyKind kind, vector<uint8_t>& out) { classify_string(src, kind, out); }
+    void classify(const u16string& src, PropertyKind kind, vector<uint8_t>& out) { classify_string(src, kind, out); }
+    void classify(const u32string& src, PropertyKind kind, vector<uint8_t>& out) { classify_string(src, kind, out); }
+    void classify(const wstring& src, PropertyKind kind, vector<uint8_t>& out) { classify_string(src, kind, out); }
+
+    size_t UnicornDetail::classify_units(const char* src, size_t n, PropertyKind kind, bool check, uint8_t* dst, size_t& count) noexcept {
+        return classify_any(src, n, kind, check, dst, count);
+    }
+
+    size_t UnicornDetail::classify_units(const char16_t* src, size_t n, PropertyKind kind, bool check, uint8_t* dst, size_t& count) noexcept {
+        return classify_any(src, n, kind, check, dst, count);
+    }
+
+    size_t UnicornDetail::classify_units(const char32_t* src, size_t n, PropertyKind kind, bool check, uint8_t* dst, size_t& count) noexcept {
+        return classify_any(src, n, kind, check, dst, count);
+    }
+
+    size_t UnicornDetail::classify_units(const wchar_t* src, size_t n, PropertyKind kind, bool check, uint8_t* dst, size_t& count) noexcept {
+        return classify_any(src, n, kind, check, dst, count);
+    }
+
+}
+
+namespace Unicorn {
+
+    // Character sets
+
+    namespace {
+
+        // Kernels for charset_scan(). The set's ASCII map is arranged so that
+        // a byte is a member if the entry for its low nibble has the bit for
+        // its high nibble set; the SIMD versions look up both nibbles with a
+        // byte shuffle and AND the results. Bytes with the high bit set pick
+        // up a zero from the high nibble table and are never members.
+
+        size_t charset_scan_bytes(const char* src, size_t n, const uint8_t* map, bool negate, bool stop_high) noexcept {
+            for (size_t i = 0; i < n; ++i) {
+                auto b = uint8_t(src[i]);
+                if (b > 0x7f ? stop_high : (((map[b % 16] >> (b / 16)) & 1) != 0) != negate)
+                    return i;
+            }
+            return n;
+        }
+
+        #if defined(__SSE2__)
+
+            __attribute__((__target__("ssse3")))
+            size_t charset_scan_ssse3(const char* src, size_t n, const uint8_t* map, bool negate, bool stop_high) noexcept {
+                auto low_table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(map));
+                auto high_table = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, char(128), 0, 0, 0, 0, 0, 0, 0, 0);
+                auto nibble = _mm_set1_epi8(0x0f);
+                auto zero = _mm_setzero_si128();
+                unsigned flip = negate ? 0xffff : 0, high_hits = stop_high ? 0xffff : 0;
+                size_t i = 0;
+                for (; i + 16 <= n; i += 16) {
+                    auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                    auto low = _mm_and_si128(input, nibble);
+                    auto high = _mm_and_si128(_mm_srli_epi16(input, 4), nibble);
+                    auto bits = _mm_and_si128(_mm_shuffle_epi8(low_table, low), _mm_shuffle_epi8(high_table, high));
+                    unsigned member = ~ unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(bits, zero))) & 0xffff;
+                    unsigned nonascii = unsigned(_mm_movemask_epi8(input));
+                    unsigned hits = ((member ^ flip) & ~ nonascii) | (nonascii & high_hits);
+                    if (hits)
+                        return i + __builtin_ctz(hits);
+                }
+                return i + charset_scan_bytes(src + i, n - i, map, negate, stop_high);
+            }
+
+            __attribute__((__target__("avx2")))
+            size_t charset_scan_avx2(const char* src, size_t n, const uint8_t* map, bool negate, bool stop_high) noexcept {
+                auto low_table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(map)));
+                auto high_table = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, char(128), 0, 0, 0, 0, 0, 0, 0, 0,
+                    1, 2, 4, 8, 16, 32, 64, char(128), 0, 0, 0, 0, 0, 0, 0, 0);
+                auto nibble = _mm256_set1_epi8(0x0f);
+                auto zero = _mm256_setzero_si256();
+                unsigned flip = negate ? ~ 0u : 0, high_hits = stop_high ? ~ 0u : 0;
+                size_t i = 0;
+                for (; i + 32 <= n; i += 32) {
+                    auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                    auto low = _mm256_and_si256(input, nibble);
+                    auto high = _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble);
+                    auto bits = _mm256_and_si256(_mm256_shuffle_epi8(low_table, low), _mm256_shuffle_epi8(high_table, high));
+                    unsigned member = ~ unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bits, zero)));
+                    unsigned nonascii = unsigned(_mm256_movemask_epi8(input));
+                    unsigned hits = ((member ^ flip) & ~ nonascii) | (nonascii & high_hits);
+                    if (hits)
+                        return i + __builtin_ctz(hits);
+                }
+                return i + charset_scan_ssse3(src + i, n - i, map, negate, stop_high);
+            }
+
+        #endif
+
+        struct CharsetKernels {
+            size_t (*scan)(const char*, size_t, const uint8_t*, bool, bool) noexcept;
+            CharsetKernels() noexcept;
+        };
+
+        CharsetKernels::CharsetKernels() noexcept:
+        scan(charset_scan_bytes) {
+            #if defined(__SSE2__)
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx2"))
+                    scan = charset_scan_avx2;
+                else if (__builtin_cpu_supports("ssse3"))
+                    scan = charset_scan_ssse3;
+            #endif
+        }
+
+        const CharsetKernels& charset_kernels() noexcept {
+            static const CharsetKernels kernels;
+            return kernels;
+        }
+
+    }
+
+    size_t UnicornDetail::charset_scan(const char* src, size_t n, const CharacterSet& set, bool negate, bool stop_high) noexcept {
+        return charset_kernels().scan(src, n, set.map.data(), negate, stop_high);
+    }
+
+    CharacterSet::CharacterSet(const u8string& chars) {
+        assign_chars(to_utf32(chars));
+    }
+
+    CharacterSet::CharacterSet(const u16string& chars) {
+        assign_chars(to_utf32(chars));
+    }
+
+    CharacterSet::CharacterSet(const u32string& chars) {
+        assign_chars(chars);
+    }
+
+    CharacterSet::CharacterSet(const wstring& chars) {
+        assign_chars(to_utf32(chars));
+    }
+
+    CharacterSet::CharacterSet(const CharPredicate& p) {
+        // The predicate only looks at the general category, so one probe
+        // for each run in the category table is enough
+        auto& table = UnicornDetail::general_category_table;
+        vector<range_type> out;
+        for (auto it = table.begin(); it != table.end() && it->key <= last_unicode_char; ++it) {
+            if (! p(it->key))
+                continue;
+            char32_t last = it + 1 == table.end() ? last_unicode_char : std::min(char32_t(it[1].key - 1), last_unicode_char);
+            if (! out.empty() && it->key == out.back().second + 1)
+                out.back().second = last;
+            else
+                out.push_back({it->key, last});
+        }
+        assign(std::move(out));
+    }
+
+    size_t CharacterSet::size() const noexcept {
+        size_t n = 0;
+        for (auto& r: list)
+            n += r.second - r.first + 1;
+        return n;
+    }
+
+    void CharacterSet::insert(char32_t first, char32_t last) {
+        last = std::min(last, last_unicode_char);
+        if (first > last)
+            return;
+        CharacterSet s;
+        s.assign({{first, last}});
+        *this |= s;
+    }
+
+    CharacterSet CharacterSet::operator~() const {
+        vector<range_type> out;
+        char32_t next = 0;
+        for (auto& r: list) {
+            if (r.first > next)
+                out.push_back({next, r.first - 1});
+            next = r.second + 1;
+        }
+        if (next <= last_unicode_char)
+            out.push_back({next, last_unicode_char});
+        CharacterSet s;
+        s.assign(std::move(out));
+        return s;
+    }
+
+    CharacterSet& CharacterSet::operator&=(const CharacterSet& rhs) {
+        vector<range_type> out;
+        auto i = list.cbegin(), j = rhs.list.cbegin();
+        while (i != list.cend() && j != rhs.list.cend()) {
+            auto first = std::max(i->first, j->first), last = std::min(i->second, j->second);
+            if (first <= last)
+                out.push_back({first, last});
+            if (i->second < j->second)
+                ++i;
+            else
+                ++j;
+        }
+        assign(std::move(out));
+        return *this;
+    }
+
+    CharacterSet& CharacterSet::operator|=(const CharacterSet& rhs) {
+        vector<range_type> all;
+        all.reserve(list.size() + rhs.list.size());
+        std::merge(list.begin(), list.end(), rhs.list.begin(), rhs.list.end(), std::back_inserter(all));
+        vector<range_type> out;
+        for (auto& r: all) {
+            if (! out.empty() && r.first <= out.back().second + 1)
+                out.back().second = std::max(out.back().second, r.second);
+            else
+                out.push_back(r);
+        }
+        assign(std::move(out));
+        return *this;
+    }
+
+    CharacterSet& CharacterSet::operator-=(const CharacterSet& rhs) {
+        return *this &= ~ rhs;
+    }
+
+    void CharacterSet::build(const std::function<bool(char32_t)>& p) {
+        vector<range_type> out;
+        bool in = false;
+        for (char32_t c = 0; c <= last_unicode_char; ++c) {
+            bool member = p(c);
+            if (member && ! in)
+                out.push_back({c, c});
+            else if (member)
+                out.back().second = c;
+            in = member;
+        }
+        assign(std::move(out));
+    }
+
+    void CharacterSet::assign(vector<range_type>&& ranges) {
+        list = std::move(ranges);
+        map.fill(0);
+        for (auto& r: list) {
+            if (r.first > last_ascii_char)
+                break;
+            for (char32_t c = r.first, last = std::min(r.second, last_ascii_char); c <= last; ++c)
+                map[c % 16] |= uint8_t(1u << (c / 16));
+        }
+    }
+
+    void CharacterSet::assign_chars(u32string chars) {
+        std::sort(chars.begin(), chars.end());
+        vector<range_type> out;
+        out.reserve(chars.size());
+        for (auto c: chars) {
+            if (c > last_unicode_char)
+                break;
+            if (! out.empty() && c <= out.back().second + 1)
+                out.back().second = c;
+            else
+                out.push_back({c, c});
+        }
+        assign(std::move(out));
+    }
+
+}
+
+namespace Unicorn {
+
+    // Bulk case mapping
+
+    namespace {
+
+        // Kernels for converting runs of ASCII to lowercase. SSE2 is always
+        // available on x86-64, so only the AVX2 version needs dispatching.
+
+        void ascii_lowercase_bytes(const char* src, size_t n, char* dst) noexcept {
+            for (size_t i = 0; i < n; ++i) {
+                auto b = uint8_t(src[i]);
+                dst[i] = char(unsigned(b - 'A') < 26u ? b + 32 : b);
+            }
+        }
+
+        #if defined(__SSE2__)
+
+            void ascii_lowercase_sse2(const char* src, size_t n, char* dst) noexcept {
+                auto offset = _mm_set1_epi8(char(0x80 - 'A'));
+                auto limit = _mm_set1_epi8(char(0x80 + 26));
+                auto delta = _mm_set1_epi8(32);
+                size_t i = 0;
+                for (; i + 16 <= n; i += 16) {
+                    auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                    auto upper = _mm_cmplt_epi8(_mm_add_epi8(input, offset), limit);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_add_epi8(input, _mm_and_si128(upper, delta)));
+                }
+                ascii_lowercase_bytes(src + i, n - i, dst + i);
+            }
+
+            __attribute__((__target__("avx2")))
+            void ascii_lowercase_avx2(const char* src, size_t n, char* dst) noexcept {
+                auto offset = _mm256_set1_epi8(char(0x80 - 'A'));
+                auto limit = _mm256_set1_epi8(char(0x80 + 26));
+                auto delta = _mm256_set1_epi8(32);
+                size_t i = 0;
+                for (; i + 32 <= n; i += 32) {
+                    auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                    auto upper = _mm256_cmpgt_epi8(limit, _mm256_add_epi8(input, offset));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_add_epi8(input, _mm256_and_si256(upper, delta)));
+                }
+                ascii_lowercase_sse2(src + i, n - i, dst + i);
+            }
+
+        #endif
+
+        struct CaseKernels {
+            void (*lowercase)(const char*, size_t, char*) noexcept;
+            CaseKernels() noexcept;
+        };
+
+        CaseKernels::CaseKernels() noexcept:
+        lowercase(ascii_lowercase_bytes) {
+            #if defined(__SSE2__)
+                lowercase = ascii_lowercase_sse2;
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx2"))
+                    lowercase = ascii_lowercase_avx2;
+            #endif
+        }
+
+        const CaseKernels& case_kernels() noexcept {
+            static const CaseKernels kernels;
+            return kernels;
+        }
+
+        // ASCII runs are lowercased in one pass (case folding and lowercasing
+        // are the same thing in ASCII); other characters are looked up in the
+        // case tables, and their code units copied as they are if the mapping
+        // leaves them unchanged. The input is validated up front, so only the
+        // part after the first error needs checked decoding; invalid code
+        // units are copied unchanged.
+
+        constexpr char32_t sigma = 0x3c3;
+        constexpr char32_t final_sigma = 0x3c2;
+
+        template <typename C>
+        size_t ascii_run(const C* src, size_t n) noexcept {
+            if (sizeof(C) == 1)
+                return UnicornDetail::ascii_span(reinterpret_cast<const char*>(src), n);
+            size_t i = 0;
+            while (i < n && std::make_unsigned_t<C>(src[i]) < 0x80)
+                ++i;
+            return i;
+        }
+
+        template <typename C>
+        void append_ascii_lowercase(const C* src, size_t n, basic_string<C>& dst) {
+            size_t pos = dst.size();
+            dst.resize(pos + n);
+            if (sizeof(C) == 1) {
+                case_kernels().lowercase(reinterpret_cast<const char*>(src), n, reinterpret_cast<char*>(&dst[pos]));
+            } else {
+                for (size_t i = 0; i < n; ++i)
+                    dst[pos + i] = uint32_t(src[i]) - uint32_t('A') < 26u ? C(src[i] + 32) : src[i];
+            }
+        }
+
+        template <typename C>
+        size_t decode_case_char(const C* src, size_t n, bool check, char32_t& u) noexcept {
+            if (! check)
+                return UnicornDetail::UtfEncoding<C>::decode_fast(src, n, u);
+            size_t len = UnicornDetail::UtfEncoding<C>::decode(src, n, u);
+            if (! char_is_unicode(u))
+                u = UnicornDetail::not_found;
+            return len;
+        }
+
+        template <typename C>
+        size_t valid_prefix(const C* src, size_t n) noexcept {
+            size_t valid = UnicornDetail::utf_error_offset(src, n);
+            return valid == npos ? n : valid;
+        }
+
+        template <typename C>
+        void append_case_chars(const char32_t* chars, size_t count, basic_string<C>& dst) {
+            C buf[max_case_decomposition * UnicornDetail::UtfEncoding<C>::max_units];
+            size_t len = 0;
+            for (size_t i = 0; i < count; ++i)
+                len += UnicornDetail::UtfEncoding<C>::encode(chars[i], buf + len);
+            dst.append(buf, len);
+        }
+
+        template <typename C>
+        bool next_cased(const CaseTable& table, const C* src, size_t n, size_t valid) noexcept {
+            size_t pos = 0;
+            while (pos < n) {
+                char32_t u = 0;
+                pos += decode_case_char(src + pos, n - pos, pos >= valid, u);
+                if (u == UnicornDetail::not_found)
+                    return false;
+                auto v = table[u];
+                if (! (v & CaseTable::ignorable_flag))
+                    return (v & CaseTable::cased_flag) != 0;
+            }
+            return false;
+        }
+
+        template <typename C>
+        void casefold_any(const C* src, size_t n, basic_string<C>& dst) {
+            auto& table = casefold_table();
+            char32_t chars[max_case_decomposition];
+            size_t valid = valid_prefix(src, n);
+            dst.reserve(dst.size() + n);
+            size_t pos = 0;
+            while (pos < n) {
+                size_t run = ascii_run(src + pos, n - pos);
+                if (run) {
+                    append_ascii_lowercase(src + pos, run, dst);
+                    pos += run;
+                    continue;
+                }
+                char32_t u = 0;
+                size_t len = decode_case_char(src + pos, n - pos, pos >= valid, u);
+                int32_t v = u == UnicornDetail::not_found ? 0 : table[u];
+                if (CaseTable::unchanged(v))
+                    dst.append(src + pos, len);
+                else
+                    append_case_chars(chars, table.expand(u, v, chars), dst);
+                pos += len;
+            }
+        }
+
+        template <typename C>
+        void lowercase_any(const C* src, size_t n, basic_string<C>& dst) {
+            auto& table = lowercase_table();
+            char32_t chars[max_case_decomposition];
+            size_t valid = valid_prefix(src, n);
+            bool last_cased = false;
+            dst.reserve(dst.size() + n);
+            size_t pos = 0;
+            while (pos < n) {
+                size_t run = ascii_run(src + pos, n - pos);
+                if (run) {
+                    append_ascii_lowercase(src + pos, run, dst);
+                    pos += run;
+                    for (size_t i = pos; i > pos - run; --i) {
+                        auto v = table[char32_t(src[i - 1])];
+                        if (! (v & CaseTable::ignorable_flag)) {
+                            last_cased = (v & CaseTable::cased_flag) != 0;
+                            break;
+                        }
+                    }
+                    continue;
+                }
+                char32_t u = 0;
+                size_t len = decode_case_char(src + pos, n - pos, pos >= valid, u);
+                if (u == UnicornDetail::not_found) {
+                    dst.append(src + pos, len);
+                    last_cased = false;
+                    pos += len;
+                    continue;
+                }
+                int32_t v = table[u];
+                if (u == sigma || ! CaseTable::unchanged(v)) {
+                    size_t count = table.expand(u, v, chars);
+                    if (chars[0] == sigma && last_cased && ! next_cased(table, src + pos + len, n - pos - len, valid - std::min(valid, pos + len)))
+                        chars[0] = final_sigma;
+                    append_case_chars(chars, count, dst);
+                } else {
+                    dst.append(src + pos, len);
+                }
+                if (! (v & CaseTable::ignorable_flag))
+                    last_cased = (v & CaseTable::cased_flag) != 0;
+                pos += len;
+            }
+        }
+
+    }
+
+    void UnicornDetail::casefold_units(const char* src, size_t n, u8string& dst) { casefold_any(src, n, dst); }
+    void UnicornDetail::casefold_units(const char16_t* src, size_t n, u16string& dst) { casefold_any(src, n, dst); }
+    void UnicornDetail::casefold_units(const char32_t* src, size_t n, u32string& dst) { casefold_any(src, n, dst); }
+    void UnicornDetail::casefold_units(const wchar_t* src, size_t n, wstring& dst) { casefold_any(src, n, dst); }
+    void UnicornDetail::lowercase_units(const char* src, size_t n, u8string& dst) { lowercase_any(src, n, dst); }
+    void UnicornDetail::lowercase_units(const char16_t* src, size_t n, u16string& dst) { lowercase_any(src, n, dst); }
+    void UnicornDetail::lowercase_units(const char32_t* src, size_t n, u32string& dst) { lowercase_any(src, n, dst); }
+    void UnicornDetail::lowercase_units(const wchar_t* src, size_t n, wstring& dst) { lowercase_any(src, n, dst); }
+
 }
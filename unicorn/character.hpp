@@ -2,8 +2,12 @@
 
 #include "unicorn/core.hpp"
 #include "unicorn/property-values.hpp"
+#include "unicorn/ucd-latin1-tables.hpp"
+#include <algorithm>
+#include <array>
 #include <cstring>
 #include <functional>
+#include <initializer_list>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -35,6 +39,7 @@ namespace Unicorn {
     constexpr char32_t first_private_use_b_char       = 0x100000;        // Beginning of supplementary private use area B
     constexpr char32_t last_private_use_b_char        = 0x10fffd;        // End of supplementary private use area B
     constexpr char32_t last_unicode_char              = 0x10ffff;        // Highest possible Unicode code point
+    constexpr char32_t not_a_char                     = 0xffffffff;      // Not a code point, returned by failed lookups
     constexpr const char* utf8_bom                    = "\xef\xbb\xbf";  // Byte order mark (U+FEFF) in UTF-8
     constexpr const char* utf8_replacement            = "\xef\xbf\xbd";  // Unicode replacement character (U+FFFD) in UTF-8
     constexpr size_t max_case_decomposition           = 3;               // Maximum length of a full case mapping
@@ -110,7 +115,40 @@ namespace Unicorn {
 
     }
 
-    uint16_t char_general_category(char32_t c) noexcept;
+    namespace UnicornDetail {
+
+        // Latin-1 fast path, using the tables generated by make-tables in
+        // ucd-latin1-tables.hpp, so that the common case never reaches the
+        // full property tables
+
+        constexpr bool latin1_property(char32_t c, uint16_t flag) noexcept { return (latin1_properties[c] & flag) != 0; }
+
+        // Full table lookups for code points outside Latin-1
+
+        uint16_t general_category_lookup(char32_t c) noexcept;
+        bool white_space_lookup(char32_t c) noexcept;
+        bool id_start_lookup(char32_t c) noexcept;
+        bool id_nonstart_lookup(char32_t c) noexcept;
+        bool xid_start_lookup(char32_t c) noexcept;
+        bool xid_nonstart_lookup(char32_t c) noexcept;
+        bool pattern_syntax_lookup(char32_t c) noexcept;
+        bool pattern_white_space_lookup(char32_t c) noexcept;
+        bool default_ignorable_lookup(char32_t c) noexcept;
+        bool soft_dotted_lookup(char32_t c) noexcept;
+        bool bidi_mirrored_lookup(char32_t c) noexcept;
+        bool uppercase_lookup(char32_t c) noexcept;
+        bool lowercase_lookup(char32_t c) noexcept;
+        bool cased_lookup(char32_t c) noexcept;
+        bool case_ignorable_lookup(char32_t c) noexcept;
+        char32_t simple_uppercase_lookup(char32_t c) noexcept;
+        char32_t simple_lowercase_lookup(char32_t c) noexcept;
+        char32_t simple_titlecase_lookup(char32_t c) noexcept;
+        char32_t simple_casefold_lookup(char32_t c) noexcept;
+
+    }
+
+    inline uint16_t char_general_category(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_general_category[c] : UnicornDetail::general_category_lookup(c); }
     inline char char_primary_category(char32_t c) noexcept { return char(char_general_category(c) >> 8); }
     inline bool char_is_alphanumeric(char32_t c) noexcept { auto g = char_primary_category(c); return g == 'L' || g == 'N'; }
     inline bool char_is_control(char32_t c) noexcept { return char_general_category(c) == GC::Cc; }
@@ -122,33 +160,72 @@ namespace Unicorn {
     inline bool char_is_symbol(char32_t c) noexcept { return char_primary_category(c) == 'S'; }
     inline bool char_is_separator(char32_t c) noexcept { return char_primary_category(c) == 'Z'; }
 
-    std::function<bool(char32_t)> gc_predicate(uint16_t cat);
-    std::function<bool(char32_t)> gc_predicate(const u8string& cat);
-    std::function<bool(char32_t)> gc_predicate(const char* cat);
+    namespace UnicornDetail {
+
+        // Maps each valid GC code to a distinct bit position
+
+        constexpr unsigned gc_bit(uint16_t cat) noexcept { return ((uint32_t(cat) * 697) >> 8) & 63; }
+
+    }
+
+    class CharPredicate {
+    public:
+        CharPredicate() = default;
+        explicit CharPredicate(uint16_t cat) noexcept { add(cat, cat); }
+        explicit CharPredicate(const u8string& cat) noexcept { parse(cat.data(), cat.size()); }
+        explicit CharPredicate(const char* cat) noexcept { if (cat) parse(cat, std::strlen(cat)); }
+        bool operator()(char32_t c) const noexcept { return (mask >> UnicornDetail::gc_bit(char_general_category(c))) & 1; }
+        bool empty() const noexcept { return mask == 0; }
+        CharPredicate operator~() const noexcept;
+        CharPredicate& operator&=(const CharPredicate& rhs) noexcept { mask &= rhs.mask; return *this; }
+        CharPredicate& operator|=(const CharPredicate& rhs) noexcept { mask |= rhs.mask; return *this; }
+        friend CharPredicate operator&(const CharPredicate& lhs, const CharPredicate& rhs) noexcept { auto p = lhs; p &= rhs; return p; }
+        friend CharPredicate operator|(const CharPredicate& lhs, const CharPredicate& rhs) noexcept { auto p = lhs; p |= rhs; return p; }
+        friend bool operator==(const CharPredicate& lhs, const CharPredicate& rhs) noexcept { return lhs.mask == rhs.mask; }
+        friend bool operator!=(const CharPredicate& lhs, const CharPredicate& rhs) noexcept { return lhs.mask != rhs.mask; }
+    private:
+        uint64_t mask = 0;
+        void add(uint16_t first, uint16_t last) noexcept;
+        void parse(const char* cat, size_t n) noexcept;
+    };
+
+    inline CharPredicate gc_predicate(uint16_t cat) noexcept { return CharPredicate(cat); }
+    inline CharPredicate gc_predicate(const u8string& cat) noexcept { return CharPredicate(cat); }
+    inline CharPredicate gc_predicate(const char* cat) noexcept { return CharPredicate(cat); }
 
     // Boolean properties
 
     inline bool char_is_assigned(char32_t c) noexcept { return char_general_category(c) != GC::Cn; }
     inline bool char_is_unassigned(char32_t c) noexcept { return char_general_category(c) == GC::Cn; }
-    bool char_is_white_space(char32_t c) noexcept;
+    inline bool char_is_white_space(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_property(c, UnicornDetail::lp_white_space) : UnicornDetail::white_space_lookup(c); }
     inline bool char_is_line_break(char32_t c) noexcept { return c == U'\n' || c == U'\v' || c == U'\f' || c == U'\r'
         || c == 0x85 || c == line_separator_char || c == paragraph_separator_char; }
     inline bool char_is_inline_space(char32_t c) noexcept { return char_is_white_space(c) && ! char_is_line_break(c); }
-    bool char_is_id_start(char32_t c) noexcept;
-    bool char_is_id_nonstart(char32_t c) noexcept;
+    inline bool char_is_id_start(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_property(c, UnicornDetail::lp_id_start) : UnicornDetail::id_start_lookup(c); }
+    inline bool char_is_id_nonstart(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_property(c, UnicornDetail::lp_id_nonstart) : UnicornDetail::id_nonstart_lookup(c); }
     inline bool char_is_id_continue(char32_t c) noexcept { return char_is_id_start(c) || char_is_id_nonstart(c); }
-    bool char_is_xid_start(char32_t c) noexcept;
-    bool char_is_xid_nonstart(char32_t c) noexcept;
+    inline bool char_is_xid_start(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_property(c, UnicornDetail::lp_xid_start) : UnicornDetail::xid_start_lookup(c); }
+    inline bool char_is_xid_nonstart(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_property(c, UnicornDetail::lp_xid_nonstart) : UnicornDetail::xid_nonstart_lookup(c); }
     inline bool char_is_xid_continue(char32_t c) noexcept { return char_is_xid_start(c) || char_is_xid_nonstart(c); }
-    bool char_is_pattern_syntax(char32_t c) noexcept;
-    bool char_is_pattern_white_space(char32_t c) noexcept;
-    bool char_is_default_ignorable(char32_t c) noexcept;
-    bool char_is_soft_dotted(char32_t c) noexcept;
+    inline bool char_is_pattern_syntax(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_property(c, UnicornDetail::lp_pattern_syntax) : UnicornDetail::pattern_syntax_lookup(c); }
+    inline bool char_is_pattern_white_space(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_property(c, UnicornDetail::lp_pattern_white_space) : UnicornDetail::pattern_white_space_lookup(c); }
+    inline bool char_is_default_ignorable(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_property(c, UnicornDetail::lp_default_ignorable) : UnicornDetail::default_ignorable_lookup(c); }
+    inline bool char_is_soft_dotted(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_property(c, UnicornDetail::lp_soft_dotted) : UnicornDetail::soft_dotted_lookup(c); }
 
     // Bidirectional properties
 
     Bidi_Class bidi_class(char32_t c) noexcept;
-    bool char_is_bidi_mirrored(char32_t c) noexcept;
+    inline bool char_is_bidi_mirrored(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_property(c, UnicornDetail::lp_bidi_mirrored) : UnicornDetail::bidi_mirrored_lookup(c); }
     char32_t bidi_mirroring_glyph(char32_t c) noexcept;
     char32_t bidi_paired_bracket(char32_t c) noexcept;
     char bidi_paired_bracket_type(char32_t c) noexcept;
@@ -162,24 +239,51 @@ namespace Unicorn {
     };
 
     u8string char_block(char32_t c);
+    uint16_t char_block_id(char32_t c) noexcept;
+    u8string block_name(uint16_t id);
     const vector<BlockInfo>& unicode_block_list();
 
     // Case folding properties
 
-    bool char_is_uppercase(char32_t c) noexcept;
-    bool char_is_lowercase(char32_t c) noexcept;
+    inline bool char_is_uppercase(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_property(c, UnicornDetail::lp_uppercase) : UnicornDetail::uppercase_lookup(c); }
+    inline bool char_is_lowercase(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_property(c, UnicornDetail::lp_lowercase) : UnicornDetail::lowercase_lookup(c); }
     inline bool char_is_titlecase(char32_t c) noexcept { return char_general_category(c) == GC::Lt; }
-    bool char_is_cased(char32_t c) noexcept;
-    bool char_is_case_ignorable(char32_t c) noexcept;
-    char32_t char_to_simple_uppercase(char32_t c) noexcept;
-    char32_t char_to_simple_lowercase(char32_t c) noexcept;
-    char32_t char_to_simple_titlecase(char32_t c) noexcept;
-    char32_t char_to_simple_casefold(char32_t c) noexcept;
+    inline bool char_is_cased(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_property(c, UnicornDetail::lp_cased) : UnicornDetail::cased_lookup(c); }
+    inline bool char_is_case_ignorable(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_property(c, UnicornDetail::lp_case_ignorable) : UnicornDetail::case_ignorable_lookup(c); }
+    inline char32_t char_to_simple_uppercase(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_uppercase[c] : UnicornDetail::simple_uppercase_lookup(c); }
+    inline char32_t char_to_simple_lowercase(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_lowercase[c] : UnicornDetail::simple_lowercase_lookup(c); }
+    inline char32_t char_to_simple_titlecase(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_uppercase[c] : UnicornDetail::simple_titlecase_lookup(c); }
+    inline char32_t char_to_simple_casefold(char32_t c) noexcept
+        { return c <= last_latin1_char ? UnicornDetail::latin1_casefold[c] : UnicornDetail::simple_casefold_lookup(c); }
     size_t char_to_full_uppercase(char32_t c, char32_t* dst) noexcept;
     size_t char_to_full_lowercase(char32_t c, char32_t* dst) noexcept;
     size_t char_to_full_titlecase(char32_t c, char32_t* dst) noexcept;
     size_t char_to_full_casefold(char32_t c, char32_t* dst) noexcept;
 
+    namespace UnicornDetail {
+
+        // Bulk case mapping used by str_casefold() and str_lowercase(). These
+        // append the full mapping of n code units to dst; invalid code units
+        // are copied unchanged.
+
+        void casefold_units(const char* src, size_t n, u8string& dst);
+        void casefold_units(const char16_t* src, size_t n, u16string& dst);
+        void casefold_units(const char32_t* src, size_t n, u32string& dst);
+        void casefold_units(const wchar_t* src, size_t n, wstring& dst);
+        void lowercase_units(const char* src, size_t n, u8string& dst);
+        void lowercase_units(const char16_t* src, size_t n, u16string& dst);
+        void lowercase_units(const char32_t* src, size_t n, u32string& dst);
+        void lowercase_units(const wchar_t* src, size_t n, wstring& dst);
+
+    }
+
     // Character names
 
     constexpr uint32_t cn_control  = 1u << 0;
@@ -187,8 +291,10 @@ namespace Unicorn {
     constexpr uint32_t cn_lower    = 1u << 2;
     constexpr uint32_t cn_prefix   = 1u << 3;
     constexpr uint32_t cn_update   = 1u << 4;
+    constexpr uint32_t cn_loose    = 1u << 5;
 
     u8string char_name(char32_t c, uint32_t flags = 0);
+    char32_t char_from_name(const u8string& name, uint32_t flags = 0);
 
     // Decomposition properties
 
@@ -229,8 +335,176 @@ namespace Unicorn {
 
     // Script properties
 
+    constexpr size_t script_count = size_t(Script::Zyyy) + 1;
+
+    class ScriptSet {
+    public:
+        class iterator:
+        public ForwardIterator<iterator, const Script> {
+        public:
+            iterator() = default;
+            const Script& operator*() const noexcept { return current; }
+            iterator& operator++() noexcept { current = set->next(size_t(current) + 1); return *this; }
+            bool operator==(const iterator& rhs) const noexcept { return current == rhs.current; }
+        private:
+            friend class ScriptSet;
+            const ScriptSet* set = nullptr;
+            Script current = Script::Zzzz;
+            iterator(const ScriptSet* s, Script c) noexcept: set(s), current(c) {}
+        };
+        ScriptSet() = default;
+        ScriptSet(Script s) noexcept { insert(s); }
+        ScriptSet(std::initializer_list<Script> list) noexcept { for (auto s: list) insert(s); }
+        iterator begin() const noexcept { return {this, next(0)}; }
+        iterator end() const noexcept { return {this, end_marker}; }
+        bool contains(Script s) const noexcept { return (bits[size_t(s) / 64] >> (size_t(s) % 64)) & 1; }
+        bool empty() const noexcept;
+        size_t size() const noexcept;
+        void insert(Script s) noexcept { bits[size_t(s) / 64] |= uint64_t(1) << (size_t(s) % 64); }
+        void erase(Script s) noexcept { bits[size_t(s) / 64] &= ~ (uint64_t(1) << (size_t(s) % 64)); }
+        ScriptSet& operator&=(const ScriptSet& rhs) noexcept { for (size_t i = 0; i < words; ++i) bits[i] &= rhs.bits[i]; return *this; }
+        ScriptSet& operator|=(const ScriptSet& rhs) noexcept { for (size_t i = 0; i < words; ++i) bits[i] |= rhs.bits[i]; return *this; }
+        friend ScriptSet operator&(const ScriptSet& lhs, const ScriptSet& rhs) noexcept { auto s = lhs; s &= rhs; return s; }
+        friend ScriptSet operator|(const ScriptSet& lhs, const ScriptSet& rhs) noexcept { auto s = lhs; s |= rhs; return s; }
+        friend bool operator==(const ScriptSet& lhs, const ScriptSet& rhs) noexcept { return lhs.bits == rhs.bits; }
+        friend bool operator!=(const ScriptSet& lhs, const ScriptSet& rhs) noexcept { return lhs.bits != rhs.bits; }
+    private:
+        friend ScriptSet char_script_set(char32_t c) noexcept;
+        static constexpr size_t words = (script_count + 63) / 64;
+        static constexpr Script end_marker = Script(words * 64 - 1);
+        std::array<uint64_t, words> bits = {{}};
+        Script next(size_t i) const noexcept;
+    };
+
+    std::ostream& operator<<(std::ostream& o, Script x);
+    std::ostream& operator<<(std::ostream& o, const ScriptSet& x);
+
     u8string char_script(char32_t c);
     vector<u8string> char_script_list(char32_t c);
     u8string script_name(const u8string& abbr);
+    Script char_script_id(char32_t c) noexcept;
+    ScriptSet char_script_set(char32_t c) noexcept;
+    const char* script_code(Script s) noexcept;
+    Script script_from_code(const u8string& abbr) noexcept;
+    u8string script_name(Script s);
+
+    // Packed properties
+
+    struct CharProps {
+        static constexpr uint16_t cased                = 1u << 0;  // char_is_cased()
+        static constexpr uint16_t case_ignorable       = 1u << 1;  // char_is_case_ignorable()
+        static constexpr uint16_t white_space          = 1u << 2;  // char_is_white_space()
+        static constexpr uint16_t decomposable         = 1u << 3;  // Has a canonical decomposition
+        static constexpr uint16_t compat_decomposable  = 1u << 4;  // Has a canonical or compatibility decomposition
+        static constexpr uint16_t uppercase_changes    = 1u << 5;  // Full uppercase mapping is not the identity
+        static constexpr uint16_t lowercase_changes    = 1u << 6;  // Full lowercase mapping is not the identity
+        static constexpr uint16_t titlecase_changes    = 1u << 7;  // Full titlecase mapping is not the identity
+        static constexpr uint16_t casefold_changes     = 1u << 8;  // Full case folding is not the identity
+        uint16_t general_category;
+        uint16_t flags;
+        uint8_t combining_class;
+        Bidi_Class bidi_class;
+        East_Asian_Width east_asian_width;
+        Grapheme_Cluster_Break grapheme_cluster_break;
+        Line_Break line_break;
+        Sentence_Break sentence_break;
+        Word_Break word_break;
+        bool has(uint16_t flag) const noexcept { return (flags & flag) != 0; }
+        char primary_category() const noexcept { return char(general_category >> 8); }
+    };
+
+    const CharProps& char_properties(char32_t c) noexcept;
+
+    // Bulk classification
+
+    enum class PropertyKind: uint8_t {
+        bidi_class, combining_class, east_asian_width, general_category, grapheme_cluster_break,
+        line_break, script, sentence_break, word_break,
+    };
+
+    uint8_t gc_index(uint16_t cat) noexcept;
+    uint16_t gc_from_index(uint8_t index) noexcept;
+    void classify(const u8string& src, PropertyKind kind, vector<uint8_t>& out);
+    void classify(const u16string& src, PropertyKind kind, vector<uint8_t>& out);
+    void classify(const u32string& src, PropertyKind kind, vector<uint8_t>& out);
+    void classify(const wstring& src, PropertyKind kind, vector<uint8_t>& out);
+
+    namespace UnicornDetail {
+
+        // classify_units() decodes up to count characters from src (n code
+        // units), writes one property value per character to dst, and
+        // returns the number of code units consumed, setting count to the
+        // number of characters. If check is true, invalid sequences are
+        // classified as U+FFFD; otherwise they are decoded without checking,
+        // as UtfIterator does with err_ignore.
+
+        size_t classify_units(const char* src, size_t n, PropertyKind kind, bool check, uint8_t* dst, size_t& count) noexcept;
+        size_t classify_units(const char16_t* src, size_t n, PropertyKind kind, bool check, uint8_t* dst, size_t& count) noexcept;
+        size_t classify_units(const char32_t* src, size_t n, PropertyKind kind, bool check, uint8_t* dst, size_t& count) noexcept;
+        size_t classify_units(const wchar_t* src, size_t n, PropertyKind kind, bool check, uint8_t* dst, size_t& count) noexcept;
+
+    }
+
+    // Character sets
+
+    class CharacterSet;
+
+    namespace UnicornDetail {
+
+        // charset_scan() returns the offset of the first byte in src (up to
+        // n) that is an ASCII member of the set (or with negate, an ASCII
+        // non-member), or any non-ASCII byte if stop_high is true. This uses
+        // SSSE3 or AVX2 nibble lookups when available.
+
+        size_t charset_scan(const char* src, size_t n, const CharacterSet& set, bool negate, bool stop_high) noexcept;
+
+    }
+
+    class CharacterSet {
+    public:
+        using range_type = std::pair<char32_t, char32_t>;
+        CharacterSet() = default;
+        explicit CharacterSet(char32_t c) { insert(c, c); }
+        CharacterSet(char32_t first, char32_t last) { insert(first, last); }
+        explicit CharacterSet(const u8string& chars);
+        explicit CharacterSet(const u16string& chars);
+        explicit CharacterSet(const u32string& chars);
+        explicit CharacterSet(const wstring& chars);
+        explicit CharacterSet(const char* chars): CharacterSet(chars ? u8string(chars) : u8string()) {}
+        explicit CharacterSet(const CharPredicate& p);
+        template <typename Pred> static CharacterSet from_predicate(Pred p) { CharacterSet s; s.build(std::function<bool(char32_t)>(p)); return s; }
+        bool operator()(char32_t c) const noexcept { return contains(c); }
+        bool contains(char32_t c) const noexcept;
+        bool empty() const noexcept { return list.empty(); }
+        bool is_ascii() const noexcept { return list.empty() || list.back().second <= last_ascii_char; }
+        size_t size() const noexcept;
+        const vector<range_type>& ranges() const noexcept { return list; }
+        void insert(char32_t c) { insert(c, c); }
+        void insert(char32_t first, char32_t last);
+        CharacterSet operator~() const;
+        CharacterSet& operator&=(const CharacterSet& rhs);
+        CharacterSet& operator|=(const CharacterSet& rhs);
+        CharacterSet& operator-=(const CharacterSet& rhs);
+        friend CharacterSet operator&(const CharacterSet& lhs, const CharacterSet& rhs) { auto s = lhs; s &= rhs; return s; }
+        friend CharacterSet operator|(const CharacterSet& lhs, const CharacterSet& rhs) { auto s = lhs; s |= rhs; return s; }
+        friend CharacterSet operator-(const CharacterSet& lhs, const CharacterSet& rhs) { auto s = lhs; s -= rhs; return s; }
+        friend bool operator==(const CharacterSet& lhs, const CharacterSet& rhs) noexcept { return lhs.list == rhs.list; }
+        friend bool operator!=(const CharacterSet& lhs, const CharacterSet& rhs) noexcept { return lhs.list != rhs.list; }
+    private:
+        friend size_t UnicornDetail::charset_scan(const char* src, size_t n, const CharacterSet& set, bool negate, bool stop_high) noexcept;
+        vector<range_type> list;            // Sorted, disjoint, non-adjacent ranges
+        std::array<uint8_t, 16> map = {{}}; // ASCII members: bit c/16 of map[c%16]
+        void build(const std::function<bool(char32_t)>& p);
+        void assign(vector<range_type>&& ranges);
+        void assign_chars(u32string chars);
+    };
+
+    inline bool CharacterSet::contains(char32_t c) const noexcept {
+        if (c <= last_ascii_char)
+            return (map[c % 16] >> (c / 16)) & 1;
+        auto i = std::upper_bound(list.begin(), list.end(), c,
+            [] (char32_t x, const range_type& r) { return x < r.first; });
+        return i != list.begin() && c <= i[-1].second;
+    }
 
 }
@@ -291,6 +291,17 @@ namespace {
         TEST_EQUAL(vec.size(), 2);
         TEST_EQUAL_RANGE(vec, (u8vector{"Hello world\n", "Goodbye\n"}));
 
+        TRY(save_file(testfile, u8"e\u0301te\u0301\n\u00c5ngstr\u00f6m\n\ufb01ne\n"s));
+        TRY(range = read_lines(testfile, io_nfc));
+        TRY(std::copy(range.begin(), range.end(), overwrite(vec)));
+        TEST_EQUAL(vec.size(), 3);
+        TEST_EQUAL_RANGE(vec, (u8vector{u8"\u00e9t\u00e9\n", u8"\u00c5ngstr\u00f6m\n", u8"\ufb01ne\n"}));
+        TRY(range = read_lines(testfile, io_nfkd | io_striplf));
+        TRY(std::copy(range.begin(), range.end(), overwrite(vec)));
+        TEST_EQUAL(vec.size(), 3);
+        TEST_EQUAL_RANGE(vec, (u8vector{u8"e\u0301te\u0301", u8"A\u030angstro\u0308m", u8"fine"}));
+        TEST_THROW(read_lines(testfile, io_nfc | io_nfd), std::invalid_argument);
+
     }
 
     void check_file_writer() {
@@ -431,6 +442,40 @@ namespace {
         TRY(load_file(testfile, s));
         TEST_EQUAL(s, "North\r\nSouth\r\nEast\r\nWest\r\n");
 
+        // A combining mark can arrive in a later write than its base
+
+        vec32 = {U"Caf", U"e", U"\u0301 cre", U"\u0300", U"me", U"\u0300 br\u00fbl\u00e9e\n"};
+        TRY(writer = FileWriter(testfile, io_nfc));
+        TRY(std::copy(vec32.begin(), vec32.end(), writer));
+        TRY(writer.flush());
+        TRY(load_file(testfile, s));
+        TEST_EQUAL(s, u8"Caf\u00e9 cr\u00e8m\u00e8 br\u00fbl\u00e9e\n");
+        TRY(writer = FileWriter(testfile, io_nfd));
+        TRY(std::copy(vec32.begin(), vec32.end(), writer));
+        TRY(writer = FileWriter());
+        TRY(load_file(testfile, s));
+        TEST_EQUAL(s, u8"Cafe\u0301 cre\u0300me\u0300 bru\u0302le\u0301e\n");
+
+        vec32 = {U"\u1100", U"\u1161", U"\u11a8"};
+        TRY(writer = FileWriter(testfile, io_nfc | io_unbuf));
+        TRY(std::copy(vec32.begin(), vec32.end(), writer));
+        TRY(writer = FileWriter());
+        TRY(load_file(testfile, s));
+        TEST_EQUAL(s, u8"\uac01");
+
+        // A complete line is written at once with line buffering
+
+        TRY(writer = FileWriter(testfile, io_nfc | io_linebuf));
+        TRY(*writer++ = U"abc\n");
+        TRY(load_file(testfile, s));
+        TEST_EQUAL(s, "abc\n");
+        TRY(*writer++ = U"de\u0301f\n");
+        TRY(load_file(testfile, s));
+        TEST_EQUAL(s, u8"abc\nd\u00e9f\n");
+        TRY(writer = FileWriter());
+
+        TEST_THROW(FileWriter(testfile, io_nfkc | io_nfkd), std::invalid_argument);
+
     }
 
 }
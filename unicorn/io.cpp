@@ -1,6 +1,7 @@
 #include "unicorn/io.hpp"
 #include "unicorn/format.hpp"
 #include "unicorn/mbcs.hpp"
+#include "unicorn/normal.hpp"
 #include "unicorn/string.hpp"
 #include <algorithm>
 #include <cerrno>
@@ -18,6 +19,19 @@ namespace Unicorn {
         void checked_fclose(FILE* f) { if (f) fclose(f); }
         template <typename C> u8string quote_file(const basic_string<C>& name) { return quote(to_utf8(name), true); }
 
+        constexpr uint32_t io_normal_flags = io_nfc | io_nfd | io_nfkc | io_nfkd;
+
+        NormalizationForm io_normal_form(uint32_t flags) noexcept {
+            if (flags & io_nfd)
+                return NFD;
+            else if (flags & io_nfkc)
+                return NFKC;
+            else if (flags & io_nfkd)
+                return NFKD;
+            else
+                return NFC;
+        }
+
         SharedFile shared_fopen(const NativeString& file, const NativeString& mode, bool check) {
             FILE* f =
                 #if defined(PRI_TARGET_UNIX)
@@ -69,7 +83,8 @@ namespace Unicorn {
     void FileReader::init(const NativeString& file, uint32_t flags, const u8string& enc, const u8string& eol) {
         static const NativeString dashfile = PRI_CSTR("-", NativeCharacter);
         if (bits_set(flags & (err_replace | err_throw)) > 1
-                || bits_set(flags & (io_crlf | io_lf | io_striplf | io_striptws | io_stripws)) > 1)
+                || bits_set(flags & (io_crlf | io_lf | io_striplf | io_striptws | io_stripws)) > 1
+                || bits_set(flags & io_normal_flags) > 1)
             throw std::invalid_argument("Inconsistent file I/O flags");
         impl = make_shared<impl_type>();
         impl->name = file;
@@ -136,6 +151,8 @@ namespace Unicorn {
         if (impl->flags & (io_lf | io_crlf | io_striplf | io_striptws | io_stripws))
             encoded.resize(eolpos);
         import_string(encoded, impl->line8, impl->enc, impl->flags & (err_replace | err_throw));
+        if (impl->flags & io_normal_flags)
+            normalize_in(impl->line8, io_normal_form(impl->flags));
         fixline();
         ++impl->lines;
     }
@@ -161,11 +178,42 @@ namespace Unicorn {
         u8string enc;
         SharedFile handle;
         shared_ptr<Mutex> mutex;
+        unique_ptr<Normalizer<char>> norm;
+        ~impl_type() noexcept;
     };
 
+    FileWriter::impl_type::~impl_type() noexcept {
+        // Anything the normalizer is still holding back has to be written
+        // before the file is closed; there is nowhere to report errors
+        if (! norm || ! handle)
+            return;
+        try {
+            u8string str = wrbuf;
+            norm->finish(str);
+            if (str.empty())
+                return;
+            if ((flags & io_bom) && str_first_char(str) != byte_order_mark)
+                str.insert(0, utf8_bom);
+            string encoded;
+            export_string(str, encoded, enc, flags & (err_replace | err_throw));
+            if (mutex) {
+                MutexLock lock(*mutex);
+                fwrite(encoded.data(), 1, encoded.size(), handle.get());
+            } else {
+                fwrite(encoded.data(), 1, encoded.size(), handle.get());
+            }
+        }
+        catch (...) {}
+    }
+
     void FileWriter::flush() {
         if (! impl)
             throw std::system_error(std::make_error_code(std::errc::bad_file_descriptor));
+        if (impl->norm && impl->norm->pending() > 0) {
+            u8string str;
+            impl->norm->finish(str);
+            write_text(str);
+        }
         if (fflush(impl->handle.get()) == EOF) {
             int err = errno;
             throw std::system_error(err, std::generic_category(), quote_file(impl->name));
@@ -180,7 +228,8 @@ namespace Unicorn {
                 || bits_set(flags & (io_autoline | io_writeline)) > 1
                 || bits_set(flags & (io_crlf | io_lf)) > 1
                 || bits_set(flags & (io_linebuf | io_unbuf)) > 1
-                || bits_set(flags & (io_stderr | io_stdout)) > 1)
+                || bits_set(flags & (io_stderr | io_stdout)) > 1
+                || bits_set(flags & io_normal_flags) > 1)
             throw std::invalid_argument("Inconsistent file I/O flags");
         impl = make_shared<impl_type>();
         impl->name = file;
@@ -203,6 +252,8 @@ namespace Unicorn {
             else
                 impl->mutex = make_shared<Mutex>();
         }
+        if (flags & io_normal_flags)
+            impl->norm = make_unique<Normalizer<char>>(io_normal_form(flags));
     }
 
     void FileWriter::fixtext(u8string& str) const {
@@ -227,6 +278,15 @@ namespace Unicorn {
         if (! impl)
             throw std::system_error(std::make_error_code(std::errc::bad_file_descriptor));
         fixtext(str);
+        if (impl->norm) {
+            u8string norm;
+            impl->norm->feed(str, norm);
+            str.swap(norm);
+        }
+        write_text(str);
+    }
+
+    void FileWriter::write_text(u8string& str) {
         if (impl->flags & io_linebuf) {
             str.insert(0, impl->wrbuf);
             impl->wrbuf.clear();
@@ -267,8 +327,10 @@ namespace Unicorn {
         auto err = errno;
         if (ferror(impl->handle.get()))
             throw std::system_error(err, std::generic_category(), quote_file(impl->name));
-        if (impl->flags & (io_linebuf | io_unbuf))
-            flush();
+        if ((impl->flags & (io_linebuf | io_unbuf)) && fflush(impl->handle.get()) == EOF) {
+            err = errno;
+            throw std::system_error(err, std::generic_category(), quote_file(impl->name));
+        }
     }
 
 }
@@ -41,6 +41,13 @@ namespace Unicorn {
     constexpr uint32_t io_autoline   = 1ul << 18;  // Write LF if not already there
     constexpr uint32_t io_mutex      = 1ul << 19;  // Hold per-file mutex while writing
 
+    // Normalization flags (reader and writer)
+
+    constexpr uint32_t io_nfc        = 1ul << 20;  // Normalize to NFC
+    constexpr uint32_t io_nfd        = 1ul << 21;  // Normalize to NFD
+    constexpr uint32_t io_nfkc       = 1ul << 22;  // Normalize to NFKC
+    constexpr uint32_t io_nfkd       = 1ul << 23;  // Normalize to NFKD
+
     // File input iterator
 
     class FileReader:
@@ -113,6 +120,7 @@ namespace Unicorn {
         void init(const NativeString& file, uint32_t flags, const u8string& enc);
         void fixtext(u8string& str) const;
         void write(u8string str);
+        void write_text(u8string& str);
         void writembcs(const string& str);
     };
 
@@ -146,24 +146,6 @@ namespace Unicorn {
             }
         }
 
-        bool big_endian() noexcept {
-            static constexpr uint16_t x = 1;
-            return *reinterpret_cast<const uint8_t*>(&x) == 0;
-        }
-
-        char16_t reverse_char16(char16_t c) {
-            auto p = reinterpret_cast<uint8_t*>(&c);
-            std::swap(p[0], p[1]);
-            return c;
-        }
-
-        char32_t reverse_char32(char32_t c) {
-            auto p = reinterpret_cast<uint8_t*>(&c);
-            std::swap(p[0], p[3]);
-            std::swap(p[1], p[2]);
-            return c;
-        }
-
         UnicornDetail::EncodingTag find_encoding(const u8string& name) {
             using namespace UnicornDetail;
             static const CharsetMap map;
@@ -180,9 +162,9 @@ namespace Unicorn {
                 u8string m1 = match[1], m2 = match[2];
                 bool swap = false;
                 if (m2 == "be")
-                    swap = ! big_endian();
+                    swap = ! UnicornDetail::native_big_endian();
                 else if (m2 == "le")
-                    swap = big_endian();
+                    swap = UnicornDetail::native_big_endian();
                 else if (m2 == "swapped")
                     swap = true;
                 if (m1 == "utf8")
@@ -531,35 +513,20 @@ namespace Unicorn {
 
         #endif
 
+        ByteOrder tag_byte_order(EncodingTag tag) {
+            bool big = native_big_endian() != (tag == utf16swap_tag || tag == utf32swap_tag);
+            return big ? ByteOrder::big_endian : ByteOrder::little_endian;
+        }
+
         bool utf_import(const string& src, NativeString& dst, EncodingTag tag, uint32_t flags) {
             if (tag == utf8_tag) {
                 recode(src, dst, flags);
                 return true;
             } else if (tag == utf16_tag || tag == utf16swap_tag) {
-                auto extra = src.size() % 2;
-                if (extra && (flags & err_throw))
-                    throw EncodingError("UTF-16", src.size() - extra,
-                        src.data() + src.size() - extra, extra);
-                u16string src16(src.size() / 2, 0);
-                memcpy(&src16[0], src.data(), src.size());
-                if (tag == utf16swap_tag)
-                    std::transform(src16.begin(), src16.end(), src16.begin(), reverse_char16);
-                if (extra)
-                    src16 += char16_t(replacement_char);
-                recode(src16, dst, flags);
+                recode_from_bytes<char16_t>(src.data(), src.size(), tag_byte_order(tag), dst, flags);
                 return true;
             } else if (tag == utf32_tag || tag == utf32swap_tag) {
-                auto extra = src.size() % 4;
-                if (extra && (flags & err_throw))
-                    throw EncodingError("UTF-32", src.size() - extra,
-                        src.data() + src.size() - extra, extra);
-                u32string src32(src.size() / 4, 0);
-                memcpy(&src32[0], src.data(), src.size());
-                if (tag == utf32swap_tag)
-                    std::transform(src32.begin(), src32.end(), src32.begin(), reverse_char32);
-                if (extra)
-                    src32 += char16_t(replacement_char);
-                recode(src32, dst, flags);
+                recode_from_bytes<char32_t>(src.data(), src.size(), tag_byte_order(tag), dst, flags);
                 return true;
             } else {
                 return false;
@@ -571,20 +538,10 @@ namespace Unicorn {
                 recode(src, dst, flags);
                 return true;
             } else if (tag == utf16_tag || tag == utf16swap_tag) {
-                u16string dst16;
-                recode(src, dst16, flags);
-                if (tag == utf16swap_tag)
-                    std::transform(dst16.begin(), dst16.end(), dst16.begin(), reverse_char16);
-                dst.resize(2 * dst16.size());
-                memcpy(&dst[0], dst16.data(), dst.size());
+                recode_to_bytes<char16_t>(src, tag_byte_order(tag), dst, flags);
                 return true;
             } else if (tag == utf32_tag || tag == utf32swap_tag) {
-                u32string dst32;
-                recode(src, dst32, flags);
-                if (tag == utf32swap_tag)
-                    std::transform(dst32.begin(), dst32.end(), dst32.begin(), reverse_char32);
-                dst.resize(4 * dst32.size());
-                memcpy(&dst[0], dst32.data(), dst.size());
+                recode_to_bytes<char32_t>(src, tag_byte_order(tag), dst, flags);
                 return true;
             } else {
                 return false;
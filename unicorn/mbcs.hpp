@@ -54,6 +54,21 @@ namespace Unicorn {
         bool utf_import(const string& src, NativeString& dst, EncodingTag tag, uint32_t flags);
         bool utf_export(const NativeString& src, string& dst, EncodingTag tag, uint32_t flags);
 
+        // Importing into the native string type writes straight into the
+        // destination, reusing its capacity.
+
+        inline void import_native(const string& src, NativeString& dst, EncodingTag tag, uint32_t flags) {
+            if (! utf_import(src, dst, tag, flags))
+                native_import(src, dst, tag, flags);
+        }
+
+        template <typename C>
+        void import_native(const string& src, basic_string<C>& dst, EncodingTag tag, uint32_t flags) {
+            NativeString native_dst;
+            import_native(src, native_dst, tag, flags);
+            recode(native_dst, dst);
+        }
+
         template <typename C, typename E>
         void import_string_helper(const string& src, basic_string<C>& dst, E enc, uint32_t flags) {
             mbcs_flags(flags);
@@ -66,10 +81,7 @@ namespace Unicorn {
                 import_string_helper(src, dst, guess_utf(src), flags);
                 return;
             }
-            NativeString native_dst;
-            if (! utf_import(src, native_dst, tag, flags))
-                native_import(src, native_dst, tag, flags);
-            recode(native_dst, dst);
+            import_native(src, dst, tag, flags);
         }
 
         template <typename C, typename E>
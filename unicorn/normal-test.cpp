@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <cstdlib>
 #include <memory>
+#include <random>
 #include <string>
 #include <utility>
 
@@ -18,6 +19,7 @@ using namespace Unicorn;
         type mode ## index; \
         TRY(mode ## index = normalize(col[index], mode)); \
         TEST_EQUAL(mode ## index, col[expect]); \
+        TEST_EQUAL(is_normalized(col[index], mode), col[index] == col[expect]); \
         if (mode ## index != col[expect]) \
             FAIL("Normalization test " + dec(line) + ": " + str_join(row, ";")); \
     } while(false)
@@ -57,6 +59,10 @@ using namespace Unicorn;
         TEST_EQUAL(normalize(s, NFD), s); \
         TEST_EQUAL(normalize(s, NFKC), s); \
         TEST_EQUAL(normalize(s, NFKD), s); \
+        TEST(is_normalized(s, NFC)); \
+        TEST(is_normalized(s, NFD)); \
+        TEST(is_normalized(s, NFKC)); \
+        TEST(is_normalized(s, NFKD)); \
     } while (false)
 
 namespace {
@@ -101,10 +107,393 @@ namespace {
         }
     }
 
+    void check_quick_check() {
+
+        using namespace UnicornDetail;
+
+        u8string s8;
+        u16string s16;
+
+        TEST(is_normalized(u8""s, NFC));
+        TEST(is_normalized(u8"Hello world"s, NFD));
+        TEST(is_normalized(u8"\u00e9t\u00e9"s, NFC));
+        TEST(! is_normalized(u8"\u00e9t\u00e9"s, NFD));
+        TEST(! is_normalized(u8"e\u0301te\u0301"s, NFC));
+        TEST(is_normalized(u8"e\u0301te\u0301"s, NFD));
+        TEST(is_normalized(u8"\ufb01"s, NFC));
+        TEST(! is_normalized(u8"\ufb01"s, NFKC));
+        TEST(! is_normalized(u8"a\u0323\u0301\u0300\u0316"s, NFD));
+        TEST(is_normalized(u8"a\u0316\u0323\u0301\u0300"s, NFD));
+        TEST(! is_normalized(u8"\xff"s, NFC));
+        TEST(! is_normalized(u"\xd800"s, NFC));
+
+        TEST_EQUAL(int(quick_check(u8"abc\u00e9"s.data(), 5, NFC)), int(QuickCheck::yes));
+        TEST_EQUAL(int(quick_check(u8"abc\u0301"s.data(), 5, NFC)), int(QuickCheck::maybe));
+        TEST_EQUAL(int(quick_check(u8"abc\u0301"s.data(), 5, NFD)), int(QuickCheck::yes));
+        TEST_EQUAL(int(quick_check(u8"\u0340"s.data(), 2, NFC)), int(QuickCheck::no));
+        TEST_EQUAL(int(quick_check(u"\u1100\u1161"s.data(), 2, NFC)), int(QuickCheck::maybe));
+        TEST_EQUAL(int(quick_check(u"\uac00"s.data(), 1, NFC)), int(QuickCheck::yes));
+        TEST_EQUAL(int(quick_check(u"\uac00"s.data(), 1, NFD)), int(QuickCheck::no));
+
+        // A maybe needs the full check to decide
+
+        TEST(! is_normalized(u8"e\u0301"s, NFC));
+        TEST(is_normalized(u8"x\u0301"s, NFC));
+
+        // Normalized input comes back unchanged, and normalize_in() leaves it alone
+
+        s8 = u8"Hello \u00e9t\u00e9 world";
+        auto data = s8.data();
+        TRY(normalize_in(s8, NFC));
+        TEST_EQUAL(s8, u8"Hello \u00e9t\u00e9 world");
+        TEST(s8.data() == data);
+        TEST_EQUAL(normalize(s8, NFC), s8);
+        TEST_EQUAL(normalize(std::move(s8), NFD), u8"Hello e\u0301te\u0301 world");
+
+        s16 = u"Hello e\u0301te\u0301 world";
+        TRY(normalize_in(s16, NFC));
+        TEST_EQUAL(s16, u"Hello \u00e9t\u00e9 world");
+
+    }
+
+    // Straightforward versions of the reordering and composition steps
+
+    void reference_ordering(u32string& str) {
+        auto cc = [] (char32_t c) { return combining_class(c); };
+        auto i = str.begin(), j = i, e = str.end();
+        while (j != e) {
+            i = std::find_if(j, e, cc);
+            if (i == e)
+                break;
+            j = std::find_if_not(i, e, cc);
+            std::stable_sort(i, j, [=] (char32_t a, char32_t b) { return cc(a) < cc(b); });
+        }
+    }
+
+    void reference_composition(u32string& str) {
+        for (size_t i = 0; i < str.size(); ++i) {
+            if (combining_class(str[i]))
+                continue;
+            int prev_cc = 0;
+            for (size_t j = i + 1; j < str.size(); ++j) {
+                int cc = combining_class(str[j]);
+                if (prev_cc == 0 || prev_cc < cc) {
+                    char32_t c = canonical_composition(str[i], str[j]);
+                    if (c) {
+                        str[i] = c;
+                        str.erase(j, 1);
+                        --j;
+                        continue;
+                    }
+                }
+                if (cc == 0)
+                    break;
+                prev_cc = cc;
+            }
+        }
+    }
+
+    void check_long_sequences() {
+
+        // Random mixtures of starters and combining marks, including runs
+        // of marks too long for the insertion sort
+
+        static const u32string pool = U"aeouAEOUn\u0300\u0301\u0302\u0303\u0308\u0316\u0323\u0327\u0328\u031b"
+            U"\u0345\u05b0\u0f71\u1100\u1161\u11a8\u3099";
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<size_t> length(0, 100), pick(0, pool.size() - 1), starter(0, 9);
+        u32string src, expect;
+
+        for (int i = 0; i < 1000; ++i) {
+            src.clear();
+            bool long_run = i % 10 == 0;
+            for (size_t j = length(rng); j > 0; --j) {
+                char32_t c = pool[pick(rng)];
+                if (long_run && combining_class(c) == 0 && starter(rng) != 0)
+                    continue;
+                src += c;
+            }
+            expect = src;
+            reference_ordering(expect);
+            TEST_EQUAL(normalize(src, NFD), expect);
+            reference_composition(expect);
+            TEST_EQUAL(normalize(src, NFC), expect);
+        }
+
+        src = U"a" + u32string(1000, 0x301) + u32string(1000, 0x316);
+        expect = U"\u00e1" + u32string(1000, 0x316) + u32string(999, 0x301);
+        TEST_EQUAL(normalize(src, NFC), expect);
+        src.clear();
+        for (int i = 0; i < 1000; ++i)
+            src += U"\u1100\u1161\u11a8";
+        TEST_EQUAL(normalize(src, NFC), u32string(1000, 0xac01));
+
+    }
+
+    // Normalization through a full UTF-32 copy of the string
+
+    template <typename C>
+    basic_string<C> reference_normalize(const basic_string<C>& src, NormalizationForm form) {
+        using namespace UnicornDetail;
+        u32string utf32;
+        apply_decomposition(src, utf32, form == NFKC || form == NFKD);
+        apply_ordering(utf32);
+        if (form == NFC || form == NFKC)
+            apply_composition(utf32);
+        return recode<C>(utf32);
+    }
+
+    // The fully expanded tables must match recursive decomposition
+
+    void expand_decomposition(char32_t c, u32string& dst, bool k) {
+        char32_t buf[max_compatibility_decomposition];
+        size_t n = k ? compatibility_decomposition(c, buf) : canonical_decomposition(c, buf);
+        if (n == 0)
+            dst += c;
+        else
+            for (size_t i = 0; i < n; ++i)
+                expand_decomposition(buf[i], dst, k);
+    }
+
+    void check_full_decomposition() {
+
+        char32_t buf[UnicornDetail::max_full_decomposition];
+        size_t errors = 0;
+
+        for (bool k: {false, true}) {
+            for (char32_t c = 0; c <= 0x10ffff; ++c) {
+                u32string expect, full;
+                expand_decomposition(c, expect, k);
+                size_t n = UnicornDetail::full_decomposition(c, buf, k);
+                full = n == 0 ? u32string(1, c) : u32string(buf, n);
+                if (full != expect && ++errors <= 10)
+                    FAIL("Full decomposition of U+" + hex(c) + (k ? " (compatibility)" : ""));
+            }
+        }
+
+        TEST_EQUAL(errors, 0);
+        TEST_EQUAL(UnicornDetail::full_decomposition(0x1e69, buf, false), 3);
+        TEST_EQUAL(u32string(buf, 3), (u32string{'s',0x323,0x307}));
+        TEST_EQUAL(UnicornDetail::full_decomposition(0xd4db, buf, false), 3);
+        TEST_EQUAL(u32string(buf, 3), (u32string{0x1111,0x1171,0x11b6}));
+        TEST_EQUAL(UnicornDetail::full_decomposition(0xfdfa, buf, true), 18);
+        TEST_EQUAL(UnicornDetail::full_decomposition('A', buf, true), 0);
+
+    }
+
+    void check_direct_encoding() {
+
+        // Random text from every part of the code space, with enough
+        // combining marks and decomposable characters to need work
+
+        static const u32string marks = U"\u0300\u0301\u0308\u0316\u0323\u0327\u0345\u05b0\u0f71\u0f72\u3099";
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> kind(0, 9), length(0, 40), ascii(0x20, 0x7e);
+        std::uniform_int_distribution<char32_t> bmp(0xa0, 0xffff), astral(0x10000, 0x10ffff);
+        std::uniform_int_distribution<size_t> mark(0, marks.size() - 1);
+        u32string src;
+        u8string s8;
+        u16string s16;
+        wstring sw;
+
+        for (int i = 0; i < 3000; ++i) {
+            src.clear();
+            for (int j = length(rng); j > 0; --j) {
+                char32_t c;
+                switch (kind(rng)) {
+                    case 0: case 1: case 2:  c = marks[mark(rng)]; break;
+                    case 3: case 4:          c = astral(rng); break;
+                    case 5: case 6:          c = char32_t(ascii(rng)); break;
+                    default:                 c = bmp(rng); break;
+                }
+                if (char_is_unicode(c))
+                    src += c;
+            }
+            recode(src, s8);
+            recode(src, s16);
+            recode(src, sw);
+            for (auto form: {NFC, NFD, NFKC, NFKD}) {
+                TEST_EQUAL(normalize(s8, form), reference_normalize(s8, form));
+                TEST_EQUAL(normalize(s16, form), reference_normalize(s16, form));
+                TEST_EQUAL(normalize(src, form), reference_normalize(src, form));
+                TEST(normalize(sw, form) == reference_normalize(sw, form));
+            }
+        }
+
+        // Unchanged text around a segment that needs work is copied as it is
+
+        TEST_EQUAL(normalize(u8"Hello e\u0301 world"s, NFC), u8"Hello \u00e9 world");
+        TEST_EQUAL(normalize(u8"\u00e9t\u00e9 a\u0316\u0301 \u00e9t\u00e9"s, NFC), u8"\u00e9t\u00e9 \u00e1\u0316 \u00e9t\u00e9");
+        TEST_EQUAL(normalize(u"\u4e00\u1100\u1161\u11a8\u4e00"s, NFC), u"\u4e00\uac01\u4e00");
+        TEST_EQUAL(normalize(U"x\U0001d15e\U0001d165y"s, NFD), U"x\U0001d157\U0001d165\U0001d165y");
+
+        // Invalid encoding goes through the general algorithm
+
+        for (auto form: {NFC, NFD, NFKC, NFKD}) {
+            TEST_EQUAL(normalize(u8"e\u0301\xff"s, form), reference_normalize(u8"e\u0301\xff"s, form));
+            TEST_EQUAL(normalize(u"e\u0301\xd800"s, form), reference_normalize(u"e\u0301\xd800"s, form));
+        }
+
+    }
+
+    template <typename C>
+    basic_string<C> stream_normalize(const basic_string<C>& src, NormalizationForm form, const vector<size_t>& chunks) {
+        Normalizer<C> norm(form);
+        basic_string<C> dst;
+        size_t pos = 0;
+        for (auto n: chunks) {
+            n = std::min(n, src.size() - pos);
+            norm.feed(src.data() + pos, n, dst);
+            pos += n;
+        }
+        norm.feed(src.substr(pos), dst);
+        norm.finish(dst);
+        return dst;
+    }
+
+    void check_streaming() {
+
+        static const vector<u32string> samples = {
+            U"",
+            U"Hello world",
+            U"\u00e9t\u00e9 e\u0301te\u0301",
+            U"a\u0323\u0301\u0300\u0316b\u0328\u0301",
+            U"\u1100\u1161\u11a8\u1100\u1161\uac00\u11a8",
+            U"\u212b\u2126\u0958\u0f73\u0f71\u0f72\u0344",
+            U"\ufb01\uff9e\u3162\u1161\u0345\u0301",
+            U"x\U0001d15e\U0001d165\U0001d16e\U00011099\U000110ba",
+        };
+
+        vector<size_t> chunks;
+
+        // Every split into two chunks, and one code unit at a time
+
+        for (auto& sample: samples) {
+            u8string s8 = to_utf8(sample);
+            u16string s16 = to_utf16(sample);
+            for (auto form: {NFC, NFD, NFKC, NFKD}) {
+                for (size_t i = 0; i <= s8.size(); ++i)
+                    TEST_EQUAL(stream_normalize(s8, form, {i}), normalize(s8, form));
+                for (size_t i = 0; i <= s16.size(); ++i)
+                    TEST_EQUAL(stream_normalize(s16, form, {i}), normalize(s16, form));
+                for (size_t i = 0; i <= sample.size(); ++i)
+                    TEST_EQUAL(stream_normalize(sample, form, {i}), normalize(sample, form));
+                chunks.assign(s8.size(), 1);
+                TEST_EQUAL(stream_normalize(s8, form, chunks), normalize(s8, form));
+            }
+        }
+
+        // The whole of the normalization test data in random chunks
+
+        u32string text;
+        for (auto& row: normalization_test_table) {
+            vector<u8string> hexcodes;
+            str_split(u8string(row[0]), overwrite(hexcodes));
+            for (auto& hc: hexcodes)
+                text += char32_t(strtoul(hc.data(), nullptr, 16));
+            text += U' ';
+        }
+        u8string text8 = to_utf8(text);
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<size_t> length(1, 100);
+        chunks.clear();
+        for (size_t n = 0; n < text8.size(); n += chunks.back())
+            chunks.push_back(length(rng));
+        for (auto form: {NFC, NFD, NFKC, NFKD})
+            TEST_EQUAL(stream_normalize(text8, form, chunks), normalize(text8, form));
+
+        // Only the last segment is held back
+
+        Normalizer<char> norm8;
+        u8string out8;
+        TEST_EQUAL(norm8.form(), NFC);
+        TRY(norm8.feed(u8"Hello world. e"s, out8));
+        TEST_EQUAL(out8, u8"Hello world. ");
+        TEST_EQUAL(norm8.pending(), 1);
+        TRY(norm8.feed(u8"\u0301t\u00e9 \xcc"s, out8));
+        TEST_EQUAL(out8, u8"Hello world. \u00e9t\u00e9 ");
+        TEST_EQUAL(norm8.pending(), 1);
+        TRY(norm8.feed(u8"\x81"s, out8));
+        TEST_EQUAL(out8, u8"Hello world. \u00e9t\u00e9 ");
+        TEST_EQUAL(norm8.pending(), 2);
+        TRY(norm8.finish(out8));
+        TEST_EQUAL(out8, u8"Hello world. \u00e9t\u00e9 \u0301");
+        TEST_EQUAL(norm8.pending(), 0);
+
+        Normalizer<char16_t> norm16(NFD);
+        u16string out16;
+        TEST_EQUAL(norm16.form(), NFD);
+        for (int i = 0; i < 1000; ++i) {
+            TRY(norm16.feed(u"\u00e9t\u00e9 ", out16));
+            TEST_COMPARE(norm16.pending(), <=, 2);
+        }
+        TRY(norm16.finish(out16));
+        TEST_EQUAL(out16.size(), 6000);
+        TEST(is_normalized(out16, NFD));
+
+        // Nothing is held back after an ASCII character that cannot compose
+        // with what follows it
+
+        out8.clear();
+        TRY(norm8.feed(u8"abc\n", out8));
+        TEST_EQUAL(out8, u8"abc\n");
+        TEST_EQUAL(norm8.pending(), 0);
+        TRY(norm8.feed(u8"x<", out8));
+        TEST_EQUAL(out8, u8"abc\nx");
+        TEST_EQUAL(norm8.pending(), 1);
+        TRY(norm8.feed(u8"\u0338", out8));
+        TRY(norm8.finish(out8));
+        TEST_EQUAL(out8, u8"abc\nx\u226e");
+        Normalizer<char> nfd8(NFD);
+        out8.clear();
+        TRY(nfd8.feed(u8"abc", out8));
+        TEST_EQUAL(out8, u8"abc");
+        TEST_EQUAL(nfd8.pending(), 0);
+
+        for (auto& entry: UnicornDetail::composition_table)
+            if (entry.key[0] <= last_ascii_char)
+                TEST(ascii_isalpha(char(entry.key[0])) || (entry.key[0] >= U'<' && entry.key[0] <= U'>'));
+
+        // Stream-safe format limits the length of a segment
+
+        Normalizer<char32_t> norm32;
+        u32string out32;
+        TRY(norm32.feed(U"a", out32));
+        for (int i = 0; i < 100; ++i) {
+            TRY(norm32.feed(U"\u0301", out32));
+            TEST_COMPARE(norm32.pending(), <=, 32);
+        }
+        TRY(norm32.finish(out32));
+        TEST_EQUAL(out32, U"\u00e1" + u32string(29, 0x301) + U"\u034f" + u32string(30, 0x301)
+            + U"\u034f" + u32string(30, 0x301) + U"\u034f" + u32string(10, 0x301));
+
+        // Non-starters are counted in the compatibility decomposition
+
+        out32 = stream_normalize(U"\u00e1" + u32string(30, 0x301), NFC, {});
+        TEST_EQUAL(out32, U"\u00e1" + u32string(29, 0x301) + U"\u034f\u0301");
+        out32 = stream_normalize(u32string(29, 0x301) + U"\u0344", NFC, {});
+        TEST_EQUAL(out32, u32string(29, 0x301) + U"\u034f\u0308\u0301");
+        out32 = stream_normalize(u32string(28, 0x301) + U"\u0344", NFC, {});
+        TEST_EQUAL(out32, u32string(28, 0x301) + U"\u0308\u0301");
+
+        u32string jamo(1000, 0x1161);
+        out32 = stream_normalize(jamo, NFC, {});
+        TEST_EQUAL(out32.size(), 1007);
+        TEST_EQUAL(std::count(out32.begin(), out32.end(), 0x34f), 7);
+        TEST_EQUAL(out32.substr(0, 129), u32string(128, 0x1161) + U"\u034f");
+
+    }
+
 }
 
 TEST_MODULE(unicorn, normal) {
 
+    check_quick_check();
+    check_long_sequences();
+    check_full_decomposition();
+    check_direct_encoding();
+    check_streaming();
+
     auto norm_tests = range_count(normalization_test_table);
     vector<char32_t> identity_chars;
     for (auto&& row: normalization_identity_table)
@@ -9,7 +9,8 @@ Unicode Standard Annex #15, "Unicode Normalization Forms"
 Step 1: Decompose any decomposable characters. For NFC and NFD, apply only
 canonical decompositions; for NFKC and NFKD, also apply compatibility
 decompositions. Decompose characters recursively until no more decompositions
-are possible.
+are possible. The tables generated from the UCD hold these fully expanded
+decompositions, so each character needs only one lookup.
 
 Step 2: For each contiguous subsequence of non-starter characters, sort the
 characters into ascending order by canonical combining class. Characters with
@@ -20,12 +21,31 @@ canonical composing pair, replace the first with the composed character and
 delete the second. A pair need not be adjacent to be composable, if the
 characters between them are all non-starters with a lower combining class than
 the second of the pair. Compose characters recursively until no more
-compositions are possible.
+compositions are possible. This is done in a single pass, keeping track of the
+last starter and copying the characters that are not absorbed into it down to
+an output position in the same string. Composing pairs are looked up in a
+perfect hash table keyed on the pair.
+
+Before any of this, the quick check algorithm from UAX #15 is run over the
+string; most text is already normalized, and is returned unchanged without
+going through the three steps above. Otherwise the string is processed one
+segment at a time in its own encoding, normalizing only the segments that
+contain characters that fail the quick check and copying the rest.
+
+The streaming normalizer buffers its input and normalizes everything up to
+the last stable starter each time a chunk arrives. A stable starter is a
+character with combining class zero that quick checks as yes, or whose
+decomposition starts with such a character; nothing before it can be reordered
+past it or composed with it, so the text on each side of it can be normalized
+separately. Stream-safe text (UAX #15) never has more than 30 non-starters in
+a row, so the buffer only needs to hold one segment of bounded length.
 
 */
 
 #include "unicorn/normal.hpp"
+#include "unicorn/ucd-tables.hpp"
 #include <algorithm>
+#include <vector>
 
 using namespace std::literals;
 
@@ -33,48 +53,424 @@ namespace Unicorn {
 
     namespace UnicornDetail {
 
-        void apply_ordering(u32string& str) {
-            auto i = str.begin(), j = i, e = str.end();
-            while (j != e) {
-                i = std::find_if(j, e, combining_class);
-                if (i == e)
-                    break;
-                j = std::find_if_not(i, e, combining_class);
-                std::stable_sort(i, j, [] (char32_t a, char32_t b)
-                    { return combining_class(a) < combining_class(b); });
+        namespace {
+
+            int ccc(char32_t c) noexcept { return char_properties(c).combining_class; }
+
+            // Runs of non-starters are nearly always short enough for an
+            // insertion sort, looking up each combining class only once;
+            // longer runs (only likely in hostile input) are counting sorted
+            // on the combining class, with the class packed into the top
+            // byte of each character, to avoid quadratic time.
+
+            constexpr size_t max_insertion_sort = 32;
+
+            void insertion_sort(char32_t* chars, uint8_t* classes, size_t n) noexcept {
+                for (size_t i = 1; i < n; ++i) {
+                    auto c = chars[i];
+                    auto k = classes[i];
+                    size_t j = i;
+                    for (; j > 0 && classes[j - 1] > k; --j) {
+                        chars[j] = chars[j - 1];
+                        classes[j] = classes[j - 1];
+                    }
+                    chars[j] = c;
+                    classes[j] = k;
+                }
             }
-        }
 
-        void apply_composition(u32string& str) {
-            if (str.size() < 2)
-                return;
-            auto i = str.begin(), e = str.end();
-            while (i != e) {
-                i = std::find_if_not(i, e, combining_class);
-                if (i == e)
-                    break;
-                bool combined = false;
-                int prev_cc = 0;
-                for (auto j = i + 1; j != e; ++j) {
-                    int cc = combining_class(*j);
-                    if (prev_cc == 0 || prev_cc < cc) {
-                        char32_t c = canonical_composition(*i, *j);
-                        if (c) {
-                            *i = c;
-                            str.erase(j);
-                            combined = true;
-                            break;
+            void order_chars(char32_t* str, size_t n) {
+                uint8_t classes[max_insertion_sort];
+                size_t i = 0;
+                while (i < n) {
+                    int cc = ccc(str[i]);
+                    if (cc == 0) {
+                        ++i;
+                        continue;
+                    }
+                    size_t begin = i, len = 0;
+                    do {
+                        classes[len++] = uint8_t(cc);
+                        ++i;
+                        cc = i < n ? ccc(str[i]) : 0;
+                    } while (cc != 0 && len < max_insertion_sort);
+                    if (cc == 0) {
+                        insertion_sort(str + begin, classes, len);
+                        continue;
+                    }
+                    std::vector<uint32_t> run;
+                    run.reserve(n - begin);
+                    for (size_t k = 0; k < len; ++k)
+                        run.push_back(uint32_t(classes[k]) << 24 | str[begin + k]);
+                    for (; i < n && (cc = ccc(str[i])) != 0; ++i)
+                        run.push_back(uint32_t(cc) << 24 | str[i]);
+                    size_t offsets[256] = {};
+                    for (auto r: run)
+                        ++offsets[r >> 24];
+                    for (auto& o: offsets) {
+                        auto count = o;
+                        o = begin;
+                        begin += count;
+                    }
+                    for (auto r: run)
+                        str[offsets[r >> 24]++] = r & 0xffffff;
+                }
+            }
+
+            // Returns the new length
+
+            size_t compose_chars(char32_t* str, size_t n) noexcept {
+                if (n < 2)
+                    return n;
+                int last_cc = ccc(str[0]);
+                size_t starter = last_cc == 0 ? 0 : npos, out = 1;
+                for (size_t i = 1; i < n; ++i) {
+                    char32_t c = str[i];
+                    int cc = ccc(c);
+                    if (starter != npos && (last_cc < cc || last_cc == 0)) {
+                        char32_t composite = canonical_composition(str[starter], c);
+                        if (composite) {
+                            str[starter] = composite;
+                            continue;
                         }
                     }
                     if (cc == 0)
-                        break;
-                    prev_cc = cc;
+                        starter = out;
+                    last_cc = cc;
+                    str[out++] = c;
+                }
+                return out;
+            }
+
+            // Index tries over the fully expanded decomposition tables,
+            // generated by make-tables: zero for no decomposition, otherwise
+            // one more than the index into the short table, or with the top
+            // bit set, into the long table (for compatibility decompositions
+            // only).
+
+            constexpr uint16_t long_decomposition = 0x8000;
+
+            template <size_t N>
+            size_t copy_decomposition(const std::array<char32_t, N>& chars, char32_t* dst) noexcept {
+                size_t i = 0;
+                for (; i < N && chars[i]; ++i)
+                    dst[i] = chars[i];
+                return i;
+            }
+
+            // The quick check table, generated by make-tables from the UCD
+            // quick check properties, holds the combining class in the low
+            // byte, and the NFC_QC, NFD_QC, NFKC_QC, and NFKD_QC properties in
+            // two bits each above that.
+
+            constexpr uint16_t qc_no = 1;
+            constexpr uint16_t qc_maybe = 2;
+
+            int qc_shift(NormalizationForm form) noexcept { return 8 + 2 * int(form); }
+
+            const CharacterTrie<uint16_t>& quick_check_table() noexcept {
+                return quick_check_trie;
+            }
+
+            template <typename C>
+            QuickCheck quick_check_any(const C* src, size_t n, NormalizationForm form) noexcept {
+                if (utf_error_offset(src, n) != npos)
+                    return QuickCheck::no;
+                auto& table = quick_check_table();
+                int shift = qc_shift(form);
+                auto result = QuickCheck::yes;
+                unsigned last_cc = 0;
+                size_t pos = 0;
+                while (pos < n) {
+                    if (std::make_unsigned_t<C>(src[pos]) < 0x80) {
+                        if (sizeof(C) == 1)
+                            pos += ascii_span(reinterpret_cast<const char*>(src) + pos, n - pos);
+                        else
+                            ++pos;
+                        last_cc = 0;
+                        continue;
+                    }
+                    char32_t u = 0;
+                    pos += UtfEncoding<C>::decode_fast(src + pos, n - pos, u);
+                    auto value = table[u];
+                    unsigned cc = value & 0xff;
+                    if (cc != 0 && last_cc > cc)
+                        return QuickCheck::no;
+                    auto qc = (value >> shift) & 3;
+                    if (qc == qc_no)
+                        return QuickCheck::no;
+                    if (qc == qc_maybe)
+                        result = QuickCheck::maybe;
+                    last_cc = cc;
+                }
+                return result;
+            }
+
+            // A stable starter has combining class zero, cannot be the
+            // second half of a composition, and does not decompose into
+            // anything that starts with a character that could be.
+
+            bool stable_starter(char32_t c, uint16_t value, NormalizationForm form) noexcept {
+                bool k = form == NFKC || form == NFKD;
+                int shift = qc_shift(form);
+                char32_t buf[max_compatibility_decomposition];
+                for (;;) {
+                    if ((value & 0xff) != 0)
+                        return false;
+                    auto qc = (value >> shift) & 3;
+                    if (qc != qc_no)
+                        return qc == 0;
+                    if ((k ? compatibility_decomposition(c, buf) : canonical_decomposition(c, buf)) == 0)
+                        return false;
+                    c = buf[0];
+                    value = quick_check_table()[c];
+                }
+            }
+
+            // ASCII characters that can be the first half of a canonical
+            // composition: the letters, and "<", "=", and ">" (with U+0338
+            // COMBINING LONG SOLIDUS OVERLAY). The normalization stability
+            // policy means that no more can be added. Any other ASCII
+            // character ends a segment for every form, and so does any ASCII
+            // character for the decomposed forms, since nothing that follows
+            // a starter can reorder in front of it.
+
+            constexpr bool ascii_composes(char32_t c) noexcept {
+                return (c >= U'A' && c <= U'Z') || (c >= U'a' && c <= U'z') || (c >= U'<' && c <= U'>');
+            }
+
+            // The stream-safe text format counts non-starters in the
+            // compatibility decomposition of each character: the leading
+            // ones continue the current run, the trailing ones start a new
+            // one, and a character that decomposes entirely into
+            // non-starters extends the run by its whole length. Returns the
+            // length of the decomposition.
+
+            size_t stream_safe_counts(char32_t c, uint16_t value, size_t& leading, size_t& trailing) noexcept {
+                if (((value >> qc_shift(NFKD)) & 3) == 0) {
+                    leading = trailing = (value & 0xff) == 0 ? 0 : 1;
+                    return 1;
+                }
+                char32_t buf[max_full_decomposition];
+                size_t n = full_decomposition(c, buf, true);
+                if (n == 0) {
+                    buf[0] = c;
+                    n = 1;
+                }
+                for (leading = 0; leading < n && ccc(buf[leading]) != 0; ++leading) {}
+                for (trailing = 0; trailing < n && ccc(buf[n - trailing - 1]) != 0; ++trailing) {}
+                return n;
+            }
+
+            template <typename C>
+            void normalizer_scan_any(basic_string<C>& buf, NormalizerScan& scan, NormalizationForm form) {
+                auto& table = quick_check_table();
+                bool composed = form == NFC || form == NFKC;
+                size_t pos = scan.pos, end = buf.size() - utf_incomplete_tail(buf.data(), buf.size());
+                while (pos < end) {
+                    if (std::make_unsigned_t<C>(buf[pos]) < 0x80) {
+                        if (sizeof(C) == 1)
+                            pos += ascii_span(reinterpret_cast<const char*>(buf.data()) + pos, end - pos);
+                        else
+                            ++pos;
+                        scan.boundary = composed && ascii_composes(char32_t(buf[pos - 1])) ? pos - 1 : pos;
+                        scan.nonstarters = 0;
+                        scan.segment = 1;
+                        continue;
+                    }
+                    char32_t u = 0;
+                    size_t len = UtfEncoding<C>::decode(buf.data() + pos, end - pos, u);
+                    bool valid = char_is_unicode(u);
+                    uint16_t value = valid ? table[u] : 0;
+                    bool stable = valid && stable_starter(u, value, form);
+                    size_t leading = 0, trailing = 0, count = valid ? stream_safe_counts(u, value, leading, trailing) : 1;
+                    if (! stable && (scan.segment >= max_stream_segment || scan.nonstarters + leading > max_stream_nonstarters)) {
+                        C cgj[UtfEncoding<C>::max_units];
+                        size_t n = UtfEncoding<C>::encode(0x34f, cgj);
+                        buf.insert(pos, cgj, n);
+                        scan.boundary = pos;
+                        scan.nonstarters = 0;
+                        scan.segment = 1;
+                        pos += n;
+                        end += n;
+                    }
+                    scan.nonstarters = leading == count ? scan.nonstarters + count : trailing;
+                    if (stable) {
+                        scan.boundary = pos;
+                        scan.segment = 1;
+                    } else {
+                        ++scan.segment;
+                    }
+                    pos += len;
+                }
+                scan.pos = pos;
+            }
+
+            // Characters of one segment being normalized; only very long
+            // segments spill onto the heap.
+
+            class SegmentBuffer {
+            public:
+                char32_t* data() noexcept { return ptr; }
+                size_t size() const noexcept { return len; }
+                void clear() noexcept { len = 0; }
+                void push_back(char32_t c) {
+                    if (len == cap)
+                        grow(2 * cap);
+                    ptr[len++] = c;
+                }
+                void reserve(size_t n) {
+                    if (n > cap)
+                        grow(n);
+                }
+            private:
+                static constexpr size_t local_size = 256;
+                char32_t local[local_size];
+                u32string heap;
+                char32_t* ptr = local;
+                size_t len = 0;
+                size_t cap = local_size;
+                void grow(size_t n) {
+                    if (ptr == local)
+                        heap.assign(local, len);
+                    heap.resize(n);
+                    ptr = &heap[0];
+                    cap = heap.size();
+                }
+            };
+
+
+            // Text that passes the quick check is copied to the output as it
+            // is. When a character fails it, the segment around it is decoded
+            // into a local buffer, normalized there, and encoded straight into
+            // the output. The segment runs from the last starter before it
+            // that passed the quick check, up to the next such starter after
+            // it (these are always stable starters, though not the only
+            // ones). Invalid UTF is left to the general algorithm.
+
+            template <typename C>
+            void normalize_any(const C* src, size_t n, basic_string<C>& dst, NormalizationForm form) {
+                bool k = form == NFKC || form == NFKD, composed = form == NFC || form == NFKC;
+                if (utf_error_offset(src, n) != npos) {
+                    u32string utf32;
+                    apply_decomposition(basic_string<C>(src, n), utf32, k);
+                    apply_ordering(utf32);
+                    if (composed)
+                        apply_composition(utf32);
+                    dst += recode<C>(utf32);
+                    return;
                 }
-                if (! combined)
-                    ++i;
+                auto& table = quick_check_table();
+                int shift = qc_shift(form);
+                SegmentBuffer seg;
+                C units[UtfEncoding<C>::max_units];
+                char32_t buf[max_full_decomposition];
+                size_t pos = 0, copied = 0, boundary = 0;
+                unsigned last_cc = 0;
+                dst.reserve(dst.size() + n);
+                while (pos < n) {
+                    if (std::make_unsigned_t<C>(src[pos]) < 0x80) {
+                        if (sizeof(C) == 1)
+                            pos += ascii_span(reinterpret_cast<const char*>(src) + pos, n - pos);
+                        else
+                            ++pos;
+                        boundary = pos - 1;
+                        last_cc = 0;
+                        continue;
+                    }
+                    char32_t u = 0;
+                    size_t len = UtfEncoding<C>::decode_fast(src + pos, n - pos, u);
+                    auto value = table[u];
+                    unsigned cc = value & 0xff;
+                    if (((value >> shift) & 3) == 0 && (cc == 0 || last_cc <= cc)) {
+                        if (cc == 0)
+                            boundary = pos;
+                        last_cc = cc;
+                        pos += len;
+                        continue;
+                    }
+                    size_t end = pos + len;
+                    while (end < n) {
+                        len = UtfEncoding<C>::decode_fast(src + end, n - end, u);
+                        value = table[u];
+                        if ((value & 0xff) == 0 && ((value >> shift) & 3) == 0)
+                            break;
+                        end += len;
+                    }
+                    dst.append(src + copied, boundary - copied);
+                    seg.clear();
+                    seg.reserve(end - boundary);
+                    for (size_t i = boundary; i < end;) {
+                        i += UtfEncoding<C>::decode_fast(src + i, end - i, u);
+                        size_t m = full_decomposition(u, buf, k);
+                        if (m == 0)
+                            seg.push_back(u);
+                        for (size_t j = 0; j < m; ++j)
+                            seg.push_back(buf[j]);
+                    }
+                    size_t size = seg.size();
+                    if (size > 0) {
+                        order_chars(seg.data(), size);
+                        if (composed)
+                            size = compose_chars(seg.data(), size);
+                    }
+                    for (size_t i = 0; i < size; ++i)
+                        dst.append(units, UtfEncoding<C>::encode(seg.data()[i], units));
+                    pos = copied = boundary = end;
+                    last_cc = 0;
+                }
+                dst.append(src + copied, n - copied);
+            }
+
+        }
+
+        size_t full_decomposition(char32_t c, char32_t* dst, bool k) noexcept {
+            // Hangul syllables are decomposed algorithmically
+            if (c >= hangul_sbase && c < hangul_sbase + hangul_scount) {
+                char32_t s = c - hangul_sbase, t = s % hangul_tcount;
+                dst[0] = hangul_lbase + s / hangul_ncount;
+                dst[1] = hangul_vbase + s % hangul_ncount / hangul_tcount;
+                if (t == 0)
+                    return 2;
+                dst[2] = hangul_tbase + t;
+                return 3;
             }
+            auto index = (k ? full_compatibility_index_trie : full_canonical_index_trie)[c];
+            if (index == 0)
+                return 0;
+            else if (index & long_decomposition)
+                return copy_decomposition(long_full_compatibility_table.begin()[(index & ~ long_decomposition) - 1].value, dst);
+            else if (k)
+                return copy_decomposition(short_full_compatibility_table.begin()[index - 1].value, dst);
+            else
+                return copy_decomposition(full_canonical_table.begin()[index - 1].value, dst);
+        }
+
+        void apply_ordering(u32string& str) {
+            if (! str.empty())
+                order_chars(&str[0], str.size());
+        }
+
+        void apply_composition(u32string& str) {
+            if (! str.empty())
+                str.resize(compose_chars(&str[0], str.size()));
         }
 
+        QuickCheck quick_check(const char* src, size_t n, NormalizationForm form) noexcept { return quick_check_any(src, n, form); }
+        QuickCheck quick_check(const char16_t* src, size_t n, NormalizationForm form) noexcept { return quick_check_any(src, n, form); }
+        QuickCheck quick_check(const char32_t* src, size_t n, NormalizationForm form) noexcept { return quick_check_any(src, n, form); }
+        QuickCheck quick_check(const wchar_t* src, size_t n, NormalizationForm form) noexcept { return quick_check_any(src, n, form); }
+
+        void normalize_units(const char* src, size_t n, u8string& dst, NormalizationForm form) { normalize_any(src, n, dst, form); }
+        void normalize_units(const char16_t* src, size_t n, u16string& dst, NormalizationForm form) { normalize_any(src, n, dst, form); }
+        void normalize_units(const char32_t* src, size_t n, u32string& dst, NormalizationForm form) { normalize_any(src, n, dst, form); }
+        void normalize_units(const wchar_t* src, size_t n, wstring& dst, NormalizationForm form) { normalize_any(src, n, dst, form); }
+
+        void normalizer_scan(u8string& buf, NormalizerScan& scan, NormalizationForm form) { normalizer_scan_any(buf, scan, form); }
+        void normalizer_scan(u16string& buf, NormalizerScan& scan, NormalizationForm form) { normalizer_scan_any(buf, scan, form); }
+        void normalizer_scan(u32string& buf, NormalizerScan& scan, NormalizationForm form) { normalizer_scan_any(buf, scan, form); }
+        void normalizer_scan(wstring& buf, NormalizerScan& scan, NormalizationForm form) { normalizer_scan_any(buf, scan, form); }
+
     }
 
     std::ostream& operator<<(std::ostream& o, NormalizationForm n) {
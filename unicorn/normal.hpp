@@ -4,67 +4,178 @@
 #include "unicorn/character.hpp"
 #include "unicorn/utf.hpp"
 #include <string>
+#include <utility>
 
 namespace Unicorn {
 
     // Normalization functions
 
+    enum NormalizationForm { NFC, NFD, NFKC, NFKD };
+    std::ostream& operator<<(std::ostream& o, NormalizationForm n);
+
     namespace UnicornDetail {
 
+        // full_decomposition() writes the complete canonical (or if k is
+        // true, compatibility) decomposition of a character, with every
+        // character in it already decomposed, and returns its length, or
+        // zero if the character does not decompose.
+
+        constexpr size_t max_full_decomposition = 18;
+
+        size_t full_decomposition(char32_t c, char32_t* dst, bool k) noexcept;
+
         template <typename C>
         void apply_decomposition(const basic_string<C>& src, u32string& dst, bool k) {
-            auto decompose = k ? compatibility_decomposition : canonical_decomposition;
-            size_t max_decompose = k ? max_compatibility_decomposition : max_canonical_decomposition;
-            char32_t buf[max_decompose];
+            char32_t buf[max_full_decomposition];
             dst.reserve(src.size());
-            size_t pos = 0;
             for (char32_t c: utf_range(src)) {
-                dst.resize(pos + max_decompose);
-                size_t len = decompose(c, &dst[pos]);
-                if (len == 0) {
-                    dst.resize(++pos);
-                    dst.back() = c;
-                } else {
-                    dst.resize(pos + len);
-                    while (pos < dst.size()) {
-                        len = decompose(dst[pos], buf);
-                        if (len == 0)
-                            ++pos;
-                        else
-                            dst.replace(pos, 1, buf, len);
-                    }
-                }
+                size_t len = full_decomposition(c, buf, k);
+                if (len == 0)
+                    dst += c;
+                else
+                    dst.append(buf, len);
             }
         }
 
         void apply_ordering(u32string& str);
         void apply_composition(u32string& str);
 
-    }
+        // quick_check() implements the quick check algorithm from UAX #15.
+        // A yes answer means the string is already in the requested form,
+        // no means it is not, and maybe means that only a full normalization
+        // can tell. Invalid encoding always gives no.
 
-    enum NormalizationForm { NFC, NFD, NFKC, NFKD };
-    std::ostream& operator<<(std::ostream& o, NormalizationForm n);
+        enum class QuickCheck: uint8_t { yes, no, maybe };
+
+        QuickCheck quick_check(const char* src, size_t n, NormalizationForm form) noexcept;
+        QuickCheck quick_check(const char16_t* src, size_t n, NormalizationForm form) noexcept;
+        QuickCheck quick_check(const char32_t* src, size_t n, NormalizationForm form) noexcept;
+        QuickCheck quick_check(const wchar_t* src, size_t n, NormalizationForm form) noexcept;
+
+        // normalize_units() appends the normalized form of the source to
+        // dst, working in the source encoding. Only the segments that need
+        // changing are converted to UTF-32, a few characters at a time;
+        // everything else is copied unchanged.
+
+        void normalize_units(const char* src, size_t n, u8string& dst, NormalizationForm form);
+        void normalize_units(const char16_t* src, size_t n, u16string& dst, NormalizationForm form);
+        void normalize_units(const char32_t* src, size_t n, u32string& dst, NormalizationForm form);
+        void normalize_units(const wchar_t* src, size_t n, wstring& dst, NormalizationForm form);
+
+    }
 
     template <typename C>
     basic_string<C> normalize(const basic_string<C>& src, NormalizationForm form) {
-        using namespace UnicornDetail;
-        u32string utf32;
-        apply_decomposition(src, utf32, form == NFKC || form == NFKD);
-        apply_ordering(utf32);
-        if (form == NFC || form == NFKC)
-            apply_composition(utf32);
-        return recode<C>(utf32);
+        basic_string<C> dst;
+        UnicornDetail::normalize_units(src.data(), src.size(), dst, form);
+        return dst;
     }
 
     template <typename C>
     void normalize_in(basic_string<C>& src, NormalizationForm form) {
         using namespace UnicornDetail;
-        u32string utf32;
-        apply_decomposition(src, utf32, form == NFKC || form == NFKD);
-        apply_ordering(utf32);
-        if (form == NFC || form == NFKC)
-            apply_composition(utf32);
-        recode(utf32, src);
+        if (quick_check(src.data(), src.size(), form) == QuickCheck::yes)
+            return;
+        basic_string<C> dst;
+        normalize_units(src.data(), src.size(), dst, form);
+        src.swap(dst);
+    }
+
+    template <typename C>
+    basic_string<C> normalize(basic_string<C>&& src, NormalizationForm form) {
+        normalize_in(src, form);
+        return std::move(src);
+    }
+
+    template <typename C>
+    bool is_normalized(const basic_string<C>& src, NormalizationForm form) {
+        using namespace UnicornDetail;
+        switch (quick_check(src.data(), src.size(), form)) {
+            case QuickCheck::yes:  return true;
+            case QuickCheck::no:   return false;
+            default:               return normalize(src, form) == src;
+        }
+    }
+
+    // Incremental normalization
+
+    namespace UnicornDetail {
+
+        // A streaming normalizer can only cut its buffer in front of a
+        // stable starter, a character that nothing before it can reorder or
+        // compose with, or after an ASCII character that nothing after it can
+        // compose with. To keep the buffer bounded it inserts U+034F
+        // COMBINING GRAPHEME JOINER wherever a run of non-starters, counted
+        // in the compatibility decompositions of the characters, would
+        // exceed 30 (the stream-safe format from UAX #15), or wherever a
+        // segment would otherwise exceed the absolute length limit (which
+        // ordinary text never approaches).
+
+        constexpr size_t max_stream_nonstarters = 30;
+        constexpr size_t max_stream_segment = 128;
+
+        struct NormalizerScan {
+            size_t pos = 0;          // Buffer offset scanned up to
+            size_t boundary = 0;     // Offset where the buffer can be cut
+            size_t nonstarters = 0;  // Consecutive non-starters before pos
+            size_t segment = 0;      // Characters since the boundary
+        };
+
+        // normalizer_scan() reads the complete characters in the buffer
+        // beyond scan.pos, inserting CGJ where the limits are reached, and
+        // updating the scan state.
+
+        void normalizer_scan(u8string& buf, NormalizerScan& scan, NormalizationForm form);
+        void normalizer_scan(u16string& buf, NormalizerScan& scan, NormalizationForm form);
+        void normalizer_scan(u32string& buf, NormalizerScan& scan, NormalizationForm form);
+        void normalizer_scan(wstring& buf, NormalizerScan& scan, NormalizationForm form);
+
+    }
+
+    template <typename C>
+    class Normalizer {
+    public:
+        using code_unit = C;
+        using string_type = basic_string<C>;
+        Normalizer() noexcept {}
+        explicit Normalizer(NormalizationForm form) noexcept: nf(form) {}
+        void feed(const C* src, size_t n, string_type& dst);
+        void feed(const string_type& src, string_type& dst) { feed(src.data(), src.size(), dst); }
+        void finish(string_type& dst);
+        NormalizationForm form() const noexcept { return nf; }
+        size_t pending() const noexcept { return buf.size(); }
+        void reset() noexcept { buf.clear(); scan = {}; }
+    private:
+        NormalizationForm nf = NFC;       // Normalization form
+        string_type buf;                  // Text not yet normalized
+        UnicornDetail::NormalizerScan scan;  // Scan state of the buffer
+        void emit(size_t n, string_type& dst);
+    };
+
+    template <typename C>
+    void Normalizer<C>::feed(const C* src, size_t n, string_type& dst) {
+        if (! src || n == 0)
+            return;
+        buf.append(src, n);
+        UnicornDetail::normalizer_scan(buf, scan, nf);
+        if (scan.boundary == 0)
+            return;
+        emit(scan.boundary, dst);
+        buf.erase(0, scan.boundary);
+        scan.pos -= scan.boundary;
+        scan.boundary = 0;
+    }
+
+    template <typename C>
+    void Normalizer<C>::finish(string_type& dst) {
+        emit(buf.size(), dst);
+        reset();
+    }
+
+    template <typename C>
+    void Normalizer<C>::emit(size_t n, string_type& dst) {
+        if (n > 0)
+            UnicornDetail::normalize_units(buf.data(), n, dst, nf);
     }
 
 }
@@ -28,6 +28,18 @@ namespace {
             for (auto& segment: grapheme_range(src))
                 dst.push_back(u_str(segment));
         }
+        template <typename C>
+        void operator()(const UtfView<C>& src, vector<basic_string<C>>& dst) const {
+            for (auto& segment: grapheme_range(src))
+                dst.push_back(u_str(segment));
+        }
+        #if __cplusplus >= 201703L
+            template <typename C>
+            void operator()(std::basic_string_view<C> src, vector<basic_string<C>>& dst) const {
+                for (auto& segment: grapheme_range(src))
+                    dst.push_back(u_str(segment));
+            }
+        #endif
     };
 
     struct SplitWords {
@@ -36,6 +48,18 @@ namespace {
             for (auto& segment: word_range(src))
                 dst.push_back(u_str(segment));
         }
+        template <typename C>
+        void operator()(const UtfView<C>& src, vector<basic_string<C>>& dst) const {
+            for (auto& segment: word_range(src))
+                dst.push_back(u_str(segment));
+        }
+        #if __cplusplus >= 201703L
+            template <typename C>
+            void operator()(std::basic_string_view<C> src, vector<basic_string<C>>& dst) const {
+                for (auto& segment: word_range(src))
+                    dst.push_back(u_str(segment));
+            }
+        #endif
     };
 
     struct SplitSentences {
@@ -44,6 +68,18 @@ namespace {
             for (auto& segment: sentence_range(src))
                 dst.push_back(u_str(segment));
         }
+        template <typename C>
+        void operator()(const UtfView<C>& src, vector<basic_string<C>>& dst) const {
+            for (auto& segment: sentence_range(src))
+                dst.push_back(u_str(segment));
+        }
+        #if __cplusplus >= 201703L
+            template <typename C>
+            void operator()(std::basic_string_view<C> src, vector<basic_string<C>>& dst) const {
+                for (auto& segment: sentence_range(src))
+                    dst.push_back(u_str(segment));
+            }
+        #endif
     };
 
     template <typename Split>
@@ -83,6 +119,17 @@ namespace {
             TEST_EQUAL_RANGE(segments16, expect16);
             TEST_EQUAL_RANGE(segments32, expect32);
             TEST_EQUAL_RANGE(wsegments, wexpect);
+            segments8.clear();
+            segments16.clear();
+            TRY(Split()(utf_view(source8), segments8));
+            TRY(Split()(utf_view(source16.data(), source16.size()), segments16));
+            TEST_EQUAL_RANGE(segments8, expect8);
+            TEST_EQUAL_RANGE(segments16, expect16);
+            #if __cplusplus >= 201703L
+                segments32.clear();
+                TRY(Split()(std::u32string_view(source32), segments32));
+                TEST_EQUAL_RANGE(segments32, expect32);
+            #endif
             if (Test::test_failures() > prev_failures) {
                 FAIL(name + " " + dec(lnum) + ": " + line);
                 for (auto c: source32)
@@ -507,6 +554,29 @@ namespace {
 
     }
 
+    void check_segmentation_error_handling() {
+
+        u8string s = "Hello \xff\xfe world", t;
+        vector<u8string> words;
+
+        auto range = utf_range(s, err_replace);
+        for (auto& g: grapheme_range(range.begin(), range.end()))
+            t += "[" + u_str(g) + "]";
+        TEST_EQUAL(t, "[H][e][l][l][o][ ][\xff][\xfe][ ][w][o][r][l][d]");
+        for (auto& w: word_range(range.begin(), range.end(), alpha_words))
+            words.push_back(u_str(w));
+        TEST_EQUAL(to_str(words), "[Hello,world]");
+
+        s = u8string(100, 'x') + " " + u8string(200, 'y');
+        words.clear();
+        for (auto& w: word_range(s))
+            words.push_back(u_str(w));
+        TEST_EQUAL(words.size(), 3);
+        TEST_EQUAL(words[0], u8string(100, 'x'));
+        TEST_EQUAL(words[2], u8string(200, 'y'));
+
+    }
+
 }
 
 TEST_MODULE(unicorn, segment) {
@@ -524,5 +594,6 @@ TEST_MODULE(unicorn, segment) {
     check_paragraph_segmentation_utf8();
     check_paragraph_segmentation_utf16();
     check_paragraph_segmentation_utf32();
+    check_segmentation_error_handling();
 
 }
@@ -7,6 +7,7 @@
 #include <deque>
 #include <iterator>
 #include <string>
+#include <type_traits>
 
 namespace Unicorn {
 
@@ -28,18 +29,62 @@ namespace Unicorn {
         template <typename Property> using PropertyQuery = Property (*)(char32_t);
         template <typename Property> using SegmentFunction = size_t (*)(const std::deque<Property>&, bool);
 
+        inline Grapheme_Cluster_Break grapheme_break_property(char32_t c) noexcept { return char_properties(c).grapheme_cluster_break; }
+        inline Word_Break word_break_property(char32_t c) noexcept { return char_properties(c).word_break; }
+        inline Sentence_Break sentence_break_property(char32_t c) noexcept { return char_properties(c).sentence_break; }
+
         size_t find_grapheme_break(const std::deque<Grapheme_Cluster_Break>& buf, bool eof);
         size_t find_word_break(const std::deque<Word_Break>& buf, bool eof);
         size_t find_sentence_break(const std::deque<Sentence_Break>& buf, bool eof);
 
+        // The lookahead buffer is refilled with classify_units(), which
+        // decodes and looks up a run of characters in one pass, when the
+        // property query is one of the standard ones and the iterator does
+        // not need to throw on invalid text; otherwise one character at a
+        // time through the iterator.
+
+        template <typename Property, PropertyQuery<Property> PQ> struct BulkQuery: std::false_type {};
+        template <> struct BulkQuery<Grapheme_Cluster_Break, grapheme_break_property>: std::true_type
+            { static constexpr auto kind = PropertyKind::grapheme_cluster_break; };
+        template <> struct BulkQuery<Word_Break, word_break_property>: std::true_type
+            { static constexpr auto kind = PropertyKind::word_break; };
+        template <> struct BulkQuery<Sentence_Break, sentence_break_property>: std::true_type
+            { static constexpr auto kind = PropertyKind::sentence_break; };
+
+        template <typename Property, PropertyQuery<Property> PQ, typename UI>
+        void fill_properties(std::deque<Property>& buf, UI& next, const UI& ends, size_t bufsize, std::false_type) {
+            while (next != ends && buf.size() < bufsize)
+                buf.push_back(PQ(*next++));
+        }
+
+        template <typename Property, PropertyQuery<Property> PQ, typename UI>
+        void fill_properties(std::deque<Property>& buf, UI& next, const UI& ends, size_t bufsize, std::true_type) {
+            if (next.flags() & err_throw) {
+                fill_properties<Property, PQ>(buf, next, ends, bufsize, std::false_type());
+                return;
+            }
+            if (next == ends || buf.size() >= bufsize)
+                return;
+            // Read a whole block at a time; extra lookahead does not change
+            // where the segment function finds the next break
+            uint8_t props[64];
+            size_t count = sizeof(props);
+            size_t pos = next.offset();
+            pos += classify_units(next.source().data() + pos, ends.offset() - pos, BulkQuery<Property, PQ>::kind,
+                (next.flags() & err_ignore) == 0, props, count);
+            for (size_t i = 0; i < count; ++i)
+                buf.push_back(Property(props[i]));
+            next = utf_iterator_at(next, pos);
+        }
+
     }
 
     template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ,
-        UnicornDetail::SegmentFunction<Property> SF>
+        UnicornDetail::SegmentFunction<Property> SF, typename UI = UtfIterator<C>>
     class BasicSegmentIterator:
-    public ForwardIterator<BasicSegmentIterator<C, Property, PQ, SF>, const Irange<UtfIterator<C>>> {
+    public ForwardIterator<BasicSegmentIterator<C, Property, PQ, SF, UI>, const Irange<UI>> {
     public:
-        using utf_iterator = UtfIterator<C>;
+        using utf_iterator = UI;
         BasicSegmentIterator() noexcept {}
         BasicSegmentIterator(const utf_iterator& i, const utf_iterator& j, uint32_t flags):
             seg{i, i}, ends(j), next(i), bufsize(initsize), mode(flags) { ++*this; }
@@ -59,17 +104,16 @@ namespace Unicorn {
     };
 
     template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ,
-        UnicornDetail::SegmentFunction<Property> SF>
-    BasicSegmentIterator<C, Property, PQ, SF>&
-    BasicSegmentIterator<C, Property, PQ, SF>::operator++() noexcept {
+        UnicornDetail::SegmentFunction<Property> SF, typename UI>
+    BasicSegmentIterator<C, Property, PQ, SF, UI>&
+    BasicSegmentIterator<C, Property, PQ, SF, UI>::operator++() noexcept {
         do {
             seg.first = seg.second;
             if (seg.first == ends)
                 break;
             buf.erase(buf.begin(), buf.begin() + len);
             for (;;) {
-                while (next != ends && buf.size() < bufsize)
-                    buf.push_back(PQ(*next++));
+                UnicornDetail::fill_properties<Property, PQ>(buf, next, ends, bufsize, UnicornDetail::BulkQuery<Property, PQ>());
                 len = SF(buf, next == ends);
                 if (len || next == ends)
                     break;
@@ -84,12 +128,14 @@ namespace Unicorn {
     }
 
     template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ,
-        UnicornDetail::SegmentFunction<Property> SF>
-    bool BasicSegmentIterator<C, Property, PQ, SF>::select_segment() const noexcept {
+        UnicornDetail::SegmentFunction<Property> SF, typename UI>
+    bool BasicSegmentIterator<C, Property, PQ, SF, UI>::select_segment() const noexcept {
         if (mode & graphic_words)
-            return std::find_if_not(seg.begin(), seg.end(), char_is_white_space) != seg.end();
+            return std::find_if(seg.begin(), seg.end(),
+                [] (char32_t c) { return ! char_properties(c).has(CharProps::white_space); }) != seg.end();
         else if (mode & alpha_words)
-            return std::find_if(seg.begin(), seg.end(), char_is_alphanumeric) != seg.end();
+            return std::find_if(seg.begin(), seg.end(),
+                [] (char32_t c) { auto g = char_properties(c).primary_category(); return g == 'L' || g == 'N'; }) != seg.end();
         else
             return true;
     }
@@ -97,7 +143,7 @@ namespace Unicorn {
     // Grapheme cluster boundaries
 
     template <typename C> using GraphemeIterator
-        = BasicSegmentIterator<C, Grapheme_Cluster_Break, grapheme_cluster_break, UnicornDetail::find_grapheme_break>;
+        = BasicSegmentIterator<C, Grapheme_Cluster_Break, UnicornDetail::grapheme_break_property, UnicornDetail::find_grapheme_break>;
 
     template <typename C> Irange<GraphemeIterator<C>>
     grapheme_range(const UtfIterator<C>& i, const UtfIterator<C>& j) {
@@ -114,10 +160,37 @@ namespace Unicorn {
         return grapheme_range(utf_range(source));
     }
 
+    template <typename C> using GraphemeSpanIterator
+        = BasicSegmentIterator<C, Grapheme_Cluster_Break, UnicornDetail::grapheme_break_property, UnicornDetail::find_grapheme_break, UtfSpanIterator<C>>;
+
+    template <typename C> Irange<GraphemeSpanIterator<C>>
+    grapheme_range(const UtfSpanIterator<C>& i, const UtfSpanIterator<C>& j) {
+        return {{i, j, {}}, {j, j, {}}};
+    }
+
+    template <typename C> Irange<GraphemeSpanIterator<C>>
+    grapheme_range(const Irange<UtfSpanIterator<C>>& source) {
+        return grapheme_range(source.begin(), source.end());
+    }
+
+    template <typename C> Irange<GraphemeSpanIterator<C>>
+    grapheme_range(const UtfView<C>& source) {
+        return grapheme_range(utf_range(source));
+    }
+
+    #if __cplusplus >= 201703L
+
+        template <typename C> Irange<GraphemeSpanIterator<C>>
+        grapheme_range(std::basic_string_view<C> source) {
+            return grapheme_range(UtfView<C>(source));
+        }
+
+    #endif
+
     // Word boundaries
 
     template <typename C> using WordIterator
-        = BasicSegmentIterator<C, Word_Break, word_break, UnicornDetail::find_word_break>;
+        = BasicSegmentIterator<C, Word_Break, UnicornDetail::word_break_property, UnicornDetail::find_word_break>;
 
     template <typename C> Irange<WordIterator<C>>
     word_range(const UtfIterator<C>& i, const UtfIterator<C>& j, uint32_t flags = 0) {
@@ -136,10 +209,39 @@ namespace Unicorn {
         return word_range(utf_range(source), flags);
     }
 
+    template <typename C> using WordSpanIterator
+        = BasicSegmentIterator<C, Word_Break, UnicornDetail::word_break_property, UnicornDetail::find_word_break, UtfSpanIterator<C>>;
+
+    template <typename C> Irange<WordSpanIterator<C>>
+    word_range(const UtfSpanIterator<C>& i, const UtfSpanIterator<C>& j, uint32_t flags = 0) {
+        if (bits_set(flags & (unicode_words | graphic_words | alpha_words)) > 1)
+            throw std::invalid_argument("Inconsistent word breaking flags");
+        return {{i, j, flags}, {j, j, flags}};
+    }
+
+    template <typename C> Irange<WordSpanIterator<C>>
+    word_range(const Irange<UtfSpanIterator<C>>& source, uint32_t flags = 0) {
+        return word_range(source.begin(), source.end(), flags);
+    }
+
+    template <typename C> Irange<WordSpanIterator<C>>
+    word_range(const UtfView<C>& source, uint32_t flags = 0) {
+        return word_range(utf_range(source), flags);
+    }
+
+    #if __cplusplus >= 201703L
+
+        template <typename C> Irange<WordSpanIterator<C>>
+        word_range(std::basic_string_view<C> source, uint32_t flags = 0) {
+            return word_range(UtfView<C>(source), flags);
+        }
+
+    #endif
+
     // Sentence boundaries
 
     template <typename C> using SentenceIterator
-        = BasicSegmentIterator<C, Sentence_Break, sentence_break, UnicornDetail::find_sentence_break>;
+        = BasicSegmentIterator<C, Sentence_Break, UnicornDetail::sentence_break_property, UnicornDetail::find_sentence_break>;
 
     template <typename C> Irange<SentenceIterator<C>>
     sentence_range(const UtfIterator<C>& i, const UtfIterator<C>& j) {
@@ -156,6 +258,33 @@ namespace Unicorn {
         return sentence_range(utf_range(source));
     }
 
+    template <typename C> using SentenceSpanIterator
+        = BasicSegmentIterator<C, Sentence_Break, UnicornDetail::sentence_break_property, UnicornDetail::find_sentence_break, UtfSpanIterator<C>>;
+
+    template <typename C> Irange<SentenceSpanIterator<C>>
+    sentence_range(const UtfSpanIterator<C>& i, const UtfSpanIterator<C>& j) {
+        return {{i, j, {}}, {j, j, {}}};
+    }
+
+    template <typename C> Irange<SentenceSpanIterator<C>>
+    sentence_range(const Irange<UtfSpanIterator<C>>& source) {
+        return sentence_range(source.begin(), source.end());
+    }
+
+    template <typename C> Irange<SentenceSpanIterator<C>>
+    sentence_range(const UtfView<C>& source) {
+        return sentence_range(utf_range(source));
+    }
+
+    #if __cplusplus >= 201703L
+
+        template <typename C> Irange<SentenceSpanIterator<C>>
+        sentence_range(std::basic_string_view<C> source) {
+            return sentence_range(UtfView<C>(source));
+        }
+
+    #endif
+
     // Common base template for line and paragraph iterators
 
     namespace UnicornDetail {
@@ -271,6 +271,85 @@ namespace {
 
     }
 
+    template <typename C>
+    UtfIterator<C> reference_find(const basic_string<C>& str, const CharacterSet& set, bool negate) {
+        return std::find_if(utf_begin(str), utf_end(str), [&] (char32_t c) { return set.contains(c) != negate; });
+    }
+
+    void check_find_character_set() {
+
+        u8string s8;
+        u16string s16;
+        u32string s32;
+        UtfIterator<char> i8;
+        UtfIterator<char16_t> i16;
+        UtfIterator<char32_t> i32;
+        CharacterSet set;
+
+        s8 = u8"€uro ∈lement";
+        TRY(i8 = str_find_first_of(s8, CharacterSet(u8"€∈")));                 TEST_EQUAL(std::distance(utf_begin(s8), i8), 0);
+        TRY(i8 = str_find_first_of(s8, CharacterSet(u8"jklmn")));              TEST_EQUAL(std::distance(utf_begin(s8), i8), 6);
+        TRY(i8 = str_find_first_of(s8, CharacterSet(u8"vwxyz")));              TEST_EQUAL(std::distance(utf_begin(s8), i8), 12);
+        TRY(i8 = str_find_first_of(utf_range(s8), CharacterSet(u8"∈")));       TEST_EQUAL(std::distance(utf_begin(s8), i8), 5);
+        TRY(i8 = str_find_first_not_of(s8, CharacterSet(u8"€uro")));           TEST_EQUAL(std::distance(utf_begin(s8), i8), 4);
+        TRY(i8 = str_find_first_not_of(s8, CharacterSet(u8"€uro ∈lement")));   TEST_EQUAL(std::distance(utf_begin(s8), i8), 12);
+        TRY(i8 = str_find_first_not_of(utf_range(s8), ~ CharacterSet(U'r')));  TEST_EQUAL(std::distance(utf_begin(s8), i8), 2);
+        TRY(i8 = str_find_last_of(s8, CharacterSet(u8"€∈")));                  TEST_EQUAL(std::distance(utf_begin(s8), i8), 5);
+        TRY(i8 = str_find_last_not_of(s8, CharacterSet(u8"∈lement")));         TEST_EQUAL(std::distance(utf_begin(s8), i8), 4);
+
+        s16 = u"€uro ∈lement";
+        TRY(i16 = str_find_first_of(s16, CharacterSet(u8"jklmn")));            TEST_EQUAL(std::distance(utf_begin(s16), i16), 6);
+        TRY(i16 = str_find_first_not_of(s16, CharacterSet(u8"€uro")));         TEST_EQUAL(std::distance(utf_begin(s16), i16), 4);
+        TRY(i16 = str_find_last_of(s16, CharacterSet(u8"€∈")));                TEST_EQUAL(std::distance(utf_begin(s16), i16), 5);
+
+        s32 = U"€uro ∈lement";
+        TRY(i32 = str_find_first_of(s32, CharacterSet(u8"jklmn")));            TEST_EQUAL(std::distance(utf_begin(s32), i32), 6);
+        TRY(i32 = str_find_first_not_of(s32, CharacterSet(u8"€uro")));         TEST_EQUAL(std::distance(utf_begin(s32), i32), 4);
+        TRY(i32 = str_find_last_not_of(s32, CharacterSet(u8"∈lement")));       TEST_EQUAL(std::distance(utf_begin(s32), i32), 4);
+
+        s8 = u8"abc\xffxyz";
+        auto range = utf_range(s8, err_replace);
+        TRY(i8 = str_find_first_of(range, CharacterSet(U'\ufffd')));           TEST_EQUAL(i8.offset(), 3);
+        TRY(i8 = str_find_first_not_of(range, CharacterSet(u8"abc")));         TEST_EQUAL(i8.offset(), 3);
+        TRY(i8 = str_find_first_of(range, CharacterSet(u8"yz")));              TEST_EQUAL(i8.offset(), 5);
+        range = utf_range(s8, err_throw);
+        TEST_THROW(str_find_first_of(range, CharacterSet(u8"yz")), EncodingError);
+
+        // Compare with a simple search on long strings, so that the SIMD
+        // kernels see whole blocks, matches at every offset, and non-ASCII
+        // characters on either side of a block boundary
+
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> pick(0, 99);
+        const u32string alphabet = U"abcdefghijklmnopqrstuvwxyz0123456789 ,.;:!?-_()[]{}<>/\\|@#$%^&*+=~àéîøüαβγ€∈😀";
+        vector<CharacterSet> sets = {
+            CharacterSet(u8" ,.;:!?"),
+            CharacterSet(u8",.;:!?-_()[]{}<>/\\|@#$%^&*+=~"),
+            CharacterSet(u8"é€"),
+            CharacterSet(u8" é😀"),
+            ~ CharacterSet(u8"abcdefghijklmnopqrstuvwxyz"),
+            CharacterSet(U'\x7f'),
+        };
+        for (int i = 0; i < 200; ++i) {
+            s32.clear();
+            int n = pick(rng) + pick(rng) * pick(rng) / 10;
+            int rare = pick(rng) % 4;
+            for (int j = 0; j < n; ++j)
+                s32 += pick(rng) < 4 * rare ? alphabet[36 + pick(rng) % (alphabet.size() - 36)] : alphabet[pick(rng) % 26];
+            s8 = to_utf8(s32);
+            s16 = to_utf16(s32);
+            for (auto& set: sets) {
+                TEST(str_find_first_of(s8, set) == reference_find(s8, set, false));
+                TEST(str_find_first_not_of(s8, set) == reference_find(s8, set, true));
+                TEST(str_find_first_of(s16, set) == reference_find(s16, set, false));
+                TEST(str_find_first_not_of(s16, set) == reference_find(s16, set, true));
+                TEST(str_find_first_of(s32, set) == reference_find(s32, set, false));
+                TEST(str_find_first_not_of(s32, set) == reference_find(s32, set, true));
+            }
+        }
+
+    }
+
     void check_search() {
 
         u8string s8;
@@ -310,6 +389,24 @@ namespace {
         TRY(i32 = str_search(utf_range(s32), U"∈lement"));  TEST_EQUAL(std::distance(utf_begin(s32), i32), 5);
         TRY(i32 = str_search(utf_range(s32), U"Hello"));    TEST_EQUAL(std::distance(utf_begin(s32), i32), 12);
 
+        Utf8View v8;
+        UtfSpanIterator<char> j8;
+
+        s8 = u8"€uro ∈lement";
+        v8 = Utf8View(s8.data(), s8.size());
+        TRY(j8 = str_search(v8, u8""));                    TEST_EQUAL(std::distance(utf_begin(v8), j8), 0);
+        TRY(j8 = str_search(v8, u8"€uro"));                TEST_EQUAL(std::distance(utf_begin(v8), j8), 0);
+        TRY(j8 = str_search(v8, u8"∈lement"));             TEST_EQUAL(std::distance(utf_begin(v8), j8), 5);
+        TRY(j8 = str_search(v8, u8"Hello"));               TEST_EQUAL(std::distance(utf_begin(v8), j8), 12);
+        TRY(j8 = str_search(utf_range(v8), u8"∈lement"));  TEST_EQUAL(j8.offset(), 7);
+        TRY(j8 = str_search(utf_range(v8), u8"Hello"s));   TEST(j8 == utf_end(v8));
+
+        #if __cplusplus >= 201703L
+            std::string_view sv8(s8);
+            TRY(j8 = str_search(sv8, u8"∈lement"));         TEST_EQUAL(std::distance(utf_begin(sv8), j8), 5);
+            TRY(j8 = str_search(sv8, u8"Hello"s));          TEST(j8 == utf_end(sv8));
+        #endif
+
     }
 
     void check_skipws() {
@@ -355,6 +452,7 @@ TEST_MODULE(unicorn, string_algorithm) {
     check_expect();
     check_find_char();
     check_find_first();
+    check_find_character_set();
     check_search();
     check_skipws();
 
@@ -10,6 +10,7 @@
 #include "unicorn/utf.hpp"
 #include <algorithm>
 #include <string>
+#include <type_traits>
 
 namespace Unicorn {
 
@@ -87,6 +88,83 @@ namespace Unicorn {
         return utf_iterator(str, str.rfind(str_char<C>(c)));
     }
 
+    namespace UnicornDetail {
+
+        // find_in_set() returns the offset of the first character in
+        // [pos,end) of src that is in the set (with negate, not in the set),
+        // or end. ASCII characters are tested without decoding; in UTF-8,
+        // runs of them are skipped with the SIMD set scan. If check is true,
+        // invalid sequences are tested as U+FFFD, otherwise they are decoded
+        // without checking, as UtfIterator does with err_ignore.
+
+        template <typename C>
+        size_t find_in_set(const C* src, size_t pos, size_t end, const CharacterSet& set, bool negate, bool check) noexcept {
+            while (pos < end) {
+                auto u = char32_t(std::make_unsigned_t<C>(src[pos]));
+                size_t len = 1;
+                if (u > last_ascii_char) {
+                    if (check) {
+                        len = UtfEncoding<C>::decode(src + pos, end - pos, u);
+                        if (! char_is_unicode(u))
+                            u = replacement_char;
+                    } else {
+                        len = UtfEncoding<C>::decode_fast(src + pos, end - pos, u);
+                    }
+                }
+                if (set.contains(u) != negate)
+                    return pos;
+                pos += len;
+            }
+            return end;
+        }
+
+        inline size_t find_in_set(const char* src, size_t pos, size_t end, const CharacterSet& set, bool negate, bool check) noexcept {
+            bool ascii = set.is_ascii();
+            while (pos < end) {
+                pos += charset_scan(src + pos, end - pos, set, negate, negate || ! ascii);
+                if (pos == end || ascii || uint8_t(src[pos]) <= last_ascii_char)
+                    return pos;
+                char32_t u = 0;
+                size_t len = 0;
+                if (check) {
+                    len = UtfEncoding<char>::decode(src + pos, end - pos, u);
+                    if (! char_is_unicode(u))
+                        u = replacement_char;
+                } else {
+                    len = UtfEncoding<char>::decode_fast(src + pos, end - pos, u);
+                }
+                if (set.contains(u) != negate)
+                    return pos;
+                pos += len;
+            }
+            return end;
+        }
+
+        template <typename C>
+        UtfIterator<C> find_in_set(const UtfIterator<C>& b, const UtfIterator<C>& e, const CharacterSet& set, bool negate) {
+            if (b.flags() & err_throw)
+                return std::find_if(b, e, [&] (char32_t c) { return set.contains(c) != negate; });
+            auto pos = find_in_set(b.source().data(), b.offset(), e.offset(), set, negate, (b.flags() & err_ignore) == 0);
+            return utf_iterator_at(b, pos);
+        }
+
+    }
+
+    template <typename C>
+    UtfIterator<C> str_find_first_of(const UtfIterator<C>& b, const UtfIterator<C>& e, const CharacterSet& target) {
+        return UnicornDetail::find_in_set(b, e, target, false);
+    }
+
+    template <typename C>
+    UtfIterator<C> str_find_first_of(const Irange<UtfIterator<C>>& range, const CharacterSet& target) {
+        return str_find_first_of(range.begin(), range.end(), target);
+    }
+
+    template <typename C>
+    UtfIterator<C> str_find_first_of(const basic_string<C>& str, const CharacterSet& target) {
+        return str_find_first_of(utf_begin(str), utf_end(str), target);
+    }
+
     template <typename C>
     UtfIterator<C> str_find_first_of(const UtfIterator<C>& b, const UtfIterator<C>& e,
             const basic_string<C>& target) {
@@ -120,6 +198,21 @@ namespace Unicorn {
         return str_find_first_of(utf_begin(str), utf_end(str), cstr(target));
     }
 
+    template <typename C>
+    UtfIterator<C> str_find_first_not_of(const UtfIterator<C>& b, const UtfIterator<C>& e, const CharacterSet& target) {
+        return UnicornDetail::find_in_set(b, e, target, true);
+    }
+
+    template <typename C>
+    UtfIterator<C> str_find_first_not_of(const Irange<UtfIterator<C>>& range, const CharacterSet& target) {
+        return str_find_first_not_of(range.begin(), range.end(), target);
+    }
+
+    template <typename C>
+    UtfIterator<C> str_find_first_not_of(const basic_string<C>& str, const CharacterSet& target) {
+        return str_find_first_not_of(utf_begin(str), utf_end(str), target);
+    }
+
     template <typename C>
     UtfIterator<C> str_find_first_not_of(const UtfIterator<C>& b, const UtfIterator<C>& e,
             const basic_string<C>& target) {
@@ -156,6 +249,27 @@ namespace Unicorn {
         return str_find_first_not_of(utf_begin(str), utf_end(str), cstr(target));
     }
 
+    template <typename C>
+    UtfIterator<C> str_find_last_of(const UtfIterator<C>& b, const UtfIterator<C>& e, const CharacterSet& target) {
+        auto i = e;
+        while (i != b) {
+            --i;
+            if (target.contains(*i))
+                return i;
+        }
+        return e;
+    }
+
+    template <typename C>
+    UtfIterator<C> str_find_last_of(const Irange<UtfIterator<C>>& range, const CharacterSet& target) {
+        return str_find_last_of(range.begin(), range.end(), target);
+    }
+
+    template <typename C>
+    UtfIterator<C> str_find_last_of(const basic_string<C>& str, const CharacterSet& target) {
+        return str_find_last_of(utf_begin(str), utf_end(str), target);
+    }
+
     template <typename C>
     UtfIterator<C> str_find_last_of(const UtfIterator<C>& b, const UtfIterator<C>& e,
             const basic_string<C>& target) {
@@ -194,6 +308,27 @@ namespace Unicorn {
         return str_find_last_of(utf_begin(str), utf_end(str), cstr(target));
     }
 
+    template <typename C>
+    UtfIterator<C> str_find_last_not_of(const UtfIterator<C>& b, const UtfIterator<C>& e, const CharacterSet& target) {
+        auto i = e;
+        while (i != b) {
+            --i;
+            if (! target.contains(*i))
+                return i;
+        }
+        return e;
+    }
+
+    template <typename C>
+    UtfIterator<C> str_find_last_not_of(const Irange<UtfIterator<C>>& range, const CharacterSet& target) {
+        return str_find_last_not_of(range.begin(), range.end(), target);
+    }
+
+    template <typename C>
+    UtfIterator<C> str_find_last_not_of(const basic_string<C>& str, const CharacterSet& target) {
+        return str_find_last_not_of(utf_begin(str), utf_end(str), target);
+    }
+
     template <typename C>
     UtfIterator<C> str_find_last_not_of(const UtfIterator<C>& b, const UtfIterator<C>& e,
             const basic_string<C>& target) {
@@ -267,6 +402,52 @@ namespace Unicorn {
         return str_search(utf_begin(str), utf_end(str), cstr(target));
     }
 
+    template <typename C>
+    UtfSpanIterator<C> str_search(const UtfSpanIterator<C>& b, const UtfSpanIterator<C>& e,
+            const basic_string<C>& target) {
+        auto u_target = to_utf32(target);
+        return std::search(b, e, u_target.begin(), u_target.end());
+    }
+
+    template <typename C>
+    UtfSpanIterator<C> str_search(const Irange<UtfSpanIterator<C>>& range, const basic_string<C>& target) {
+        return str_search(range.begin(), range.end(), target);
+    }
+
+    template <typename C>
+    UtfSpanIterator<C> str_search(const UtfView<C>& str, const basic_string<C>& target) {
+        return str_search(utf_begin(str), utf_end(str), target);
+    }
+
+    template <typename C>
+    UtfSpanIterator<C> str_search(const UtfSpanIterator<C>& b, const UtfSpanIterator<C>& e, const C* target) {
+        return str_search(b, e, cstr(target));
+    }
+
+    template <typename C>
+    UtfSpanIterator<C> str_search(const Irange<UtfSpanIterator<C>>& range, const C* target) {
+        return str_search(range.begin(), range.end(), cstr(target));
+    }
+
+    template <typename C>
+    UtfSpanIterator<C> str_search(const UtfView<C>& str, const C* target) {
+        return str_search(utf_begin(str), utf_end(str), cstr(target));
+    }
+
+    #if __cplusplus >= 201703L
+
+        template <typename C>
+        UtfSpanIterator<C> str_search(std::basic_string_view<C> str, const basic_string<C>& target) {
+            return str_search(UtfView<C>(str), target);
+        }
+
+        template <typename C>
+        UtfSpanIterator<C> str_search(std::basic_string_view<C> str, const C* target) {
+            return str_search(UtfView<C>(str), target);
+        }
+
+    #endif
+
     template <typename C>
     size_t str_skipws(UtfIterator<C>& i, const UtfIterator<C>& end) {
         size_t n = 0;
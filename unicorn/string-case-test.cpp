@@ -3,6 +3,7 @@
 #include "unicorn/character.hpp"
 #include "unicorn/utf.hpp"
 #include "prion/unit-test.hpp"
+#include <random>
 #include <string>
 
 using namespace std::literals;
@@ -162,10 +163,77 @@ namespace {
 
     }
 
+    // Character by character reference versions of the bulk functions
+
+    template <typename C>
+    basic_string<C> reference_lowercase(const basic_string<C>& str) {
+        basic_string<C> dst;
+        UnicornDetail::LowerChar lc;
+        auto range = utf_range(str);
+        auto out = utf_writer(dst);
+        for (auto i = range.begin(), e = range.end(); i != e; ++i)
+            lc.convert(i, e, out);
+        return dst;
+    }
+
+    template <typename C>
+    basic_string<C> reference_casefold(const basic_string<C>& str) {
+        return UnicornDetail::casemap_helper(str, char_to_full_casefold, CharProps::casefold_changes);
+    }
+
+    void check_bulk_case_conversions() {
+
+        TEST_EQUAL(str_lowercase(u8"ΑΣ ΑΣ. ΑΣ'Σ Σ"s), u8"ας ας. ασ'ς σ");
+        TEST_EQUAL(str_lowercase(u8"ΑΣ:ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZ"s),
+            u8"ασ:abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz");
+        TEST_EQUAL(str_lowercase(u8"ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZ.'Σ Σ"s),
+            u8"abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz.'ς σ");
+        TEST_EQUAL(str_lowercase(u"ΑΣ ΑΣ. ΑΣ'Σ Σ"s), u"ας ας. ασ'ς σ");
+        TEST_EQUAL(str_lowercase(U"ΑΣ ΑΣ. ΑΣ'Σ Σ"s), U"ας ας. ασ'ς σ");
+        TEST_EQUAL(str_lowercase(u8"\u0130STANBUL"s), u8"i\u0307stanbul");
+        TEST_EQUAL(str_casefold(u8"STRASSE Straße ǅ ﬃ"s), u8"strasse strasse ǆ ffi");
+        TEST_EQUAL(str_casefold(u"STRASSE Straße ǅ ﬃ"s), u"strasse strasse ǆ ffi");
+        TEST_EQUAL(str_casefold(U"STRASSE Straße ǅ ﬃ"s), U"strasse strasse ǆ ffi");
+        TEST_EQUAL(str_casefold(u8"\U00010400\U00010428"s), u8"\U00010428\U00010428");
+
+        // Invalid code units are copied unchanged
+
+        TEST_EQUAL(str_lowercase(u8"ABC\xff" "DEF"s), u8"abc\xff" "def");
+        TEST_EQUAL(str_casefold(u8"ABC\xc3" "DEF"s), u8"abc\xc3" "def");
+        TEST_EQUAL(str_casefold(u"AB\xd800" "CD"s), u"ab\xd800" "cd");
+        TEST_EQUAL(str_casefold(U"AB\x110000" "CD"s), U"ab\x110000" "cd");
+
+        // Random strings mixing long ASCII runs with characters that have
+        // exceptional mappings or are case ignorable
+
+        static const u32string pool = U"AZaz09 .:'^`-\u00b5\u00c0\u00df\u00ff\u0130\u0149\u01c4\u01c5\u0301"
+            U"\u0345\u0390\u03a3\u03c3\u03c2\u1e9e\u1f88\u2126\u212a\u4e00\ufb03\U00010400\U0001e900";
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<size_t> length(0, 80), pick(0, pool.size() - 1), letter(0, 25), kind(0, 3);
+        for (int i = 0; i < 1000; ++i) {
+            u32string s32;
+            for (size_t j = length(rng); j > 0; --j)
+                s32 += kind(rng) ? char32_t((kind(rng) == 1 ? 'A' : 'a') + letter(rng)) : pool[pick(rng)];
+            auto s8 = to_utf8(s32);
+            auto s16 = to_utf16(s32);
+            auto ws = to_wstring(s32);
+            TEST_EQUAL(str_lowercase(s8), reference_lowercase(s8));
+            TEST_EQUAL(str_lowercase(s16), reference_lowercase(s16));
+            TEST_EQUAL(str_lowercase(s32), reference_lowercase(s32));
+            TEST(str_lowercase(ws) == reference_lowercase(ws));
+            TEST_EQUAL(str_casefold(s8), reference_casefold(s8));
+            TEST_EQUAL(str_casefold(s16), reference_casefold(s16));
+            TEST_EQUAL(str_casefold(s32), reference_casefold(s32));
+            TEST(str_casefold(ws) == reference_casefold(ws));
+        }
+
+    }
+
 }
 
 TEST_MODULE(unicorn, string_case) {
 
     check_case_conversions();
+    check_bulk_case_conversions();
 
 }
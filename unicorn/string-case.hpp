@@ -18,13 +18,17 @@ namespace Unicorn {
     namespace UnicornDetail {
 
         template <typename C, typename F>
-        const basic_string<C> casemap_helper(const basic_string<C>& src, F f) {
+        const basic_string<C> casemap_helper(const basic_string<C>& src, F f, uint16_t changes) {
             basic_string<C> dst;
             char32_t buf[max_case_decomposition];
             auto out = utf_writer(dst);
             for (auto c: utf_range(src)) {
-                auto n = f(c, buf);
-                std::copy_n(buf, n, out);
+                if (char_properties(c).has(changes)) {
+                    auto n = f(c, buf);
+                    std::copy_n(buf, n, out);
+                } else {
+                    *out = c;
+                }
             }
             return dst;
         }
@@ -33,9 +37,11 @@ namespace Unicorn {
         bool next_cased(FwdIter i, FwdIter e) {
             if (i == e)
                 return false;
-            for (++i; i != e; ++i)
-                if (! char_is_case_ignorable(*i))
-                    return char_is_cased(*i);
+            for (++i; i != e; ++i) {
+                auto& props = char_properties(*i);
+                if (! props.has(CharProps::case_ignorable))
+                    return props.has(CharProps::cased);
+            }
             return false;
         }
 
@@ -46,12 +52,17 @@ namespace Unicorn {
             char32_t buf[max_case_decomposition];
             template <typename FwdIter, typename OutIter>
             void convert(FwdIter i, FwdIter e, OutIter to) {
-                auto n = char_to_full_lowercase(*i, buf);
+                auto& props = char_properties(*i);
+                size_t n = 1;
+                if (props.has(CharProps::lowercase_changes))
+                    n = char_to_full_lowercase(*i, buf);
+                else
+                    buf[0] = *i;
                 if (buf[0] == sigma && last_cased && ! next_cased(i, e))
                     buf[0] = final_sigma;
                 std::copy_n(buf, n, to);
-                if (! char_is_case_ignorable(*i))
-                    last_cased = char_is_cased(*i);
+                if (! props.has(CharProps::case_ignorable))
+                    last_cased = props.has(CharProps::cased);
             }
         };
 
@@ -59,17 +70,13 @@ namespace Unicorn {
 
     template <typename C>
     basic_string<C> str_uppercase(const basic_string<C>& str) {
-        return UnicornDetail::casemap_helper(str, char_to_full_uppercase);
+        return UnicornDetail::casemap_helper(str, char_to_full_uppercase, CharProps::uppercase_changes);
     }
 
     template <typename C>
     basic_string<C> str_lowercase(const basic_string<C>& str) {
         basic_string<C> dst;
-        UnicornDetail::LowerChar lc;
-        auto range = utf_range(str);
-        auto out = utf_writer(dst);
-        for (auto i = range.begin(), e = range.end(); i != e; ++i)
-            lc.convert(i, e, out);
+        UnicornDetail::lowercase_units(str.data(), str.size(), dst);
         return dst;
     }
 
@@ -82,7 +89,7 @@ namespace Unicorn {
         for (auto& w: word_range(str)) {
             bool initial = true;
             for (auto i = w.begin(); i != w.end(); ++i) {
-                if (initial && char_is_cased(*i)) {
+                if (initial && char_properties(*i).has(CharProps::cased)) {
                     auto n = char_to_full_titlecase(*i, lc.buf);
                     std::copy_n(lc.buf, n, out);
                     lc.last_cased = true;
@@ -97,7 +104,9 @@ namespace Unicorn {
 
     template <typename C>
     basic_string<C> str_casefold(const basic_string<C>& str) {
-        return UnicornDetail::casemap_helper(str, char_to_full_casefold);
+        basic_string<C> dst;
+        UnicornDetail::casefold_units(str.data(), str.size(), dst);
+        return dst;
     }
 
     template <typename C>
@@ -478,6 +478,15 @@ namespace {
         s8 = u8"";             TRY(str_remove_in_if_not(s8, [] (char32_t c) { return c < U'a'; }));  TEST_EQUAL(s8, u8"");
         s8 = u8"Hello world";  TRY(str_remove_in_if_not(s8, [] (char32_t c) { return c < U'a'; }));  TEST_EQUAL(s8, u8"H ");
 
+        CharacterSet vowels(u8"aeiouàéîøü");
+        s8 = u8"Hello world";    TRY(t8 = str_remove(s8, vowels));                   TEST_EQUAL(t8, u8"Hll wrld");
+        s8 = u8"Héllø wörld";    TRY(t8 = str_remove(s8, vowels));                   TEST_EQUAL(t8, u8"Hll wörld");
+        s8 = u8"Héllø wörld";    TRY(t8 = str_remove(s8, u8"éö"s));                  TEST_EQUAL(t8, u8"Hllø wrld");
+        s8 = u8"Héllø wörld";    TRY(t8 = str_remove(s8, ~ CharacterSet(U'a', U'z')));  TEST_EQUAL(t8, u8"llwrld");
+        s8 = u8"Héllø wörld";    TRY(str_remove_in(s8, vowels));                     TEST_EQUAL(s8, u8"Hll wörld");
+        s16 = u"Héllø wörld";    TRY(t16 = str_remove(s16, vowels));                 TEST_EQUAL(t16, u"Hll wörld");
+        s32 = U"Héllø wörld";    TRY(t32 = str_remove(s32, vowels));                 TEST_EQUAL(t32, U"Hll wörld");
+
     }
 
     void check_repeat() {
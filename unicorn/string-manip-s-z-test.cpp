@@ -235,6 +235,21 @@ namespace {
         s32 = U"/*-+Hello/*-+world/*-+"s;                           TRY(str_squeeze_trim_in(s32, U"+-*/"s));  TEST_EQUAL(s32, U"Hello+world"s);
         s32 = U"∇∃∀€uro∇∃∀∈lement∇∃∀"s;                             TRY(str_squeeze_trim_in(s32, U"∀∃∇"s));   TEST_EQUAL(s32, U"€uro∀∈lement"s);
 
+        CharacterSet ops(u8"+-*/"), logic(u8"∀∃∇");
+        TEST_EQUAL(str_squeeze(u8"/*-+Hello/*-+world/*-+"s, ops), u8" Hello world "s);
+        TEST_EQUAL(str_squeeze(u8"/*-+Hello/*-+world/*-+"s, ops, U'*'), u8"*Hello*world*"s);
+        TEST_EQUAL(str_squeeze_trim(u8"/*-+Hello/*-+world/*-+"s, ops), u8"Hello world"s);
+        TEST_EQUAL(str_squeeze_trim(u8"/*-+Hello/*-+world/*-+"s, ops, U'*'), u8"Hello*world"s);
+        TEST_EQUAL(str_squeeze(u8"∇∃∀€uro∇∃∀∈lement∇∃∀"s, logic, U'∀'), u8"∀€uro∀∈lement∀"s);
+        TEST_EQUAL(str_squeeze(u"∇∃∀€uro∇∃∀∈lement∇∃∀"s, logic, U'∀'), u"∀€uro∀∈lement∀"s);
+        TEST_EQUAL(str_squeeze_trim(U"∇∃∀€uro∇∃∀∈lement∇∃∀"s, logic, U'∀'), U"€uro∀∈lement"s);
+        TEST_EQUAL(str_squeeze(u8"Hello world"s, CharacterSet()), u8"Hello world"s);
+        TEST_EQUAL(str_squeeze(u8"Hello world"s, CharacterSet(), U'*'), u8"Hello world"s);
+        s8 = u8"/*-+Hello/*-+world/*-+";  TRY(str_squeeze_in(s8, ops));             TEST_EQUAL(s8, u8" Hello world ");
+        s8 = u8"/*-+Hello/*-+world/*-+";  TRY(str_squeeze_in(s8, ops, U'*'));       TEST_EQUAL(s8, u8"*Hello*world*");
+        s8 = u8"/*-+Hello/*-+world/*-+";  TRY(str_squeeze_trim_in(s8, ops));        TEST_EQUAL(s8, u8"Hello world");
+        s8 = u8"/*-+Hello/*-+world/*-+";  TRY(str_squeeze_trim_in(s8, ops, U'*'));  TEST_EQUAL(s8, u8"Hello*world");
+
     }
 
     void check_substring() {
@@ -657,6 +672,18 @@ namespace {
         s32 = U"≤≤≤€uro≥≥≥";                TRY(str_trim_right_in(s32, U"≤≥"));  TEST_EQUAL(s32, U"≤≤≤€uro");
         s32 = U"≤≤≤€uro≥≥≥ ≤≤≤∈lement≥≥≥";  TRY(str_trim_right_in(s32, U"≤≥"));  TEST_EQUAL(s32, U"≤≤≤€uro≥≥≥ ≤≤≤∈lement");
 
+        CharacterSet brackets(u8"<>≤≥");
+        TEST_EQUAL(str_trim(u8"<<<Hello>>> <<<world>>>"s, brackets), u8"Hello>>> <<<world");
+        TEST_EQUAL(str_trim(u8"≤≤≤€uro≥≥≥ ≤≤≤∈lement≥≥≥"s, brackets), u8"€uro≥≥≥ ≤≤≤∈lement");
+        TEST_EQUAL(str_trim_left(u8"≤≤≤€uro≥≥≥"s, brackets), u8"€uro≥≥≥");
+        TEST_EQUAL(str_trim_right(u8"≤≤≤€uro≥≥≥"s, brackets), u8"≤≤≤€uro");
+        TEST_EQUAL(str_trim(u"≤<€uro>≥"s, brackets), u"€uro");
+        TEST_EQUAL(str_trim(U"≤<€uro>≥"s, brackets), U"€uro");
+        TEST_EQUAL(str_trim(u8"<<<>>>"s, brackets), u8"");
+        s8 = u8"≤≤≤€uro≥≥≥";  TRY(str_trim_in(s8, brackets));        TEST_EQUAL(s8, u8"€uro");
+        s8 = u8"≤≤≤€uro≥≥≥";  TRY(str_trim_left_in(s8, brackets));   TEST_EQUAL(s8, u8"€uro≥≥≥");
+        s8 = u8"≤≤≤€uro≥≥≥";  TRY(str_trim_right_in(s8, brackets));  TEST_EQUAL(s8, u8"≤≤≤€uro");
+
     }
 
     void check_trim_if() {
@@ -606,13 +606,34 @@ namespace Unicorn {
         return dst;
     }
 
+    namespace UnicornDetail {
+
+        template <typename C>
+        void str_remove_helper(const basic_string<C>& src, basic_string<C>& dst, const CharacterSet& chars) {
+            auto i = utf_begin(src), end = utf_end(src);
+            while (i != end) {
+                auto j = str_find_first_of(i, end, chars);
+                str_append(dst, i, j);
+                if (j == end)
+                    break;
+                i = std::next(j);
+            }
+        }
+
+    }
+
     template <typename C>
-    basic_string<C> str_remove(const basic_string<C>& str, const basic_string<C>& chars) {
+    basic_string<C> str_remove(const basic_string<C>& str, const CharacterSet& chars) {
         basic_string<C> dst;
-        std::copy_if(utf_begin(str), utf_end(str), utf_writer(dst), [&chars] (char32_t x) { return chars.find(x) == npos; });
+        UnicornDetail::str_remove_helper(str, dst, chars);
         return dst;
     }
 
+    template <typename C>
+    basic_string<C> str_remove(const basic_string<C>& str, const basic_string<C>& chars) {
+        return str_remove(str, CharacterSet(chars));
+    }
+
     template <typename C>
     basic_string<C> str_remove(const basic_string<C>& str, const C* chars) {
         return str_remove(str, cstr(chars));
@@ -640,12 +661,17 @@ namespace Unicorn {
     }
 
     template <typename C>
-    void str_remove_in(basic_string<C>& str, const basic_string<C>& chars) {
+    void str_remove_in(basic_string<C>& str, const CharacterSet& chars) {
         basic_string<C> dst;
-        std::copy_if(utf_begin(str), utf_end(str), utf_writer(dst), [&chars] (char32_t x) { return chars.find(x) == npos; });
+        UnicornDetail::str_remove_helper(str, dst, chars);
         str.swap(dst);
     }
 
+    template <typename C>
+    void str_remove_in(basic_string<C>& str, const basic_string<C>& chars) {
+        str_remove_in(str, CharacterSet(chars));
+    }
+
     template <typename C>
     void str_remove_in(basic_string<C>& str, const C* chars) {
         str_remove_in(str, cstr(chars));
@@ -822,12 +848,11 @@ namespace Unicorn {
         }
 
         template <typename C>
-        void str_squeeze_helper(const basic_string<C>& src, basic_string<C>& dst, bool trim, const basic_string<C>& chars) {
+        void str_squeeze_helper(const basic_string<C>& src, basic_string<C>& dst, bool trim, const CharacterSet& chars, char32_t sub) {
             if (chars.empty()) {
                 dst = src;
                 return;
             }
-            auto sub = str_first_char(chars);
             auto i = utf_begin(src), end = utf_end(src);
             if (trim)
                 i = str_find_first_not_of(i, end, chars);
@@ -842,6 +867,14 @@ namespace Unicorn {
             }
         }
 
+        template <typename C>
+        void str_squeeze_helper(const basic_string<C>& src, basic_string<C>& dst, bool trim, const basic_string<C>& chars) {
+            if (chars.empty())
+                dst = src;
+            else
+                str_squeeze_helper(src, dst, trim, CharacterSet(chars), str_first_char(chars));
+        }
+
     }
 
     template <typename C>
@@ -851,6 +884,13 @@ namespace Unicorn {
         return dst;
     }
 
+    template <typename C>
+    basic_string<C> str_squeeze(const basic_string<C>& str, const CharacterSet& chars, char32_t sub = U' ') {
+        basic_string<C> dst;
+        UnicornDetail::str_squeeze_helper(str, dst, false, chars, sub);
+        return dst;
+    }
+
     template <typename C>
     basic_string<C> str_squeeze(const basic_string<C>& str, const basic_string<C>& chars) {
         basic_string<C> dst;
@@ -872,6 +912,13 @@ namespace Unicorn {
         return dst;
     }
 
+    template <typename C>
+    basic_string<C> str_squeeze_trim(const basic_string<C>& str, const CharacterSet& chars, char32_t sub = U' ') {
+        basic_string<C> dst;
+        UnicornDetail::str_squeeze_helper(str, dst, true, chars, sub);
+        return dst;
+    }
+
     template <typename C>
     basic_string<C> str_squeeze_trim(const basic_string<C>& str, const basic_string<C>& chars) {
         basic_string<C> dst;
@@ -893,6 +940,13 @@ namespace Unicorn {
         str.swap(dst);
     }
 
+    template <typename C>
+    void str_squeeze_in(basic_string<C>& str, const CharacterSet& chars, char32_t sub = U' ') {
+        basic_string<C> dst;
+        UnicornDetail::str_squeeze_helper(str, dst, false, chars, sub);
+        str.swap(dst);
+    }
+
     template <typename C>
     void str_squeeze_in(basic_string<C>& str, const basic_string<C>& chars) {
         basic_string<C> dst;
@@ -914,6 +968,13 @@ namespace Unicorn {
         str.swap(dst);
     }
 
+    template <typename C>
+    void str_squeeze_trim_in(basic_string<C>& str, const CharacterSet& chars, char32_t sub = U' ') {
+        basic_string<C> dst;
+        UnicornDetail::str_squeeze_helper(str, dst, true, chars, sub);
+        str.swap(dst);
+    }
+
     template <typename C>
     void str_squeeze_trim_in(basic_string<C>& str, const basic_string<C>& chars) {
         basic_string<C> dst;
@@ -1093,6 +1154,11 @@ namespace Unicorn {
         return trim_helper(str, trimright, [p] (char32_t c) { return ! p(c); });
     }
 
+    template <typename C>
+    basic_string<C> str_trim(const basic_string<C>& str, const CharacterSet& chars) {
+        return str_trim_if(str, [&chars] (char32_t c) { return chars.contains(c); });
+    }
+
     template <typename C>
     basic_string<C> str_trim(const basic_string<C>& str, const basic_string<C>& chars) {
         return str_trim_if(str, UnicornDetail::CharIn(to_utf32(chars)));
@@ -1108,6 +1174,11 @@ namespace Unicorn {
         return str_trim_if(str, char_is_white_space);
     }
 
+    template <typename C>
+    basic_string<C> str_trim_left(const basic_string<C>& str, const CharacterSet& chars) {
+        return str_trim_left_if(str, [&chars] (char32_t c) { return chars.contains(c); });
+    }
+
     template <typename C>
     basic_string<C> str_trim_left(const basic_string<C>& str, const basic_string<C>& chars) {
         return str_trim_left_if(str, UnicornDetail::CharIn(to_utf32(chars)));
@@ -1123,6 +1194,11 @@ namespace Unicorn {
         return str_trim_left_if(str, char_is_white_space);
     }
 
+    template <typename C>
+    basic_string<C> str_trim_right(const basic_string<C>& str, const CharacterSet& chars) {
+        return str_trim_right_if(str, [&chars] (char32_t c) { return chars.contains(c); });
+    }
+
     template <typename C>
     basic_string<C> str_trim_right(const basic_string<C>& str, const basic_string<C>& chars) {
         return str_trim_right_if(str, UnicornDetail::CharIn(to_utf32(chars)));
@@ -1174,6 +1250,11 @@ namespace Unicorn {
         trim_in_helper(str, trimright, [p] (char32_t c) { return ! p(c); });
     }
 
+    template <typename C>
+    void str_trim_in(basic_string<C>& str, const CharacterSet& chars) {
+        str_trim_in_if(str, [&chars] (char32_t c) { return chars.contains(c); });
+    }
+
     template <typename C>
     void str_trim_in(basic_string<C>& str, const basic_string<C>& chars) {
         str_trim_in_if(str, UnicornDetail::CharIn(to_utf32(chars)));
@@ -1189,6 +1270,11 @@ namespace Unicorn {
         str_trim_in_if(str, char_is_white_space);
     }
 
+    template <typename C>
+    void str_trim_left_in(basic_string<C>& str, const CharacterSet& chars) {
+        str_trim_left_in_if(str, [&chars] (char32_t c) { return chars.contains(c); });
+    }
+
     template <typename C>
     void str_trim_left_in(basic_string<C>& str, const basic_string<C>& chars) {
         str_trim_left_in_if(str, UnicornDetail::CharIn(to_utf32(chars)));
@@ -1204,6 +1290,11 @@ namespace Unicorn {
         str_trim_left_in_if(str, char_is_white_space);
     }
 
+    template <typename C>
+    void str_trim_right_in(basic_string<C>& str, const CharacterSet& chars) {
+        str_trim_right_in_if(str, [&chars] (char32_t c) { return chars.contains(c); });
+    }
+
     template <typename C>
     void str_trim_right_in(basic_string<C>& str, const basic_string<C>& chars) {
         str_trim_right_in_if(str, UnicornDetail::CharIn(to_utf32(chars)));
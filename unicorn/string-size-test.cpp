@@ -3,7 +3,9 @@
 #include "unicorn/character.hpp"
 #include "unicorn/utf.hpp"
 #include "prion/unit-test.hpp"
+#include <random>
 #include <string>
+#include <vector>
 
 using namespace std::literals;
 using namespace Unicorn;
@@ -45,6 +47,16 @@ namespace {
         TEST_EQUAL(str_length(U"Hello"s, character_units), 5);
         TEST_EQUAL(str_length(utf32_example, character_units), 4);
 
+        TEST_EQUAL(str_length(utf_view(utf8_example), character_units), 4);
+        TEST_EQUAL(str_length(utf_view(utf16_example.data(), 2), character_units), 2);
+        TEST_EQUAL(str_length(Utf8View("a\xcc\x81" "e\xcc\x81", 6), grapheme_units), 2);
+        TEST_EQUAL(str_length(Utf8View("a\xcc\x81" "e\xcc\x81", 6), character_units), 4);
+
+        #if __cplusplus >= 201703L
+            TEST_EQUAL(str_length(std::string_view("a\xcc\x81" "e\xcc\x81"), grapheme_units), 2);
+            TEST_EQUAL(str_length(std::u16string_view(u"a\u0301e\u0301"), character_units), 4);
+        #endif
+
         TEST_EQUAL(str_length(u8""s, grapheme_units), 0);
         TEST_EQUAL(str_length(u8"aeiou"s, grapheme_units), 5);
         TEST_EQUAL(str_length(u8"áéíóú"s, grapheme_units), 5); // precomposed
@@ -467,11 +479,85 @@ namespace {
 
     }
 
+
+    template <typename C>
+    void check_bulk_counting(const basic_string<C>& str) {
+
+        std::vector<size_t> offsets;
+        for (auto i = utf_begin(str), e = utf_end(str); i != e; ++i)
+            offsets.push_back(i.offset());
+        size_t n = offsets.size();
+        offsets.push_back(str.size());
+
+        TEST_EQUAL(str_length(str), n);
+        TEST_EQUAL(str_length(utf_view(str)), n);
+        for (size_t i = 0; i <= n + 1; i += 1 + i / 5)
+            TEST_EQUAL(str_find_offset(str, i), i <= n ? offsets[i] : npos);
+
+        size_t mid = offsets[n / 2];
+        auto range = utf_range(str);
+        auto sub = irange(utf_iterator(str, mid), range.end());
+        TEST_EQUAL(str_length(sub), n - n / 2);
+        TEST_EQUAL(str_find_index(sub, 1).offset(), n > 0 ? offsets[n / 2 + 1] : str.size());
+
+        for (size_t step: {1, 7, 64}) {
+            UtfOffsetIndex<C> index(str, step);
+            TEST_EQUAL(index.size(), n);
+            TEST_EQUAL(index.step(), step);
+            for (size_t i = 0; i <= n; i += 1 + i / 3)
+                TEST_EQUAL(index.offset(i), offsets[i]);
+            TEST_EQUAL(index.offset(n), str.size());
+            TEST_EQUAL(index.offset(n + 1), npos);
+        }
+
+    }
+
+    void check_vectorized_length() {
+
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> pick(0, 9);
+        const std::vector<char32_t> chars {U'a', U'z', U'0', 0xe9, 0x430, 0x7ff, 0x800, 0x4e8c, 0xfffd, 0x10302};
+        u32string text;
+        u8string s8;
+        u16string s16;
+
+        for (size_t len: {0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 257, 1000, 3000}) {
+            text.clear();
+            for (size_t i = 0; i < len; ++i)
+                text += chars[pick(rng)];
+            TRY(recode(text, s8));
+            TRY(recode(text, s16));
+            TRY(check_bulk_counting(s8));
+            TRY(check_bulk_counting(s16));
+            TRY(check_bulk_counting(text));
+            TEST_EQUAL(str_length(s8), len);
+            TEST_EQUAL(str_length(s16), len);
+            auto half = str_find_offset(s8, len / 2);
+            TRY(check_bulk_counting(s8.substr(0, half) + "\xff" + s8.substr(half)));
+            TRY(s8 += "\xff");
+            TRY(s16 += char16_t(0xd800));
+            TRY(check_bulk_counting(s8));
+            TRY(check_bulk_counting(s16));
+        }
+
+        u8string ascii(1000, 'x');
+        TEST_EQUAL(str_length(ascii), 1000);
+        TEST_EQUAL(str_find_offset(ascii, 999), 999);
+        TEST_EQUAL(str_find_offset(ascii, 1000), 1000);
+        TEST_EQUAL(str_find_offset(ascii, 1001), npos);
+        UtfOffsetIndex<char> index;
+        TEST_EQUAL(index.size(), 0);
+        TEST_EQUAL(index.offset(0), 0);
+        TEST_EQUAL(index.offset(1), npos);
+
+    }
+
 }
 
 TEST_MODULE(unicorn, string_size) {
 
     check_length();
     check_find_offset();
+    check_vectorized_length();
 
 }
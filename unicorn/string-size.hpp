@@ -11,6 +11,7 @@
 #include <iterator>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace Unicorn {
 
@@ -40,7 +41,8 @@ namespace Unicorn {
         class EastAsianCount {
         public:
             explicit EastAsianCount(uint32_t flags) noexcept: count(), fset(flags) { memset(count, 0, sizeof(count)); }
-            void add(char32_t c) noexcept { ++count[unsigned(east_asian_width(c))]; }
+            void add(char32_t c) noexcept { add(char_properties(c).east_asian_width); }
+            void add(East_Asian_Width w) noexcept { ++count[unsigned(w)]; }
             size_t get() const noexcept {
                 size_t default_width = fset & wide_context ? 2 : 1;
                 return count[neut] + count[half] + count[narr] + 2 * count[full] + 2 * count[wide]
@@ -57,11 +59,39 @@ namespace Unicorn {
             uint32_t fset;
         };
 
-        template <typename C>
-        std::pair<UtfIterator<C>, bool> find_position(const Irange<UtfIterator<C>>& range, size_t pos, uint32_t flags = 0) {
+        // Counting characters in valid text can work directly on the code
+        // units; otherwise step through the range so the iterator's error
+        // handling is applied.
+
+        template <typename UI>
+        bool valid_units(const Irange<UI>& range, const typename UI::code_unit*& ptr, size_t& n) {
+            ptr = range.begin().source().data() + range.begin().offset();
+            n = range.end().offset() - range.begin().offset();
+            return utf_error_offset(ptr, n) == npos;
+        }
+
+        // Finding a character position only needs to look at the text up to
+        // that position, so the code units are validated and counted a block
+        // at a time; from the first block that contains an error, the rest
+        // is left to the iterator.
+
+        constexpr size_t position_block = 1024;
+
+        template <typename UI>
+        std::pair<UI, bool> find_position(const Irange<UI>& range, size_t pos, uint32_t flags = 0) {
             check_length_flags(flags);
             if (flags & character_units) {
-                auto i = range.begin();
+                auto ptr = range.begin().source().data() + range.begin().offset();
+                size_t n = range.end().offset() - range.begin().offset(), done = 0;
+                while (pos > 0 && done < n) {
+                    size_t len = std::min(n - done, position_block);
+                    if (len < n - done)
+                        len -= utf_incomplete_tail(ptr + done, len);
+                    if (utf_error_offset(ptr + done, len) != npos)
+                        break;
+                    done += utf_char_advance(ptr + done, len, pos);
+                }
+                auto i = utf_iterator_at(range.begin(), range.begin().offset() + done);
                 size_t len = 0;
                 while (i != range.end() && len < pos) {
                     ++i;
@@ -98,27 +128,46 @@ namespace Unicorn {
             }
         }
 
+        template <typename UI>
+        size_t utf_range_length(const Irange<UI>& range, uint32_t flags) {
+            check_length_flags(flags);
+            if (flags & character_units) {
+                const typename UI::code_unit* ptr = nullptr;
+                size_t n = 0;
+                if (valid_units(range, ptr, n))
+                    return utf_char_count(ptr, n);
+                return range_count(range);
+            } else if (flags & east_asian_flags) {
+                EastAsianCount eac(flags);
+                if (flags & grapheme_units) {
+                    for (auto g: grapheme_range(range))
+                        eac.add(*g.begin());
+                } else if (range.begin().flags() & err_throw) {
+                    for (auto c: range)
+                        eac.add(c);
+                } else {
+                    auto src = range.begin().source().data();
+                    size_t pos = range.begin().offset(), end = range.end().offset();
+                    bool check = (range.begin().flags() & err_ignore) == 0;
+                    uint8_t props[256];
+                    while (pos < end) {
+                        size_t count = sizeof(props);
+                        pos += classify_units(src + pos, end - pos, PropertyKind::east_asian_width, check, props, count);
+                        for (size_t i = 0; i < count; ++i)
+                            eac.add(East_Asian_Width(props[i]));
+                    }
+                }
+                return eac.get();
+            } else {
+                return range_count(grapheme_range(range));
+            }
+        }
+
     }
 
     template <typename C>
     size_t str_length(const Irange<UtfIterator<C>>& range, uint32_t flags = 0) {
-        using namespace UnicornDetail;
-        check_length_flags(flags);
-        if (flags & character_units) {
-            return range_count(range);
-        } else if (flags & east_asian_flags) {
-            EastAsianCount eac(flags);
-            if (flags & grapheme_units) {
-                for (auto g: grapheme_range(range))
-                    eac.add(*g.begin());
-            } else {
-                for (auto c: range)
-                    eac.add(c);
-            }
-            return eac.get();
-        } else {
-            return range_count(grapheme_range(range));
-        }
+        return UnicornDetail::utf_range_length(range, flags);
     }
 
     template <typename C>
@@ -131,6 +180,30 @@ namespace Unicorn {
         return str_length(utf_range(str), flags);
     }
 
+    template <typename C>
+    size_t str_length(const Irange<UtfSpanIterator<C>>& range, uint32_t flags = 0) {
+        return UnicornDetail::utf_range_length(range, flags);
+    }
+
+    template <typename C>
+    size_t str_length(const UtfSpanIterator<C>& b, const UtfSpanIterator<C>& e, uint32_t flags = 0) {
+        return str_length(irange(b, e), flags);
+    }
+
+    template <typename C>
+    size_t str_length(const UtfView<C>& str, uint32_t flags = 0) {
+        return str_length(utf_range(str), flags);
+    }
+
+    #if __cplusplus >= 201703L
+
+        template <typename C>
+        size_t str_length(std::basic_string_view<C> str, uint32_t flags = 0) {
+            return str_length(UtfView<C>(str), flags);
+        }
+
+    #endif
+
     template <typename C>
     UtfIterator<C> str_find_index(const Irange<UtfIterator<C>>& range, size_t pos, uint32_t flags = 0) {
         return UnicornDetail::find_position(range, pos, flags).first;
@@ -152,4 +225,61 @@ namespace Unicorn {
         return rc.second ? rc.first.offset() : npos;
     }
 
+    template <typename C>
+    class UtfOffsetIndex {
+    public:
+        using code_unit = C;
+        UtfOffsetIndex() = default;
+        explicit UtfOffsetIndex(const UtfView<C>& src, size_t step = 1024);
+        size_t offset(size_t index) const noexcept;
+        size_t size() const noexcept { return chars; }
+        size_t step() const noexcept { return interval; }
+        const UtfView<C>& source() const noexcept { return view; }
+    private:
+        UtfView<C> view;                // Indexed text
+        size_t interval = 1024;         // Characters between marks
+        size_t chars = 0;               // Length in characters
+        bool valid = true;              // Text is valid UTF
+        std::vector<size_t> marks {0};  // Offset of every interval'th character
+        size_t advance(size_t ofs, size_t& k) const noexcept;
+    };
+
+    template <typename C>
+    UtfOffsetIndex<C>::UtfOffsetIndex(const UtfView<C>& src, size_t step):
+    view(src), interval(std::max(step, size_t(1))) {
+        valid = UnicornDetail::utf_error_offset(view.data(), view.size()) == npos;
+        size_t ofs = 0;
+        for (;;) {
+            size_t k = interval;
+            ofs = advance(ofs, k);
+            chars += interval - k;
+            if (k > 0)
+                break;
+            marks.push_back(ofs);
+            if (ofs == view.size())
+                break;
+        }
+    }
+
+    template <typename C>
+    size_t UtfOffsetIndex<C>::offset(size_t index) const noexcept {
+        if (index > chars)
+            return npos;
+        size_t k = index % interval;
+        return advance(marks[index / interval], k);
+    }
+
+    template <typename C>
+    size_t UtfOffsetIndex<C>::advance(size_t ofs, size_t& k) const noexcept {
+        using namespace UnicornDetail;
+        auto ptr = view.data();
+        auto len = view.size();
+        if (valid)
+            return ofs + utf_char_advance(ptr + ofs, len - ofs, k);
+        char32_t u = 0;
+        for (; k > 0 && ofs < len; --k)
+            ofs += UtfEncoding<C>::decode_fast(ptr + ofs, len - ofs, u);
+        return ofs;
+    }
+
 }
@@ -3069,5 +3069,493 @@ const KeyValue<char32_t, char32_t> bidi_paired_bracket_type_array[] {
 
 const TableView<char32_t, char32_t> bidi_paired_bracket_type_table {std::begin(bidi_paired_bracket_type_array), std::end(bidi_paired_bracket_type_array)};
 
+const uint16_t bidi_class_trie_top[] {
+0,1,2,3,4,5,5,5,5,5,6,5,5,5,5,7,
+8,9,5,5,5,5,10,5,5,5,5,11,5,12,13,14,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,15,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,15,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,15,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,15,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,15,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,15,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,15,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,15,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,15,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,15,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,15,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,15,
+16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,15,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,15,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,15,
+};
+
+const uint16_t bidi_class_trie_index[] {
+0,1,2,3,4,4,4,4,4,4,5,6,7,8,9,10,4,4,11,4,4,4,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,30,32,33,34,35,36,37,38,28,39,40,41,4,42,43,44,45,46,47,48,49,50,
+51,52,53,4,4,4,4,4,4,4,4,4,4,54,55,4,56,4,4,4,4,4,4,4,4,4,57,4,58,59,60,61,62,4,63,4,64,65,4,66,67,68,69,4,70,71,72,73,74,4,4,75,4,4,4,76,4,4,4,4,4,4,77,78,
+79,80,81,82,83,84,85,86,87,86,86,86,88,89,90,91,92,93,94,95,86,86,86,86,86,86,96,86,86,86,86,86,4,4,4,4,86,86,86,86,86,86,86,86,86,97,98,99,4,4,4,100,4,101,4,102,86,103,104,105,86,86,86,106,
+107,4,108,109,4,4,4,110,111,112,113,114,4,115,4,116,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,86,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,117,118,4,4,4,4,119,120,121,122,123,4,124,4,125,126,4,127,128,129,130,131,132,133,134,135,4,4,4,136,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,137,138,16,16,16,16,16,16,139,16,16,140,141,142,16,143,144,145,4,146,
+4,4,4,4,147,86,148,149,4,4,4,150,4,151,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,152,152,152,152,153,152,152,152,154,152,152,155,156,152,152,152,152,152,152,152,152,152,152,152,152,157,152,152,152,152,152,152,
+158,159,160,4,161,162,163,164,165,4,4,166,167,168,4,4,4,4,169,170,4,4,171,172,173,174,175,4,176,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,177,178,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,179,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,180,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,181,182,4,86,183,4,4,86,184,4,4,4,4,4,4,4,4,4,4,4,4,4,185,186,187,188,189,4,4,4,4,4,4,4,4,190,191,192,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,152,152,152,193,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,16,16,16,194,152,152,152,152,
+195,86,196,197,198,199,4,4,4,4,4,4,86,86,86,86,86,86,86,86,86,200,201,86,86,86,86,202,86,105,86,203,204,205,206,4,207,4,208,56,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,209,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,209,
+210,210,210,210,7,7,7,211,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,
+};
+
+const Bidi_Class bidi_class_trie_data[] {
+Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::S,Bidi_Class::B,Bidi_Class::S,Bidi_Class::WS,Bidi_Class::B,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::B,Bidi_Class::B,Bidi_Class::B,Bidi_Class::S,Bidi_Class::WS,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ES,Bidi_Class::CS,Bidi_Class::ES,Bidi_Class::CS,Bidi_Class::CS,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::CS,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::BN,
+Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::B,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::CS,Bidi_Class::ON,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::BN,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::EN,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ET,Bidi_Class::R,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::R,Bidi_Class::NSM,
+Bidi_Class::R,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::R,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::R,Bidi_Class::NSM,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,
+Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::AL,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::AL,Bidi_Class::CS,Bidi_Class::AL,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,
+Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::ET,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::NSM,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,
+Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,
+Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::AN,Bidi_Class::ON,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::ON,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,
+Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::NSM,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,
+Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,
+Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::R,Bidi_Class::R,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,
+Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::R,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::R,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::R,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,
+Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,
+Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,
+Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ET,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ET,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,
+Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ET,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,
+Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ET,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::WS,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ET,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::BN,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,
+Bidi_Class::WS,Bidi_Class::WS,Bidi_Class::WS,Bidi_Class::WS,Bidi_Class::WS,Bidi_Class::WS,Bidi_Class::WS,Bidi_Class::WS,Bidi_Class::WS,Bidi_Class::WS,Bidi_Class::WS,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::L,Bidi_Class::R,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::WS,Bidi_Class::B,Bidi_Class::LRE,Bidi_Class::RLE,Bidi_Class::PDF,Bidi_Class::LRO,Bidi_Class::RLO,Bidi_Class::CS,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::CS,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::WS,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::LRI,Bidi_Class::RLI,Bidi_Class::FSI,Bidi_Class::PDI,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::EN,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::ES,Bidi_Class::ES,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,
+Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::ES,Bidi_Class::ES,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,
+Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ET,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ES,Bidi_Class::ET,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::WS,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::ON,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,
+Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::R,Bidi_Class::NSM,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::ES,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,
+Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,
+Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::ON,Bidi_Class::AL,Bidi_Class::AL,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::CS,Bidi_Class::ON,Bidi_Class::CS,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::CS,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ET,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ES,Bidi_Class::ES,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,
+Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::BN,
+Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ES,Bidi_Class::CS,Bidi_Class::ES,Bidi_Class::CS,Bidi_Class::CS,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::CS,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ET,Bidi_Class::ET,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::BN,Bidi_Class::BN,
+Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,
+Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::ON,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,
+Bidi_Class::R,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::R,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::NSM,
+Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,
+Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::AN,Bidi_Class::R,
+Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,
+Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,
+Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,
+Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,Bidi_Class::R,
+Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,Bidi_Class::AL,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::EN,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::ON,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,
+Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::L,Bidi_Class::BN,Bidi_Class::BN,
+Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,
+Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::NSM,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,Bidi_Class::BN,
+};
+
+const CharacterTrie<Bidi_Class> bidi_class_trie {bidi_class_trie_top, bidi_class_trie_index, bidi_class_trie_data, Bidi_Class::L};
+
+const uint16_t bidi_mirrored_trie_top[] {
+0,1,2,3,4,4,4,4,4,4,4,4,4,4,4,5,
+4,4,4,4,4,4,4,4,4,4,4,4,4,6,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+};
+
+const uint16_t bidi_mirrored_trie_index[] {
+0,1,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+6,7,8,3,3,9,3,3,10,11,12,13,14,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,15,3,16,3,3,3,3,3,3,17,18,19,20,21,22,3,3,3,3,3,3,3,3,3,3,3,3,23,3,3,3,3,3,3,3,
+24,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,25,3,3,26,27,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,28,29,30,31,32,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+};
+
+const bool bidi_mirrored_trie_data[] {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,
+0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,1,1,1,0,0,0,1,1,1,1,1,1,0,0,0,1,0,0,0,1,1,0,0,0,1,1,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0,1,1,1,1,1,1,1,1,1,0,0,0,0,0,1,0,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,1,1,0,1,0,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,1,1,
+0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,
+1,0,0,1,1,1,1,0,1,1,0,1,1,1,0,0,0,0,0,1,1,1,1,0,0,0,0,0,1,1,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+1,1,1,1,1,1,0,0,0,1,0,0,0,0,1,1,1,1,1,0,1,1,0,0,1,1,1,1,1,0,0,0,0,1,0,1,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,1,1,0,0,
+0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,0,0,1,0,1,0,0,1,0,1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,1,1,0,1,1,0,0,1,1,0,0,0,0,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,1,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,1,1,1,0,0,0,0,1,0,0,0,1,1,1,1,1,0,1,0,0,
+0,0,1,1,1,1,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+const CharacterTrie<bool> bidi_mirrored_trie {bidi_mirrored_trie_top, bidi_mirrored_trie_index, bidi_mirrored_trie_data, 0};
+
+const uint16_t bidi_mirroring_glyph_trie_top[] {
+0,1,2,3,4,4,4,4,4,4,4,4,4,4,4,5,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+};
+
+const uint16_t bidi_mirroring_glyph_trie_index[] {
+0,1,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+6,7,8,3,3,3,3,3,9,10,11,12,13,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,14,3,15,3,3,3,3,3,3,16,17,18,19,20,21,3,3,3,3,3,3,3,3,3,3,3,3,22,3,3,3,3,3,3,3,
+23,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,24,3,3,25,26,3,3,
+};
+
+const char32_t bidi_mirroring_glyph_trie_data[] {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x29,0x28,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3e,0x0,0x3c,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5d,0x0,0x5b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7d,0x0,0x7b,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xbb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xab,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf3b,0xf3a,0xf3d,0xf3c,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x169c,0x169b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x203a,0x2039,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x2046,0x2045,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x207e,0x207d,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x208e,0x208d,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x220b,0x220c,0x220d,0x2208,0x2209,0x220a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x29f5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x223d,0x223c,0x0,0x0,
+0x0,0x0,0x0,0x22cd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2253,0x2252,0x2255,0x2254,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2265,0x2264,0x2267,0x2266,0x2269,0x2268,0x226b,0x226a,0x0,0x0,0x226f,0x226e,0x2271,0x2270,0x2273,0x2272,0x2275,0x2274,0x2277,0x2276,0x2279,0x2278,0x227b,0x227a,0x227d,0x227c,0x227f,0x227e,
+0x2281,0x2280,0x2283,0x2282,0x2285,0x2284,0x2287,0x2286,0x2289,0x2288,0x228b,0x228a,0x0,0x0,0x0,0x2290,0x228f,0x2292,0x2291,0x0,0x0,0x0,0x0,0x0,0x29b8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x22a3,0x22a2,0x0,0x0,0x2ade,0x0,0x2ae4,0x2ae3,0x0,0x2ae5,0x0,0x0,0x0,0x0,0x22b1,0x22b0,0x22b3,0x22b2,0x22b5,0x22b4,0x22b7,0x22b6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x22ca,0x22c9,0x22cc,0x22cb,0x2243,0x0,0x0,0x22d1,0x22d0,0x0,0x0,0x0,0x0,0x22d7,0x22d6,0x22d9,0x22d8,0x22db,0x22da,0x22dd,0x22dc,0x22df,0x22de,0x22e1,0x22e0,0x22e3,0x22e2,0x22e5,0x22e4,0x22e7,0x22e6,0x22e9,0x22e8,0x22eb,0x22ea,0x22ed,0x22ec,0x0,0x0,0x22f1,0x22f0,0x22fa,0x22fb,0x22fc,0x0,0x22fd,0x22fe,0x0,0x0,0x22f2,0x22f3,0x22f4,0x22f6,0x22f7,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2309,0x2308,0x230b,0x230a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x232a,0x2329,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2769,0x2768,0x276b,0x276a,0x276d,0x276c,0x276f,0x276e,0x2771,0x2770,0x2773,0x2772,0x2775,0x2774,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x27c4,0x27c3,0x27c6,0x27c5,0x0,0x27c9,0x27c8,0x0,0x27cd,0x0,0x27cb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x27d6,0x27d5,0x0,0x0,0x0,0x0,0x0,0x0,0x27de,0x27dd,0x0,0x0,0x0,0x27e3,0x27e2,0x27e5,0x27e4,0x27e7,0x27e6,0x27e9,0x27e8,0x27eb,0x27ea,0x27ed,0x27ec,0x27ef,0x27ee,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x2984,0x2983,0x2986,0x2985,0x2988,0x2987,0x298a,0x2989,0x298c,0x298b,0x2990,0x298f,0x298e,0x298d,0x2992,0x2991,0x2994,0x2993,0x2996,0x2995,0x2998,0x2997,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2298,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x29c1,0x29c0,0x0,0x0,0x29c5,0x29c4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x29d0,0x29cf,0x29d2,0x29d1,0x0,0x29d5,0x29d4,0x0,0x0,0x29d9,0x29d8,0x29db,0x29da,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2215,0x0,0x0,0x29f9,0x29f8,0x0,0x0,0x29fd,0x29fc,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2a2c,0x2a2b,0x2a2e,0x2a2d,0x0,0x0,0x0,0x0,0x0,0x2a35,0x2a34,0x0,0x0,0x0,0x0,0x0,0x0,0x2a3d,0x2a3c,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2a65,0x2a64,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2a7a,0x2a79,0x0,0x0,0x2a7e,0x2a7d,0x2a80,
+0x2a7f,0x2a82,0x2a81,0x2a84,0x2a83,0x0,0x0,0x0,0x0,0x0,0x0,0x2a8c,0x2a8b,0x0,0x0,0x0,0x0,0x2a92,0x2a91,0x2a94,0x2a93,0x2a96,0x2a95,0x2a98,0x2a97,0x2a9a,0x2a99,0x2a9c,0x2a9b,0x0,0x0,0x0,0x0,0x2aa2,0x2aa1,0x0,0x0,0x0,0x2aa7,0x2aa6,0x2aa9,0x2aa8,0x2aab,0x2aaa,0x2aad,0x2aac,0x0,0x2ab0,0x2aaf,0x0,0x0,0x2ab4,0x2ab3,0x0,0x0,0x0,0x0,0x0,0x0,0x2abc,0x2abb,0x2abe,0x2abd,0x2ac0,
+0x2abf,0x2ac2,0x2ac1,0x2ac4,0x2ac3,0x2ac6,0x2ac5,0x0,0x0,0x0,0x0,0x0,0x0,0x2ace,0x2acd,0x2ad0,0x2acf,0x2ad2,0x2ad1,0x2ad4,0x2ad3,0x2ad6,0x2ad5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x22a6,0x0,0x0,0x0,0x0,0x22a9,0x22a8,0x22ab,0x0,0x0,0x0,0x0,0x0,0x0,0x2aed,0x2aec,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2af8,0x2af7,0x2afa,0x2af9,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x2e03,0x2e02,0x2e05,0x2e04,0x0,0x0,0x0,0x2e0a,0x2e09,0x0,0x2e0d,0x2e0c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2e1d,0x2e1c,0x0,0x0,0x2e21,0x2e20,0x2e23,0x2e22,0x2e25,0x2e24,0x2e27,0x2e26,0x2e29,0x2e28,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3009,0x3008,0x300b,0x300a,0x300d,0x300c,0x300f,0x300e,0x3011,0x3010,0x0,0x0,0x3015,0x3014,0x3017,0x3016,0x3019,0x3018,0x301b,0x301a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfe5a,0xfe59,0xfe5c,0xfe5b,0xfe5e,0xfe5d,0x0,0x0,0x0,0x0,0x0,0xfe65,0xfe64,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff09,0xff08,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff1e,0x0,0xff1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff3d,0x0,0xff3b,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff5d,0x0,0xff5b,0x0,0xff60,0xff5f,0x0,0xff63,0xff62,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+};
+
+const CharacterTrie<char32_t> bidi_mirroring_glyph_trie {bidi_mirroring_glyph_trie_top, bidi_mirroring_glyph_trie_index, bidi_mirroring_glyph_trie_data, 0x0};
+
+const uint16_t bidi_paired_bracket_trie_top[] {
+0,1,2,3,4,4,4,4,4,4,4,4,4,4,4,5,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+};
+
+const uint16_t bidi_paired_bracket_trie_index[] {
+0,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,4,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,5,6,2,2,2,2,2,2,2,2,2,7,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,8,2,9,2,2,2,2,2,2,10,11,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,12,2,2,2,2,2,2,2,
+13,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,14,2,2,15,16,2,2,
+};
+
+const char32_t bidi_paired_bracket_trie_data[] {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x29,0x28,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5d,0x0,0x5b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7d,0x0,0x7b,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf3b,0xf3a,0xf3d,0xf3c,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x169c,0x169b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x2046,0x2045,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x207e,0x207d,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x208e,0x208d,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2309,0x2308,0x230b,0x230a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x232a,0x2329,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2769,0x2768,0x276b,0x276a,0x276d,0x276c,0x276f,0x276e,0x2771,0x2770,0x2773,0x2772,0x2775,0x2774,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x27c6,0x27c5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x27e7,0x27e6,0x27e9,0x27e8,0x27eb,0x27ea,0x27ed,0x27ec,0x27ef,0x27ee,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x2984,0x2983,0x2986,0x2985,0x2988,0x2987,0x298a,0x2989,0x298c,0x298b,0x2990,0x298f,0x298e,0x298d,0x2992,0x2991,0x2994,0x2993,0x2996,0x2995,0x2998,0x2997,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x29d9,0x29d8,0x29db,0x29da,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x29fd,0x29fc,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2e23,0x2e22,0x2e25,0x2e24,0x2e27,0x2e26,0x2e29,0x2e28,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3009,0x3008,0x300b,0x300a,0x300d,0x300c,0x300f,0x300e,0x3011,0x3010,0x0,0x0,0x3015,0x3014,0x3017,0x3016,0x3019,0x3018,0x301b,0x301a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfe5a,0xfe59,0xfe5c,0xfe5b,0xfe5e,0xfe5d,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff09,0xff08,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff3d,0x0,0xff3b,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff5d,0x0,0xff5b,0x0,0xff60,0xff5f,0x0,0xff63,0xff62,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+};
+
+const CharacterTrie<char32_t> bidi_paired_bracket_trie {bidi_paired_bracket_trie_top, bidi_paired_bracket_trie_index, bidi_paired_bracket_trie_data, 0x0};
+
+const uint16_t bidi_paired_bracket_type_trie_top[] {
+0,1,2,3,4,4,4,4,4,4,4,4,4,4,4,5,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+};
+
+const uint16_t bidi_paired_bracket_type_trie_index[] {
+0,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,4,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,5,6,2,2,2,2,2,2,2,2,2,7,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,8,2,9,2,2,2,2,2,2,10,11,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,12,2,2,2,2,2,2,2,
+13,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,14,2,2,15,16,2,2,
+};
+
+const char bidi_paired_bracket_type_trie_data[] {
+'n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','o','c','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n',
+'n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','o','n','c','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','o','n','c','n','n',
+'n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n',
+'n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','o','c','o','c','n','n',
+'n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','o','c','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n',
+'n','n','n','n','n','o','c','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','o','c','n',
+'n','n','n','n','n','n','n','n','n','n','n','n','n','o','c','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n',
+'n','n','n','n','n','n','n','n','o','c','o','c','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','o','c','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n',
+'n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','o','c','o','c','o','c','o','c','o','c','o','c','o','c','n','n','n','n','n','n','n','n','n','n',
+'n','n','n','n','n','o','c','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','o','c','o','c','o','c','o','c','o','c','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n',
+'n','n','n','o','c','o','c','o','c','o','c','o','c','o','c','o','c','o','c','o','c','o','c','o','c','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n',
+'n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','o','c','o','c','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','o','c','n','n',
+'n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','o','c','o','c','o','c','o','c','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n',
+'n','n','n','n','n','n','n','n','o','c','o','c','o','c','o','c','o','c','n','n','o','c','o','c','o','c','o','c','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n',
+'n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','o','c','o','c','o','c','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n',
+'n','n','n','n','n','n','n','n','o','c','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','o','n','c','n','n',
+'n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','o','n','c','n','o','c','n','o','c','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n','n',
+};
+
+const CharacterTrie<char> bidi_paired_bracket_type_trie {bidi_paired_bracket_type_trie_top, bidi_paired_bracket_type_trie_index, bidi_paired_bracket_type_trie_data, 'n'};
+
 }
 }
@@ -0,0 +1,111 @@
+// Internal to the library, do not include this directly
+#pragma once
+#include <cstdint>
+namespace Unicorn {
+namespace UnicornDetail {
+constexpr uint16_t lp_white_space = 0x1;
+constexpr uint16_t lp_id_start = 0x2;
+constexpr uint16_t lp_id_nonstart = 0x4;
+constexpr uint16_t lp_xid_start = 0x8;
+constexpr uint16_t lp_xid_nonstart = 0x10;
+constexpr uint16_t lp_pattern_syntax = 0x20;
+constexpr uint16_t lp_pattern_white_space = 0x40;
+constexpr uint16_t lp_default_ignorable = 0x80;
+constexpr uint16_t lp_soft_dotted = 0x100;
+constexpr uint16_t lp_bidi_mirrored = 0x200;
+constexpr uint16_t lp_uppercase = 0x400;
+constexpr uint16_t lp_lowercase = 0x800;
+constexpr uint16_t lp_cased = 0x1000;
+constexpr uint16_t lp_case_ignorable = 0x2000;
+constexpr uint16_t latin1_general_category[256] {
+0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,
+0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,
+0x5a73,0x506f,0x506f,0x506f,0x5363,0x506f,0x506f,0x506f,0x5073,0x5065,0x506f,0x536d,0x506f,0x5064,0x506f,0x506f,
+0x4e64,0x4e64,0x4e64,0x4e64,0x4e64,0x4e64,0x4e64,0x4e64,0x4e64,0x4e64,0x506f,0x506f,0x536d,0x536d,0x536d,0x506f,
+0x506f,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,
+0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x5073,0x506f,0x5065,0x536b,0x5063,
+0x536b,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,
+0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x5073,0x536d,0x5065,0x536d,0x4363,
+0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,
+0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,0x4363,
+0x5a73,0x506f,0x5363,0x5363,0x5363,0x5363,0x536f,0x506f,0x536b,0x536f,0x4c6f,0x5069,0x536d,0x4366,0x536f,0x536b,
+0x536f,0x536d,0x4e6f,0x4e6f,0x536b,0x4c6c,0x506f,0x506f,0x536b,0x4e6f,0x4c6f,0x5066,0x4e6f,0x4e6f,0x4e6f,0x506f,
+0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,
+0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x536d,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c75,0x4c6c,
+0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,
+0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x536d,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,0x4c6c,
+};
+constexpr uint16_t latin1_properties[256] {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0041,0x0041,0x0041,0x0041,0x0041,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0041,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x2020,0x0220,0x0220,0x0020,0x0020,0x0020,0x0020,0x2020,0x0020,
+0x0014,0x0014,0x0014,0x0014,0x0014,0x0014,0x0014,0x0014,0x0014,0x0014,0x2020,0x0020,0x0220,0x0020,0x0220,0x0020,
+0x0020,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,
+0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x0220,0x0020,0x0220,0x2020,0x0014,
+0x2020,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x190a,0x190a,0x180a,0x180a,0x180a,0x180a,0x180a,
+0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x0220,0x0020,0x0220,0x0020,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0041,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0001,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x2000,0x0020,0x180a,0x0220,0x0020,0x2080,0x0020,0x2000,
+0x0020,0x0020,0x0000,0x0000,0x2000,0x180a,0x0020,0x2014,0x2000,0x0000,0x180a,0x0220,0x0000,0x0000,0x0000,0x0020,
+0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,
+0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x0020,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x140a,0x180a,
+0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,
+0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x0020,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,0x180a,
+};
+constexpr uint16_t latin1_uppercase[256] {
+0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,
+0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,
+0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,
+0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,
+0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,
+0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,
+0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,
+0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,
+0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,
+0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,
+0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,
+0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x39c,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,
+0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,
+0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,
+0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,
+0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0f7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x178,
+};
+constexpr uint16_t latin1_lowercase[256] {
+0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,
+0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,
+0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,
+0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,
+0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,
+0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,
+0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,
+0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,
+0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,
+0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,
+0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,
+0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,
+0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,
+0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0d7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0df,
+0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,
+0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff,
+};
+constexpr uint16_t latin1_casefold[256] {
+0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,
+0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,
+0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,
+0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,
+0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,
+0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,
+0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,
+0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,
+0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,
+0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,
+0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,
+0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x3bc,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,
+0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,
+0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0d7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0df,
+0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,
+0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff,
+};
+}
+}
@@ -0,0 +1,985 @@
+#include "unicorn/character.hpp"
+#include "unicorn/ucd-tables.hpp"
+
+namespace Unicorn {
+namespace UnicornDetail {
+
+CharProps const property_records_array[] {
+{0x4363,0,0,Bidi_Class::BN,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::CM,Sentence_Break::Other,Word_Break::Other},
+{0x4363,4,0,Bidi_Class::S,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::BA,Sentence_Break::Sp,Word_Break::Other},
+{0x4363,4,0,Bidi_Class::B,East_Asian_Width::N,Grapheme_Cluster_Break::LF,Line_Break::LF,Sentence_Break::LF,Word_Break::LF},
+{0x4363,4,0,Bidi_Class::S,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::BK,Sentence_Break::Sp,Word_Break::Newline},
+{0x4363,4,0,Bidi_Class::WS,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::BK,Sentence_Break::Sp,Word_Break::Newline},
+{0x4363,4,0,Bidi_Class::B,East_Asian_Width::N,Grapheme_Cluster_Break::CR,Line_Break::CR,Sentence_Break::CR,Word_Break::CR},
+{0x4363,0,0,Bidi_Class::B,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::CM,Sentence_Break::Other,Word_Break::Other},
+{0x4363,0,0,Bidi_Class::S,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::CM,Sentence_Break::Other,Word_Break::Other},
+{0x5a73,4,0,Bidi_Class::WS,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::SP,Sentence_Break::Sp,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::EX,Sentence_Break::STerm,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::QU,Sentence_Break::Close,Word_Break::Double_Quote},
+{0x506f,0,0,Bidi_Class::ET,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x5363,0,0,Bidi_Class::ET,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::PR,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ET,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::PO,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x506f,2,0,Bidi_Class::ON,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::QU,Sentence_Break::Close,Word_Break::Single_Quote},
+{0x5073,0,0,Bidi_Class::ON,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::OP,Sentence_Break::Close,Word_Break::Other},
+{0x5065,0,0,Bidi_Class::ON,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::CP,Sentence_Break::Close,Word_Break::Other},
+{0x536d,0,0,Bidi_Class::ES,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::PR,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::CS,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::IS,Sentence_Break::SContinue,Word_Break::MidNum},
+{0x5064,0,0,Bidi_Class::ES,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::HY,Sentence_Break::SContinue,Word_Break::Other},
+{0x506f,2,0,Bidi_Class::CS,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::IS,Sentence_Break::ATerm,Word_Break::MidNumLet},
+{0x506f,0,0,Bidi_Class::CS,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::SY,Sentence_Break::Other,Word_Break::Other},
+{0x4e64,0,0,Bidi_Class::EN,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::NU,Sentence_Break::Numeric,Word_Break::Numeric},
+{0x506f,2,0,Bidi_Class::CS,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::IS,Sentence_Break::SContinue,Word_Break::MidLetter},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::IS,Sentence_Break::Other,Word_Break::MidNum},
+{0x536d,0,0,Bidi_Class::ON,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x4c75,321,0,Bidi_Class::L,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Upper,Word_Break::ALetter},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::PR,Sentence_Break::Other,Word_Break::Other},
+{0x536b,2,0,Bidi_Class::ON,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x5063,0,0,Bidi_Class::ON,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::ExtendNumLet},
+{0x4c6c,161,0,Bidi_Class::L,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x536d,0,0,Bidi_Class::ON,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::BA,Sentence_Break::Other,Word_Break::Other},
+{0x5065,0,0,Bidi_Class::ON,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::Close,Word_Break::Other},
+{0x4363,4,0,Bidi_Class::B,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::NL,Sentence_Break::Sep,Word_Break::Newline},
+{0x5a73,20,0,Bidi_Class::CS,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::GL,Sentence_Break::Sp,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::OP,Sentence_Break::Other,Word_Break::Other},
+{0x5363,0,0,Bidi_Class::ET,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::PO,Sentence_Break::Other,Word_Break::Other},
+{0x5363,0,0,Bidi_Class::ET,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::PR,Sentence_Break::Other,Word_Break::Other},
+{0x536f,0,0,Bidi_Class::ON,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Other,Word_Break::Other},
+{0x536b,18,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Other,Word_Break::Other},
+{0x536f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x4c6f,17,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Lower,Word_Break::ALetter},
+{0x5069,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::QU,Sentence_Break::Close,Word_Break::Other},
+{0x4366,2,0,Bidi_Class::BN,East_Asian_Width::A,Grapheme_Cluster_Break::Control,Line_Break::BA,Sentence_Break::Format,Word_Break::Format},
+{0x536f,0,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x536b,18,0,Bidi_Class::ON,East_Asian_Width::Na,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x536f,0,0,Bidi_Class::ET,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::PO,Sentence_Break::Other,Word_Break::Other},
+{0x536d,0,0,Bidi_Class::ET,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::PR,Sentence_Break::Other,Word_Break::Other},
+{0x4e6f,16,0,Bidi_Class::EN,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Other,Word_Break::Other},
+{0x536b,18,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::BB,Sentence_Break::Other,Word_Break::Other},
+{0x4c6c,433,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x506f,2,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Other,Word_Break::MidLetter},
+{0x5066,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::QU,Sentence_Break::Close,Word_Break::Other},
+{0x4e6f,16,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Other,Word_Break::Other},
+{0x4c75,345,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Upper,Word_Break::ALetter},
+{0x4c75,321,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Upper,Word_Break::ALetter},
+{0x536d,0,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Other,Word_Break::Other},
+{0x4c6c,417,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x4c6c,185,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x4c6c,185,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x4c6c,161,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x4c75,321,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Upper,Word_Break::ALetter},
+{0x4c75,337,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Upper,Word_Break::ALetter},
+{0x4c6c,177,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x4c6c,1,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x4c6c,433,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x4c6c,161,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x4c6c,1,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x4c6f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4c75,465,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Upper,Word_Break::ALetter},
+{0x4c74,369,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Upper,Word_Break::ALetter},
+{0x4c6c,177,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x4c6c,441,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x4c6d,19,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x4c6d,2,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4c6d,2,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4c6d,3,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x536b,2,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x536b,2,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x4c6d,2,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4c6d,2,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::BB,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4c6d,2,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x536b,2,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::MidLetter},
+{0x536b,18,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x536b,2,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::BB,Sentence_Break::Other,Word_Break::Other},
+{0x4d6e,2,230,Bidi_Class::NSM,East_Asian_Width::A,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,232,Bidi_Class::NSM,East_Asian_Width::A,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,220,Bidi_Class::NSM,East_Asian_Width::A,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,216,Bidi_Class::NSM,East_Asian_Width::A,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,202,Bidi_Class::NSM,East_Asian_Width::A,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,1,Bidi_Class::NSM,East_Asian_Width::A,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,26,230,Bidi_Class::NSM,East_Asian_Width::A,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,419,240,Bidi_Class::NSM,East_Asian_Width::A,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,0,Bidi_Class::NSM,East_Asian_Width::A,Grapheme_Cluster_Break::Extend,Line_Break::GL,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,233,Bidi_Class::NSM,East_Asian_Width::A,Grapheme_Cluster_Break::Extend,Line_Break::GL,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,234,Bidi_Class::NSM,East_Asian_Width::A,Grapheme_Cluster_Break::Extend,Line_Break::GL,Sentence_Break::Extend,Word_Break::Extend},
+{0x4c6d,26,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x436e,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::XX,Sentence_Break::Other,Word_Break::Other},
+{0x506f,24,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::IS,Sentence_Break::Other,Word_Break::MidNum},
+{0x536b,26,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x506f,26,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::MidLetter},
+{0x4c6c,417,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x4c75,17,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Upper,Word_Break::ALetter},
+{0x4c75,25,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Upper,Word_Break::ALetter},
+{0x4c75,337,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Upper,Word_Break::ALetter},
+{0x536d,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x4c75,345,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Upper,Word_Break::ALetter},
+{0x536f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x4d6e,2,230,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d65,2,0,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x506f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::SContinue,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::IS,Sentence_Break::STerm,Word_Break::MidNum},
+{0x5064,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::BA,Sentence_Break::Other,Word_Break::Other},
+{0x5363,0,0,Bidi_Class::ET,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::PR,Sentence_Break::Other,Word_Break::Other},
+{0x436e,0,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::XX,Sentence_Break::Other,Word_Break::Other},
+{0x4d6e,2,220,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,222,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,228,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,10,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,11,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,12,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,13,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,14,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,15,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,16,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,17,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,18,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,19,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,20,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,21,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,22,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x5064,0,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::BA,Sentence_Break::Other,Word_Break::Other},
+{0x4d6e,2,23,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x506f,0,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x4d6e,2,24,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,25,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x506f,0,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::EX,Sentence_Break::Other,Word_Break::Other},
+{0x4c6f,0,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::HL,Sentence_Break::OLetter,Word_Break::Hebrew_Letter},
+{0x506f,0,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x506f,2,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::MidLetter},
+{0x4366,2,0,Bidi_Class::AN,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::AL,Sentence_Break::Format,Word_Break::Format},
+{0x536d,0,0,Bidi_Class::AL,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ET,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::PO,Sentence_Break::Other,Word_Break::Other},
+{0x5363,0,0,Bidi_Class::AL,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::PO,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::CS,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::IS,Sentence_Break::SContinue,Word_Break::MidNum},
+{0x506f,0,0,Bidi_Class::AL,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::IS,Sentence_Break::SContinue,Word_Break::MidNum},
+{0x4d6e,2,30,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,31,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,32,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x506f,0,0,Bidi_Class::AL,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::EX,Sentence_Break::Other,Word_Break::Other},
+{0x4366,2,0,Bidi_Class::AL,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::CM,Sentence_Break::Format,Word_Break::Format},
+{0x436e,0,0,Bidi_Class::AL,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::XX,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::AL,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::EX,Sentence_Break::STerm,Word_Break::Other},
+{0x4c6f,0,0,Bidi_Class::AL,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4c6f,24,0,Bidi_Class::AL,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4c6d,2,0,Bidi_Class::AL,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4d6e,2,27,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,28,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,29,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,33,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,34,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4e64,0,0,Bidi_Class::AN,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::NU,Sentence_Break::Numeric,Word_Break::Numeric},
+{0x506f,0,0,Bidi_Class::AN,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::NU,Sentence_Break::Numeric,Word_Break::Numeric},
+{0x506f,0,0,Bidi_Class::AN,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::NU,Sentence_Break::Numeric,Word_Break::MidNum},
+{0x506f,0,0,Bidi_Class::AL,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x4d6e,2,35,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4c6f,16,0,Bidi_Class::AL,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4e64,0,0,Bidi_Class::EN,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::NU,Sentence_Break::Numeric,Word_Break::Numeric},
+{0x536f,0,0,Bidi_Class::AL,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::AL,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::STerm,Word_Break::Other},
+{0x4366,2,0,Bidi_Class::AL,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::AL,Sentence_Break::Format,Word_Break::Format},
+{0x4d6e,2,36,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,0,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4e64,0,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::NU,Sentence_Break::Numeric,Word_Break::Numeric},
+{0x4c6f,0,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4c6d,2,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::IS,Sentence_Break::SContinue,Word_Break::MidNum},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::EX,Sentence_Break::STerm,Word_Break::Other},
+{0x4d63,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::SpacingMark,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4c6f,24,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4d6e,2,7,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,9,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x506f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::BA,Sentence_Break::STerm,Word_Break::Other},
+{0x4e64,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::NU,Sentence_Break::Numeric,Word_Break::Numeric},
+{0x4d63,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d63,24,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::SpacingMark,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x5363,0,0,Bidi_Class::ET,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::PO,Sentence_Break::Other,Word_Break::Other},
+{0x4e6f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x4e6f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::PO,Sentence_Break::Other,Word_Break::Other},
+{0x4d6e,26,0,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,84,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,91,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4e6f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x4d6e,2,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x536f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::PO,Sentence_Break::Other,Word_Break::Other},
+{0x4c6f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::SA,Sentence_Break::OLetter,Word_Break::Other},
+{0x4d6e,2,0,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::SA,Sentence_Break::Extend,Word_Break::Extend},
+{0x4c6f,16,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::SpacingMark,Line_Break::SA,Sentence_Break::OLetter,Word_Break::Other},
+{0x4d6e,2,103,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::SA,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,9,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::SA,Sentence_Break::Extend,Word_Break::Extend},
+{0x4c6d,2,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::SA,Sentence_Break::OLetter,Word_Break::Other},
+{0x4d6e,2,107,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::SA,Sentence_Break::Extend,Word_Break::Extend},
+{0x506f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::BA,Sentence_Break::Other,Word_Break::Other},
+{0x4d6e,2,118,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::SA,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,122,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::SA,Sentence_Break::Extend,Word_Break::Extend},
+{0x4c6f,16,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::SA,Sentence_Break::OLetter,Word_Break::Other},
+{0x536f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::BB,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::BB,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::GL,Sentence_Break::Other,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::GL,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::EX,Sentence_Break::Other,Word_Break::Other},
+{0x536f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::BA,Sentence_Break::Other,Word_Break::Other},
+{0x4d6e,2,216,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x5073,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::OP,Sentence_Break::Close,Word_Break::Other},
+{0x5065,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::Close,Word_Break::Other},
+{0x4d6e,2,129,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,130,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,132,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,18,0,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d63,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::SpacingMark,Line_Break::BA,Sentence_Break::Extend,Word_Break::Extend},
+{0x4c6f,24,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::SA,Sentence_Break::OLetter,Word_Break::Other},
+{0x4d63,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::SA,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d63,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::SpacingMark,Line_Break::SA,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,7,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::SA,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,220,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::SA,Sentence_Break::Extend,Word_Break::Extend},
+{0x536f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::SA,Sentence_Break::Other,Word_Break::Other},
+{0x4c6d,18,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4c6f,0,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::L,Line_Break::JL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4c6f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::V,Line_Break::JV,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4c6f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::T,Line_Break::JT,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x506f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::STerm,Word_Break::Other},
+{0x4c75,65,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Upper,Word_Break::ALetter},
+{0x5a73,4,0,Bidi_Class::WS,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::BA,Sentence_Break::Sp,Word_Break::Other},
+{0x4e6c,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x506f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::Other,Word_Break::Other},
+{0x4d6e,2,230,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::SA,Sentence_Break::Extend,Word_Break::Extend},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::EX,Sentence_Break::SContinue,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::BA,Sentence_Break::Other,Word_Break::Other},
+{0x5064,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::BB,Sentence_Break::Other,Word_Break::Other},
+{0x4366,2,0,Bidi_Class::BN,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::GL,Sentence_Break::Format,Word_Break::Format},
+{0x4e6f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::SA,Sentence_Break::Other,Word_Break::Other},
+{0x536f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::SA,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::SA,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::SA,Sentence_Break::STerm,Word_Break::Other},
+{0x4d63,0,9,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::SpacingMark,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,1,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,234,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,214,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,202,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,233,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4c74,377,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Upper,Word_Break::ALetter},
+{0x536b,26,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::BB,Sentence_Break::Other,Word_Break::Other},
+{0x5a73,28,0,Bidi_Class::WS,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::BA,Sentence_Break::Sp,Word_Break::Other},
+{0x5a73,20,0,Bidi_Class::WS,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::BA,Sentence_Break::Sp,Word_Break::Other},
+{0x5a73,20,0,Bidi_Class::WS,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::GL,Sentence_Break::Sp,Word_Break::Other},
+{0x4366,2,0,Bidi_Class::BN,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::ZW,Sentence_Break::Format,Word_Break::Other},
+{0x4366,2,0,Bidi_Class::BN,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4366,2,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::CM,Sentence_Break::Format,Word_Break::Format},
+{0x4366,2,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::CM,Sentence_Break::Format,Word_Break::Format},
+{0x5064,0,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::BA,Sentence_Break::Other,Word_Break::Other},
+{0x5064,16,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::GL,Sentence_Break::Other,Word_Break::Other},
+{0x5064,0,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::BA,Sentence_Break::SContinue,Word_Break::Other},
+{0x5064,0,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::B2,Sentence_Break::SContinue,Word_Break::Other},
+{0x5064,0,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Other,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x5069,2,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::QU,Sentence_Break::Close,Word_Break::MidNumLet},
+{0x5066,2,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::QU,Sentence_Break::Close,Word_Break::MidNumLet},
+{0x5069,0,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::QU,Sentence_Break::Close,Word_Break::Other},
+{0x5066,0,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::QU,Sentence_Break::Close,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x506f,18,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::IN,Sentence_Break::ATerm,Word_Break::MidNumLet},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::IN,Sentence_Break::Other,Word_Break::Other},
+{0x506f,2,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::BA,Sentence_Break::Other,Word_Break::MidLetter},
+{0x5a6c,4,0,Bidi_Class::WS,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::BK,Sentence_Break::Sep,Word_Break::Newline},
+{0x5a70,4,0,Bidi_Class::B,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::BK,Sentence_Break::Sep,Word_Break::Newline},
+{0x4366,2,0,Bidi_Class::LRE,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::CM,Sentence_Break::Format,Word_Break::Format},
+{0x4366,2,0,Bidi_Class::RLE,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::CM,Sentence_Break::Format,Word_Break::Format},
+{0x4366,2,0,Bidi_Class::PDF,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::CM,Sentence_Break::Format,Word_Break::Format},
+{0x4366,2,0,Bidi_Class::LRO,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::CM,Sentence_Break::Format,Word_Break::Format},
+{0x4366,2,0,Bidi_Class::RLO,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::CM,Sentence_Break::Format,Word_Break::Format},
+{0x506f,0,0,Bidi_Class::ET,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::PO,Sentence_Break::Other,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::ET,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::PO,Sentence_Break::Other,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::ET,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::PO,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::PO,Sentence_Break::Other,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::PO,Sentence_Break::Other,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::STerm,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::STerm,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x5063,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::ExtendNumLet},
+{0x536d,0,0,Bidi_Class::CS,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::IS,Sentence_Break::Other,Word_Break::MidNum},
+{0x4366,2,0,Bidi_Class::BN,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::WJ,Sentence_Break::Format,Word_Break::Format},
+{0x4366,2,0,Bidi_Class::BN,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::AL,Sentence_Break::Format,Word_Break::Format},
+{0x436e,0,0,Bidi_Class::BN,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::XX,Sentence_Break::Other,Word_Break::Other},
+{0x4366,2,0,Bidi_Class::LRI,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::CM,Sentence_Break::Format,Word_Break::Format},
+{0x4366,2,0,Bidi_Class::RLI,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::CM,Sentence_Break::Format,Word_Break::Format},
+{0x4366,2,0,Bidi_Class::FSI,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::CM,Sentence_Break::Format,Word_Break::Format},
+{0x4366,2,0,Bidi_Class::PDI,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::CM,Sentence_Break::Format,Word_Break::Format},
+{0x4366,2,0,Bidi_Class::BN,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::CM,Sentence_Break::Format,Word_Break::Format},
+{0x4e6f,16,0,Bidi_Class::EN,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x536d,16,0,Bidi_Class::ES,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x536d,16,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x5073,16,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::OP,Sentence_Break::Close,Word_Break::Other},
+{0x5065,16,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::Close,Word_Break::Other},
+{0x4c6d,19,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Lower,Word_Break::ALetter},
+{0x5363,16,0,Bidi_Class::ET,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::PR,Sentence_Break::Other,Word_Break::Other},
+{0x5363,0,0,Bidi_Class::ET,East_Asian_Width::H,Grapheme_Cluster_Break::Other,Line_Break::PR,Sentence_Break::Other,Word_Break::Other},
+{0x436e,0,0,Bidi_Class::ET,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::PR,Sentence_Break::Other,Word_Break::Other},
+{0x536f,16,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x536f,16,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::PO,Sentence_Break::Other,Word_Break::Other},
+{0x536f,16,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Other,Word_Break::Other},
+{0x4c6c,17,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x4c6c,17,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Lower,Word_Break::ALetter},
+{0x536f,16,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::PR,Sentence_Break::Other,Word_Break::Other},
+{0x4c75,345,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Upper,Word_Break::ALetter},
+{0x536f,0,0,Bidi_Class::ET,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x4c6f,16,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4e6f,16,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x4e6f,16,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x4e6f,16,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Other,Word_Break::Other},
+{0x4e6c,337,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Upper,Word_Break::ALetter},
+{0x4e6c,337,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Upper,Word_Break::ALetter},
+{0x4e6c,177,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Lower,Word_Break::ALetter},
+{0x4e6c,177,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x536f,0,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Other,Word_Break::Other},
+{0x536d,24,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x536f,24,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x536d,0,0,Bidi_Class::ES,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::PR,Sentence_Break::Other,Word_Break::Other},
+{0x536d,0,0,Bidi_Class::ET,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::PR,Sentence_Break::Other,Word_Break::Other},
+{0x536d,16,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Other,Word_Break::Other},
+{0x536d,24,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Other,Word_Break::Other},
+{0x536d,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::IN,Sentence_Break::Other,Word_Break::Other},
+{0x536f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x5073,24,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::OP,Sentence_Break::Close,Word_Break::Other},
+{0x5065,24,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::Close,Word_Break::Other},
+{0x536f,16,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Other,Word_Break::Other},
+{0x536f,337,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Upper,Word_Break::ALetter},
+{0x536f,177,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Lower,Word_Break::ALetter},
+{0x4e6f,0,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Other,Word_Break::Other},
+{0x4e6f,0,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x536f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Other,Word_Break::Other},
+{0x536f,0,0,Bidi_Class::ON,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x536f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::QU,Sentence_Break::Close,Word_Break::Other},
+{0x536f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::EX,Sentence_Break::Other,Word_Break::Other},
+{0x4e6f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::EX,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::QU,Sentence_Break::Close,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::OP,Sentence_Break::Other,Word_Break::Other},
+{0x5064,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x5064,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::B2,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::BA,Sentence_Break::STerm,Word_Break::Other},
+{0x536f,0,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x536f,16,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x5a73,20,0,Bidi_Class::WS,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::BA,Sentence_Break::Sp,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::SContinue,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::STerm,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x4c6d,2,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4c6f,0,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::OLetter,Word_Break::Other},
+{0x4e6c,0,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::OLetter,Word_Break::Other},
+{0x5073,0,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::OP,Sentence_Break::Close,Word_Break::Other},
+{0x5065,0,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::Close,Word_Break::Other},
+{0x5064,0,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::Other,Word_Break::Other},
+{0x4d6e,2,218,Bidi_Class::NSM,East_Asian_Width::W,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,228,Bidi_Class::NSM,East_Asian_Width::W,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,232,Bidi_Class::NSM,East_Asian_Width::W,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d6e,2,222,Bidi_Class::NSM,East_Asian_Width::W,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d63,0,224,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x5064,0,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x4c6d,2,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::OLetter,Word_Break::Katakana},
+{0x4c6d,2,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::CM,Sentence_Break::OLetter,Word_Break::Katakana},
+{0x4e6c,16,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::OLetter,Word_Break::Other},
+{0x4c6f,0,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4c6f,0,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::CJ,Sentence_Break::OLetter,Word_Break::Other},
+{0x4c6f,24,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::OLetter,Word_Break::Other},
+{0x4d6e,2,8,Bidi_Class::NSM,East_Asian_Width::W,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x536b,18,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::Other,Word_Break::Katakana},
+{0x4c6d,2,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::OLetter,Word_Break::Other},
+{0x4c6d,26,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::OLetter,Word_Break::Other},
+{0x4c6f,16,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::OLetter,Word_Break::Other},
+{0x5064,0,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::Other,Word_Break::Katakana},
+{0x4c6f,0,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::CJ,Sentence_Break::OLetter,Word_Break::Katakana},
+{0x4c6f,0,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::OLetter,Word_Break::Katakana},
+{0x4c6f,24,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::OLetter,Word_Break::Katakana},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::Other,Word_Break::Other},
+{0x4c6d,2,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::CJ,Sentence_Break::OLetter,Word_Break::Katakana},
+{0x4c6d,2,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::OLetter,Word_Break::Katakana},
+{0x4c6d,26,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::OLetter,Word_Break::Katakana},
+{0x4c6f,16,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::OLetter,Word_Break::Katakana},
+{0x4c6f,0,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4c6f,16,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x536f,0,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x4e6f,16,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x536f,16,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x4e6f,0,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Other,Word_Break::Other},
+{0x4e6f,16,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x536f,16,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Katakana},
+{0x436e,0,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x536b,2,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::BB,Sentence_Break::Other,Word_Break::Other},
+{0x4c6f,24,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::LV,Line_Break::H2,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4c6f,24,0,Bidi_Class::L,East_Asian_Width::W,Grapheme_Cluster_Break::LVT,Line_Break::H3,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4373,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::SG,Sentence_Break::Other,Word_Break::Other},
+{0x436f,0,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::XX,Sentence_Break::Other,Word_Break::Other},
+{0x4c6f,24,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::HL,Sentence_Break::OLetter,Word_Break::Hebrew_Letter},
+{0x4d6e,2,26,Bidi_Class::NSM,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4c6f,16,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::HL,Sentence_Break::OLetter,Word_Break::Hebrew_Letter},
+{0x536b,2,0,Bidi_Class::AL,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x436e,0,0,Bidi_Class::BN,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::XX,Sentence_Break::Other,Word_Break::Other},
+{0x5363,16,0,Bidi_Class::AL,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::PO,Sentence_Break::Other,Word_Break::Other},
+{0x4d6e,2,0,Bidi_Class::NSM,East_Asian_Width::A,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::IS,Sentence_Break::SContinue,Word_Break::MidNum},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::SContinue,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::Other,Word_Break::Other},
+{0x506f,18,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::IS,Sentence_Break::SContinue,Word_Break::MidLetter},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::IS,Sentence_Break::Other,Word_Break::MidNum},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::EX,Sentence_Break::Other,Word_Break::Other},
+{0x5073,16,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::OP,Sentence_Break::Close,Word_Break::Other},
+{0x5065,16,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::Close,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::IN,Sentence_Break::Other,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x5064,16,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::SContinue,Word_Break::Other},
+{0x5063,16,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::ExtendNumLet},
+{0x506f,16,0,Bidi_Class::CS,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::SContinue,Word_Break::MidNum},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::SContinue,Word_Break::Other},
+{0x506f,18,0,Bidi_Class::CS,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::ATerm,Word_Break::MidNumLet},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::Other,Word_Break::MidNum},
+{0x506f,18,0,Bidi_Class::CS,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::SContinue,Word_Break::MidLetter},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::EX,Sentence_Break::STerm,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::ET,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x536d,16,0,Bidi_Class::ES,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x5064,16,0,Bidi_Class::ES,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::SContinue,Word_Break::Other},
+{0x536d,16,0,Bidi_Class::ON,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x5363,16,0,Bidi_Class::ET,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::PR,Sentence_Break::Other,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::ET,East_Asian_Width::W,Grapheme_Cluster_Break::Other,Line_Break::PO,Sentence_Break::Other,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::EX,Sentence_Break::STerm,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::ET,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x5363,16,0,Bidi_Class::ET,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::PR,Sentence_Break::Other,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::ET,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::PO,Sentence_Break::Other,Word_Break::Other},
+{0x506f,18,0,Bidi_Class::ON,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::MidNumLet},
+{0x5073,16,0,Bidi_Class::ON,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::OP,Sentence_Break::Close,Word_Break::Other},
+{0x5065,16,0,Bidi_Class::ON,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::Close,Word_Break::Other},
+{0x536d,16,0,Bidi_Class::ES,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::CS,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::SContinue,Word_Break::MidNum},
+{0x5064,16,0,Bidi_Class::ES,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::SContinue,Word_Break::Other},
+{0x506f,18,0,Bidi_Class::CS,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::ATerm,Word_Break::MidNumLet},
+{0x506f,16,0,Bidi_Class::CS,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x4e64,16,0,Bidi_Class::EN,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x506f,18,0,Bidi_Class::CS,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::SContinue,Word_Break::MidLetter},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::Other,Word_Break::MidNum},
+{0x536d,16,0,Bidi_Class::ON,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x4c75,337,0,Bidi_Class::L,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Upper,Word_Break::ALetter},
+{0x536b,18,0,Bidi_Class::ON,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x5063,16,0,Bidi_Class::ON,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::ExtendNumLet},
+{0x4c6c,177,0,Bidi_Class::L,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Lower,Word_Break::ALetter},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::H,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::STerm,Word_Break::Other},
+{0x5073,16,0,Bidi_Class::ON,East_Asian_Width::H,Grapheme_Cluster_Break::Other,Line_Break::OP,Sentence_Break::Close,Word_Break::Other},
+{0x5065,16,0,Bidi_Class::ON,East_Asian_Width::H,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::Close,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::H,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::SContinue,Word_Break::Other},
+{0x506f,16,0,Bidi_Class::ON,East_Asian_Width::H,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::Other,Word_Break::Other},
+{0x4c6f,16,0,Bidi_Class::L,East_Asian_Width::H,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::OLetter,Word_Break::Katakana},
+{0x4c6f,16,0,Bidi_Class::L,East_Asian_Width::H,Grapheme_Cluster_Break::Other,Line_Break::CJ,Sentence_Break::OLetter,Word_Break::Katakana},
+{0x4c6d,18,0,Bidi_Class::L,East_Asian_Width::H,Grapheme_Cluster_Break::Other,Line_Break::CJ,Sentence_Break::OLetter,Word_Break::Katakana},
+{0x4c6d,18,0,Bidi_Class::L,East_Asian_Width::H,Grapheme_Cluster_Break::Extend,Line_Break::NS,Sentence_Break::Extend,Word_Break::Extend},
+{0x4c6f,16,0,Bidi_Class::L,East_Asian_Width::H,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x5363,16,0,Bidi_Class::ET,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::PO,Sentence_Break::Other,Word_Break::Other},
+{0x536f,16,0,Bidi_Class::ON,East_Asian_Width::F,Grapheme_Cluster_Break::Other,Line_Break::ID,Sentence_Break::Other,Word_Break::Other},
+{0x536f,16,0,Bidi_Class::ON,East_Asian_Width::H,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x536d,16,0,Bidi_Class::ON,East_Asian_Width::H,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x4366,2,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::CM,Sentence_Break::Format,Word_Break::Format},
+{0x536f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::CB,Sentence_Break::Other,Word_Break::Other},
+{0x4e6c,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4e6f,0,0,Bidi_Class::EN,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::BA,Sentence_Break::Other,Word_Break::Other},
+{0x4e6f,0,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x536f,0,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::BA,Sentence_Break::STerm,Word_Break::Other},
+{0x506f,0,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::IN,Sentence_Break::Other,Word_Break::Other},
+{0x4c75,321,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Upper,Word_Break::ALetter},
+{0x4c6c,161,0,Bidi_Class::R,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Lower,Word_Break::ALetter},
+{0x4e6f,0,0,Bidi_Class::AN,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x4366,2,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Control,Line_Break::AL,Sentence_Break::Format,Word_Break::Format},
+{0x4c6f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::OP,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x4c6f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::CL,Sentence_Break::OLetter,Word_Break::ALetter},
+{0x536f,24,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x4d63,0,216,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Extend,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d63,0,216,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::SpacingMark,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x4d63,0,226,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::SpacingMark,Line_Break::CM,Sentence_Break::Extend,Word_Break::Extend},
+{0x536d,16,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x4e64,16,0,Bidi_Class::EN,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::NU,Sentence_Break::Numeric,Word_Break::Numeric},
+{0x536f,16,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::AL,Sentence_Break::Other,Word_Break::Other},
+{0x536f,17,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Upper,Word_Break::ALetter},
+{0x536f,1,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Upper,Word_Break::ALetter},
+{0x536f,0,0,Bidi_Class::L,East_Asian_Width::A,Grapheme_Cluster_Break::Other,Line_Break::AI,Sentence_Break::Other,Word_Break::Other},
+{0x536f,0,0,Bidi_Class::L,East_Asian_Width::N,Grapheme_Cluster_Break::Regional_Indicator,Line_Break::RI,Sentence_Break::Other,Word_Break::Regional_Indicator},
+{0x536f,0,0,Bidi_Class::ON,East_Asian_Width::N,Grapheme_Cluster_Break::Other,Line_Break::NS,Sentence_Break::Other,Word_Break::Other},
+};
+
+const Irange<CharProps const*> property_records_table {std::begin(property_records_array), std::end(property_records_array)};
+
+const uint16_t property_records_trie_top[] {
+0,1,2,3,4,5,5,5,5,6,7,8,9,10,11,12,
+13,14,15,16,17,18,19,18,18,18,18,20,18,21,22,23,
+5,5,5,5,5,5,5,5,5,5,24,25,26,27,27,28,
+27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,29,
+18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,30,
+18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,30,
+18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,30,
+18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,30,
+18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,30,
+18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,30,
+18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,30,
+18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,30,
+18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,30,
+18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,30,
+31,18,18,18,18,18,18,18,18,18,18,18,18,18,18,30,
+11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,32,
+11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,32,
+};
+
+const uint16_t property_records_trie_index[] {
+0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,
+64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,72,72,72,72,72,72,72,72,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,99,106,107,108,109,110,111,111,112,113,114,115,116,117,
+118,119,120,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,150,150,150,151,151,152,153,154,155,151,156,157,158,159,160,161,162,163,164,165,166,167,168,169,170,171,172,173,173,173,174,
+175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,192,193,191,191,191,191,191,191,191,191,
+191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,194,
+195,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,197,198,72,72,72,72,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,224,225,226,227,228,229,223,224,225,226,227,228,229,223,224,
+225,226,227,228,229,223,224,225,226,227,228,229,223,224,225,226,227,228,229,223,224,225,226,227,228,229,223,224,225,226,227,228,229,223,224,225,226,227,228,229,223,224,225,226,227,228,229,223,224,225,226,227,228,229,223,224,225,226,227,228,229,223,224,225,
+226,227,228,229,223,224,225,226,227,228,229,223,224,225,226,227,228,229,223,224,225,226,227,228,229,223,224,225,226,227,228,229,223,224,225,226,227,228,229,223,224,225,226,227,228,229,223,224,225,226,227,228,229,223,224,225,226,227,228,229,223,224,225,226,
+227,228,229,223,224,225,226,227,228,229,223,224,225,226,227,228,229,223,224,225,226,227,228,229,223,224,225,226,227,228,230,231,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,
+233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,
+233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,234,234,234,234,235,236,234,237,238,239,240,241,242,242,242,242,243,244,245,246,247,248,242,249,250,251,252,253,
+254,255,72,256,257,258,259,260,99,99,261,262,263,264,265,266,267,268,269,99,270,271,99,99,72,72,72,72,272,273,99,99,274,275,276,277,278,279,280,281,282,283,284,285,286,287,288,279,289,290,291,292,279,279,279,279,279,293,279,279,279,279,279,279,
+294,295,296,297,298,299,300,301,302,99,303,304,305,306,99,99,99,99,307,308,99,99,309,310,311,312,313,314,315,99,99,99,99,99,316,317,99,99,99,99,99,99,99,318,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+72,72,72,72,72,72,72,72,72,72,72,72,72,72,319,99,320,321,72,72,72,322,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+72,72,72,72,72,72,72,72,72,323,324,72,72,325,72,72,326,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,72,72,72,72,72,72,72,327,72,328,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,72,72,72,72,72,72,72,72,318,329,99,330,331,332,333,99,99,99,99,99,99,99,99,99,99,99,99,99,72,334,335,99,
+336,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,72,337,338,99,99,99,99,99,99,99,99,99,99,99,99,99,
+150,150,150,339,340,341,342,343,193,344,99,99,193,345,99,99,346,347,348,349,350,351,352,353,354,355,356,357,358,359,360,361,150,150,150,150,150,150,150,150,362,363,364,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,289,289,289,365,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,366,367,368,369,279,279,279,279,
+370,371,372,373,374,375,376,377,378,379,99,99,371,371,380,381,371,371,382,371,383,384,385,386,371,387,371,388,193,389,193,390,391,392,393,99,394,99,395,396,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,397,
+191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,398,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,399,191,191,191,400,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,
+191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,401,402,402,402,402,402,
+402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,
+402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,234,234,234,234,234,234,234,234,403,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,404,
+402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,404,
+99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,397,
+405,406,407,407,408,408,408,409,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,407,
+233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,410,
+};
+
+const uint16_t property_records_trie_data[] {
+0,0,0,0,0,0,0,0,0,1,2,3,4,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,6,6,7,8,9,10,11,12,13,14,15,16,17,14,18,19,20,21,22,23,23,23,23,23,23,23,23,23,23,24,25,26,26,26,9,
+14,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,16,28,17,29,30,29,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,16,32,33,26,0,
+0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,36,37,12,38,12,39,40,41,42,43,44,26,45,46,47,48,49,50,50,51,52,40,53,41,50,43,54,55,55,55,36,
+56,56,56,56,56,56,57,56,56,56,56,56,56,56,56,56,57,56,56,56,56,56,56,58,57,56,56,56,56,56,57,59,60,60,61,61,61,61,62,61,60,60,60,61,60,60,61,61,62,61,60,60,61,61,61,58,62,60,60,61,60,61,62,61,
+56,60,56,61,56,61,56,61,56,61,56,61,56,61,56,61,63,62,56,60,56,61,56,61,56,61,56,60,56,61,56,61,56,61,56,61,56,61,57,62,56,61,56,60,56,61,56,61,56,62,64,65,56,61,56,61,66,56,61,56,61,56,61,64,
+65,57,62,56,60,56,61,56,60,67,57,62,56,60,56,61,56,61,57,62,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,57,62,56,61,56,60,56,61,56,61,56,61,56,61,56,61,56,61,56,56,61,56,61,56,61,52,
+68,63,63,68,63,68,63,63,68,63,63,63,68,69,63,63,63,63,68,63,63,68,63,63,63,68,68,69,63,63,68,63,56,61,63,68,63,68,63,63,68,63,69,69,63,68,63,56,61,63,63,63,68,63,68,63,63,68,69,70,63,68,69,68,
+70,70,70,70,71,72,73,71,72,73,71,72,73,56,60,56,60,56,60,56,60,56,60,56,60,56,60,56,60,68,56,61,56,61,56,61,63,68,56,61,56,61,56,61,56,61,56,61,74,71,72,73,56,61,63,63,56,61,56,61,56,61,56,61,
+56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,63,68,56,61,63,69,63,68,63,68,56,61,56,61,56,61,56,61,56,61,56,61,56,61,69,69,69,69,69,69,63,63,68,63,63,68,
+68,63,68,63,63,63,63,68,63,68,63,68,63,68,63,68,68,62,68,68,68,69,68,68,69,68,69,68,68,69,69,69,68,62,69,68,69,68,68,69,68,68,69,68,68,69,69,68,69,68,68,69,69,68,69,69,69,69,69,69,69,68,69,69,
+68,69,69,68,69,69,69,68,68,68,68,68,68,69,69,69,69,69,68,69,70,69,69,69,69,69,69,69,69,68,68,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,75,75,75,75,75,75,75,75,75,76,76,77,77,77,77,77,
+78,78,79,79,80,79,76,81,82,81,81,81,82,81,76,76,83,77,79,79,79,79,79,84,41,41,41,41,85,41,79,86,75,75,75,75,75,79,79,79,79,79,79,79,76,79,77,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,88,89,89,89,89,88,90,89,89,89,89,89,91,91,89,89,89,89,91,91,89,89,89,89,89,89,89,89,89,89,89,92,92,92,92,92,89,89,89,89,87,87,87,
+93,93,87,93,93,94,87,89,89,89,87,87,87,89,89,95,87,87,87,89,89,89,89,87,88,89,89,87,96,97,97,96,97,97,96,87,87,87,87,87,87,87,87,87,87,87,87,87,63,68,63,68,98,79,63,68,99,99,75,68,68,68,100,63,
+99,99,99,99,85,101,56,102,56,56,56,99,56,99,56,56,74,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,99,57,57,57,57,57,57,57,56,56,61,61,61,61,74,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,
+62,62,103,62,62,62,62,62,62,62,61,61,61,61,61,63,52,52,104,105,105,52,52,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,52,52,73,68,106,52,107,63,68,106,63,68,69,63,63,63,
+56,108,63,56,63,63,63,56,63,63,63,63,56,56,56,63,57,57,57,57,57,57,57,57,57,108,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,62,62,62,62,62,62,62,62,62,60,62,62,62,62,62,62,
+62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,61,60,68,61,68,68,68,61,68,68,68,68,61,61,61,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,56,61,63,68,63,68,63,68,63,68,
+63,68,109,110,110,110,110,110,111,111,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,
+63,56,61,63,68,63,68,63,68,63,68,63,68,63,68,68,56,61,56,61,63,68,56,61,63,68,56,61,56,61,56,61,63,68,56,61,56,61,56,61,63,68,56,61,56,61,56,61,56,61,56,61,56,61,63,68,56,61,63,68,63,68,63,68,
+63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,99,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,
+63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,99,99,77,112,112,112,113,112,112,99,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+68,68,68,68,68,68,68,52,99,114,115,99,99,42,42,116,117,118,110,110,110,110,118,110,110,110,119,118,110,110,110,110,110,110,118,118,118,118,118,118,110,110,118,110,110,119,120,110,121,122,123,124,125,126,127,128,129,130,130,131,132,133,134,135,
+136,137,138,136,110,118,139,129,117,117,117,117,117,117,117,117,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,117,117,117,117,117,140,140,140,141,142,117,117,117,117,117,117,117,117,117,117,117,
+143,143,143,143,143,143,107,107,144,145,145,146,147,148,42,42,110,110,110,110,110,110,110,110,149,150,151,152,153,154,152,155,156,156,157,157,157,157,157,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,
+158,156,156,156,156,156,156,156,156,156,156,159,160,161,149,150,151,162,163,110,110,118,118,110,110,110,110,110,118,110,110,118,164,164,164,164,164,164,164,164,164,164,145,165,166,167,156,156,168,156,156,156,156,169,169,169,169,156,156,156,156,156,156,156,
+156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,
+157,156,157,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,157,155,156,110,110,110,110,110,110,110,143,42,110,110,110,110,118,110,158,158,110,110,42,118,110,110,118,156,156,170,170,170,170,170,170,170,170,170,170,156,156,156,171,171,156,
+172,172,172,167,167,167,167,167,167,167,167,167,167,167,154,173,156,174,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,110,118,110,110,118,110,110,118,118,118,110,118,118,110,118,110,
+110,110,118,110,118,110,118,110,118,110,110,154,154,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,
+156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,175,175,175,175,175,175,175,175,175,175,175,156,154,154,154,154,154,154,154,154,154,154,154,154,154,154,
+176,176,176,176,176,176,176,176,176,176,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,110,110,110,110,110,110,110,118,110,178,178,42,179,180,181,178,117,117,117,117,117,
+177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,110,110,110,110,178,110,110,110,110,110,110,110,110,110,178,110,110,110,178,110,110,110,110,110,117,117,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,117,
+177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,118,118,118,117,117,136,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,
+117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,154,154,154,154,154,154,154,154,154,154,154,
+154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,118,110,110,118,110,110,118,110,110,110,118,118,118,159,160,161,110,110,110,118,110,110,118,118,110,110,110,110,110,
+175,175,175,182,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,183,70,70,70,70,70,70,70,183,70,70,183,70,70,70,70,70,175,182,184,70,182,182,
+182,175,175,175,175,175,175,175,175,182,182,182,182,185,182,182,70,110,118,110,110,175,175,175,183,183,183,183,183,183,183,183,70,70,175,175,186,186,187,187,187,187,187,187,187,187,187,187,112,77,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,175,182,182,99,70,70,70,70,70,70,70,70,99,99,70,70,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,99,70,99,99,99,70,70,70,70,99,99,184,70,188,182,
+182,175,175,175,175,99,99,182,182,99,99,189,189,185,70,99,99,99,99,99,99,99,99,188,99,99,99,99,183,183,99,183,70,70,175,175,99,99,187,187,187,187,187,187,187,187,187,187,70,70,190,190,191,191,191,191,191,192,109,116,99,99,99,99,
+99,175,175,182,99,70,70,70,70,70,70,99,99,99,99,70,70,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,99,70,183,99,70,183,99,70,70,99,99,184,99,182,182,
+182,175,175,99,99,99,99,175,175,99,99,175,175,185,99,99,99,175,99,99,99,99,99,99,99,183,183,183,70,99,183,99,99,99,99,99,99,99,187,187,187,187,187,187,187,187,187,187,175,175,70,70,70,175,99,99,99,99,99,99,99,99,99,99,
+99,175,175,182,99,70,70,70,70,70,70,70,70,70,99,70,70,70,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,99,70,70,99,70,70,70,70,70,99,99,184,70,182,182,
+182,175,175,175,175,175,99,175,175,182,99,182,182,185,99,99,70,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,70,70,175,175,99,99,187,187,187,187,187,187,187,187,187,187,112,116,99,99,99,99,99,99,99,70,99,99,99,99,99,99,
+99,175,182,182,99,70,70,70,70,70,70,70,70,99,99,70,70,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,99,70,70,99,70,70,70,70,70,99,99,184,70,188,175,
+182,175,175,175,175,99,99,182,189,99,99,189,189,185,99,99,99,99,99,99,99,99,175,188,99,99,99,99,183,183,99,70,70,70,175,175,99,99,187,187,187,187,187,187,187,187,187,187,109,70,191,191,191,191,191,191,99,99,99,99,99,99,99,99,
+99,99,175,70,99,70,70,70,70,70,70,99,99,99,70,70,70,99,70,70,183,70,99,99,99,70,70,99,70,99,70,70,99,99,99,70,70,99,99,99,70,70,70,99,99,99,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,188,182,
+175,182,182,99,99,99,182,182,182,99,189,189,189,185,99,99,70,99,99,99,99,99,99,188,99,99,99,99,99,99,99,99,99,99,99,99,99,99,187,187,187,187,187,187,187,187,187,187,191,191,191,42,42,42,42,42,42,116,42,99,99,99,99,99,
+175,182,182,182,99,70,70,70,70,70,70,70,70,99,70,70,70,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,70,175,175,
+175,182,182,182,182,99,175,175,193,99,175,175,175,185,99,99,99,99,99,99,99,194,195,99,70,70,70,99,99,99,99,99,70,70,175,175,99,99,187,187,187,187,187,187,187,187,187,187,99,99,99,99,99,99,99,99,196,196,196,196,196,196,196,109,
+99,175,182,182,99,70,70,70,70,70,70,70,70,99,70,70,70,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,70,70,70,99,70,70,70,70,70,99,99,184,70,182,197,
+189,182,188,182,182,99,197,189,189,99,189,189,175,185,99,99,99,99,99,99,99,188,188,99,99,99,99,99,99,99,70,99,70,70,175,175,99,99,187,187,187,187,187,187,187,187,187,187,99,70,70,99,99,99,99,99,99,99,99,99,99,99,99,99,
+99,175,182,182,99,70,70,70,70,70,70,70,70,99,70,70,70,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,70,188,182,
+182,175,175,175,175,99,182,182,182,99,189,189,189,185,70,99,99,99,99,99,99,99,99,188,99,99,99,99,99,99,99,70,70,70,175,175,99,99,187,187,187,187,187,187,187,187,187,187,191,191,191,191,191,191,99,99,99,198,70,70,70,70,70,70,
+99,99,182,182,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,70,70,99,70,99,99,
+70,70,70,70,70,70,70,99,99,99,185,99,99,99,99,188,182,182,175,175,175,99,175,99,182,182,189,182,189,189,189,188,99,99,99,99,99,99,187,187,187,187,187,187,187,187,187,187,99,99,182,182,112,99,99,99,99,99,99,99,99,99,99,99,
+99,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,200,199,201,200,200,200,200,202,202,203,99,99,99,99,116,
+199,199,199,199,199,199,204,200,205,205,205,205,200,200,200,112,187,187,187,187,187,187,187,187,187,187,206,206,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+99,199,199,99,199,99,99,199,199,99,199,99,99,199,99,99,99,99,99,99,199,199,199,199,99,199,199,199,199,199,199,199,99,199,199,199,99,199,99,199,99,99,199,199,99,199,199,199,199,200,199,201,200,200,200,200,207,207,99,200,200,199,99,99,
+199,199,199,199,199,99,204,99,208,208,208,208,200,200,99,99,187,187,187,187,187,187,187,187,187,187,99,99,209,209,199,199,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+70,210,210,210,211,112,211,211,212,211,211,206,213,214,214,214,214,214,212,109,214,109,109,109,118,118,109,109,109,109,109,109,187,187,187,187,187,187,187,187,187,187,191,191,191,191,191,191,191,191,191,191,215,118,109,118,109,216,217,218,217,218,182,182,
+70,70,70,183,70,70,70,70,99,70,70,70,70,183,70,70,70,70,183,70,70,70,70,183,70,70,70,70,183,70,70,70,70,70,70,70,70,70,70,70,70,183,70,70,70,99,99,99,99,219,220,193,221,193,193,222,193,222,220,220,220,220,175,223,
+220,193,110,110,185,206,110,110,70,70,70,70,70,175,175,175,175,175,175,193,175,175,175,175,99,175,175,175,175,193,175,175,175,175,193,175,175,175,175,193,175,175,175,175,193,175,175,175,175,175,175,175,175,175,175,175,175,193,175,175,175,99,215,215,
+109,109,109,109,109,109,118,109,109,109,109,109,109,99,109,109,211,211,206,211,112,109,109,109,109,212,212,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,224,199,199,199,199,225,225,200,200,200,200,226,200,200,200,200,200,227,225,203,203,226,226,200,200,199,
+187,187,187,187,187,187,187,187,187,187,186,186,112,112,112,112,199,199,199,199,199,199,226,226,200,200,199,199,199,199,200,200,200,199,225,225,225,199,199,225,225,225,225,225,225,225,199,199,199,200,200,200,200,199,199,199,199,199,199,199,199,199,199,199,
+199,199,200,225,226,200,200,225,225,225,225,225,225,228,199,225,187,187,187,187,187,187,187,187,187,187,225,225,225,200,229,229,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,
+63,63,63,63,63,63,99,63,99,99,99,99,99,63,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,112,230,70,70,70,
+231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,
+231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,
+232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,
+233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,70,70,70,70,70,99,70,70,70,70,99,99,70,70,70,70,70,70,70,99,70,99,70,70,70,70,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,70,70,70,70,70,99,70,70,70,70,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,70,70,70,70,99,99,70,70,70,70,70,70,70,99,
+70,99,70,70,70,70,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,70,70,70,70,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,110,110,110,112,206,234,112,112,112,112,234,234,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,42,42,42,42,42,42,42,42,42,42,99,99,99,99,99,99,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,
+235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,235,99,99,103,103,103,103,103,103,99,99,
+115,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,112,234,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+236,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,217,218,99,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,206,206,206,237,237,237,70,70,70,70,70,70,70,70,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,99,70,70,70,70,175,175,185,99,99,99,99,99,99,99,99,99,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,175,175,185,186,186,99,99,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,175,175,99,99,99,99,99,99,99,99,99,99,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,99,70,70,70,99,175,175,99,99,99,99,99,99,99,99,99,99,99,99,
+199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,200,200,226,200,200,200,200,200,200,200,226,226,
+226,226,226,226,226,226,200,226,226,200,200,200,200,200,200,200,200,200,203,200,206,206,238,204,206,112,206,116,199,239,99,99,187,187,187,187,187,187,187,187,187,187,99,99,99,99,99,99,196,196,196,196,196,196,196,196,196,196,99,99,99,99,99,99,
+179,179,240,181,241,241,242,179,240,181,179,175,175,175,243,99,187,187,187,187,187,187,187,187,187,187,99,99,99,99,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,77,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,120,70,99,99,99,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,175,175,175,182,182,182,182,175,175,182,182,182,99,99,99,99,182,182,175,182,182,182,182,182,182,119,110,118,99,99,99,99,
+42,99,99,99,181,181,187,187,187,187,187,187,187,187,187,187,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,99,99,199,199,199,199,199,99,99,99,99,99,99,99,99,99,99,99,
+199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,99,99,99,99,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,
+199,199,199,199,199,199,199,199,199,199,99,99,99,99,99,99,187,187,187,187,187,187,187,187,187,187,244,99,99,99,245,245,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,110,118,182,182,175,99,99,112,112,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,
+199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,226,200,226,200,200,200,200,200,200,200,99,203,225,200,225,225,200,200,200,200,200,200,200,200,226,226,226,226,226,226,200,200,239,239,239,239,239,239,239,239,99,99,118,
+187,187,187,187,187,187,187,187,187,187,99,99,99,99,99,99,187,187,187,187,187,187,187,187,187,187,99,99,99,99,99,99,246,246,246,246,246,246,246,204,247,247,247,247,246,246,99,99,110,110,110,110,110,118,118,118,118,118,118,110,110,118,111,99,
+99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+175,175,175,175,182,70,183,70,183,70,183,70,183,70,183,70,70,70,183,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,184,182,175,175,175,175,175,189,175,189,182,182,
+189,189,175,189,248,70,70,70,70,70,70,70,99,99,99,99,187,187,187,187,187,187,187,187,187,187,186,186,112,206,186,186,206,109,109,109,109,109,109,109,109,109,109,110,118,110,110,110,110,110,110,110,109,109,109,109,109,109,109,109,109,99,99,99,
+175,175,182,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,182,175,175,175,175,182,182,175,175,248,185,175,175,70,70,187,187,187,187,187,187,187,187,187,187,70,70,70,70,70,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,184,182,175,175,182,182,182,175,182,175,175,175,248,248,99,99,99,99,99,99,99,99,112,112,112,112,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,182,182,182,182,182,182,182,182,175,175,175,175,175,175,175,175,182,182,175,184,99,99,99,186,186,206,206,206,
+187,187,187,187,187,187,187,187,187,187,99,99,99,70,70,70,187,187,187,187,187,187,187,187,187,187,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,77,77,77,77,77,77,186,186,
+112,112,112,112,112,112,112,112,99,99,99,99,99,99,99,99,110,110,110,112,249,118,118,118,118,118,110,110,118,118,118,118,110,182,249,249,249,249,249,249,249,70,70,70,70,118,70,70,70,70,182,182,110,70,70,99,110,110,99,99,99,99,99,99,
+69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,75,75,75,78,75,75,75,75,75,75,75,75,75,75,75,78,75,75,75,75,
+75,75,75,75,75,75,75,75,75,75,75,75,75,75,78,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,69,69,69,69,69,69,69,69,69,69,69,69,69,75,68,69,69,69,68,69,69,
+69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,
+110,110,118,110,110,110,110,110,110,110,118,110,110,250,251,118,252,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,99,99,99,99,99,99,253,118,110,118,
+56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,
+56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,74,74,74,74,52,74,69,69,63,69,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,
+56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,56,61,63,68,63,68,63,68,
+61,61,61,61,61,61,61,61,56,56,56,56,56,56,56,56,61,61,61,61,61,61,99,99,56,56,56,56,56,56,99,99,61,61,61,61,61,61,61,61,56,56,56,56,56,56,56,56,61,61,61,61,61,61,61,61,56,56,56,56,56,56,56,56,
+61,61,61,61,61,61,99,99,56,56,56,56,56,56,99,99,74,61,74,61,74,61,74,61,99,56,99,56,99,56,99,56,61,61,61,61,61,61,61,61,56,56,56,56,56,56,56,56,61,61,61,61,61,61,61,61,61,61,61,61,61,61,99,99,
+74,74,74,74,74,74,74,74,254,254,254,254,254,254,254,254,74,74,74,74,74,74,74,74,254,254,254,254,254,254,254,254,74,74,74,74,74,74,74,74,254,254,254,254,254,254,254,254,61,61,74,74,74,99,74,74,56,56,56,56,254,85,74,85,
+85,101,74,74,74,99,74,74,56,56,56,56,254,101,101,101,61,61,74,74,99,99,74,74,56,56,56,56,99,101,101,101,61,61,74,74,74,61,74,74,56,56,56,56,56,101,101,101,99,99,74,74,74,99,74,74,56,56,56,56,254,255,85,99,
+256,256,257,257,257,257,257,258,257,257,257,259,260,260,261,262,263,264,115,265,266,267,40,268,269,270,217,44,271,272,217,44,40,40,273,179,274,275,275,276,277,278,279,280,281,282,283,35,284,145,284,285,286,287,288,288,179,44,54,40,289,290,291,292,
+292,179,179,179,293,217,218,289,289,289,179,179,179,179,179,179,179,179,107,179,292,179,241,268,241,241,241,241,179,241,241,257,294,295,295,295,295,296,297,298,299,300,301,301,301,301,301,301,302,75,99,99,50,302,302,302,302,302,303,303,304,305,306,307,
+302,50,50,50,50,302,302,302,302,302,303,303,304,305,306,99,75,75,75,75,75,75,75,75,75,75,75,75,75,99,99,99,116,116,116,116,116,116,116,190,308,309,116,116,38,116,116,116,116,116,116,116,116,116,190,116,116,116,116,190,116,116,190,310,
+310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,310,110,110,249,249,110,110,110,110,249,249,249,110,110,111,111,111,111,110,111,111,111,249,249,110,118,110,249,249,118,118,118,118,110,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+311,311,104,312,42,313,311,104,42,312,314,104,104,104,314,314,104,104,104,315,42,104,316,42,107,104,104,104,104,104,42,42,311,313,313,42,104,42,108,42,104,42,56,317,104,104,318,314,104,104,63,104,314,319,319,319,319,314,42,311,314,314,104,104,
+304,107,107,107,107,104,314,314,314,314,42,107,42,42,68,109,320,320,320,321,55,322,320,320,320,320,320,55,321,321,55,320,323,323,323,323,323,323,323,323,323,323,323,323,324,324,324,324,325,325,325,325,325,325,325,325,325,325,326,326,326,326,326,326,
+237,237,237,63,68,237,237,237,237,55,42,42,99,99,99,99,58,58,58,58,58,327,327,327,327,327,328,328,42,42,42,42,107,42,42,107,42,42,107,42,42,42,42,42,42,42,328,42,42,42,42,42,42,42,42,42,46,46,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,329,328,328,42,42,58,42,58,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,46,42,42,42,42,42,42,42,42,42,42,42,42,107,107,107,107,107,107,107,107,107,107,107,107,
+58,107,58,58,328,107,107,58,58,328,107,58,328,107,107,58,107,58,330,331,107,58,107,107,107,107,58,107,107,58,58,58,58,107,107,58,328,58,328,58,58,58,58,58,332,304,58,304,304,107,107,107,58,58,58,58,107,107,107,107,58,58,107,107,
+107,328,107,107,328,107,107,328,58,328,107,107,58,107,107,107,107,107,58,107,107,107,107,107,107,107,107,107,107,107,107,107,333,58,328,107,58,58,58,58,107,107,58,58,107,328,333,333,328,328,107,107,328,328,107,107,328,328,107,107,107,107,107,107,
+328,328,58,58,328,328,58,58,328,328,107,107,107,107,107,107,107,107,107,107,107,58,107,107,107,58,107,107,107,107,107,107,107,107,107,107,107,58,107,107,107,107,107,107,328,328,328,328,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,58,
+107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,328,328,328,328,107,107,107,107,107,107,328,328,328,328,107,334,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+42,42,42,42,42,42,42,42,217,218,217,218,42,42,42,42,42,42,327,42,42,42,42,42,42,42,335,335,42,42,42,42,107,107,42,42,42,42,42,42,42,336,337,42,42,42,42,42,42,42,42,42,42,42,109,109,109,109,109,109,109,109,109,109,
+109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,42,107,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,109,42,42,42,42,42,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,107,107,107,107,107,107,42,42,42,42,42,42,42,42,42,42,42,42,42,42,335,335,335,335,42,42,42,42,42,42,42,99,99,99,99,99,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+42,42,42,42,42,42,42,42,42,42,42,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+55,55,55,55,55,55,55,55,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,339,339,339,339,339,339,339,339,339,339,
+339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,340,322,341,341,341,341,341,341,341,341,341,341,341,341,341,341,341,341,341,341,341,341,342,
+327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,
+327,327,327,327,327,327,327,327,327,327,327,327,42,42,42,42,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,343,42,42,42,42,42,42,42,42,42,42,42,
+327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,42,42,327,327,327,327,42,42,42,42,42,42,42,42,42,42,327,327,42,327,327,327,327,327,327,327,42,42,42,42,42,42,42,42,327,327,42,42,327,58,42,42,42,42,327,327,42,42,
+327,58,42,42,42,42,327,327,327,42,42,327,42,42,327,327,327,327,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,327,327,327,327,42,42,42,42,42,42,42,42,42,327,42,42,42,42,42,42,42,42,107,107,107,107,107,107,107,107,
+335,335,335,335,42,327,327,42,42,327,42,42,42,42,327,327,42,42,42,42,344,344,343,343,335,42,335,335,344,335,344,335,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,335,335,335,42,42,42,42,
+327,42,327,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,327,327,42,327,327,327,42,327,344,327,327,42,327,327,42,58,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,335,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,327,327,42,42,42,42,42,42,42,42,42,42,42,42,109,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,335,344,344,
+335,335,335,335,344,344,344,344,344,327,327,327,327,344,42,344,344,344,327,344,344,327,327,327,344,344,327,327,344,327,327,344,344,344,42,327,42,42,42,42,327,327,344,327,327,327,327,327,327,344,344,344,344,344,327,344,344,344,344,327,327,344,344,344,
+335,335,335,335,335,42,42,42,335,335,335,335,335,335,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,46,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,327,42,42,42,345,345,345,345,345,345,42,346,346,42,42,42,42,217,218,217,218,217,218,217,218,217,218,217,218,217,218,341,341,341,341,341,341,341,341,341,341,
+347,347,347,347,347,347,347,347,347,347,347,347,347,347,347,347,347,347,347,347,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+107,107,107,107,107,217,218,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,16,33,16,33,16,33,16,33,217,218,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+107,107,107,217,218,16,33,217,218,217,218,217,218,217,218,217,218,217,218,217,218,217,218,217,218,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,217,218,217,218,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,217,218,107,107,
+107,107,107,107,107,107,107,107,107,107,107,107,304,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,304,304,304,107,107,107,107,107,107,107,107,107,
+107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,328,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+107,107,107,107,107,42,42,107,107,107,107,107,107,42,42,42,42,42,42,42,42,327,327,327,327,327,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,99,99,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,99,99,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,99,99,99,42,42,42,
+42,42,42,42,42,42,42,42,42,99,42,42,42,42,42,42,42,42,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,42,42,42,42,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,99,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,99,63,68,63,63,63,68,68,63,68,63,68,63,68,63,63,63,63,69,63,68,69,63,68,69,69,69,69,69,75,75,63,63,
+63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,
+63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,69,42,42,42,42,42,42,63,68,63,68,110,110,110,63,68,99,99,99,99,99,348,241,241,241,196,348,241,
+68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,99,68,99,99,99,99,99,68,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,99,99,99,230,206,99,99,99,99,99,99,99,99,99,99,99,99,99,99,185,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,99,99,99,99,99,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,99,
+70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,99,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+349,349,44,54,44,54,349,349,349,44,54,349,44,54,241,241,241,241,241,241,241,241,179,115,350,241,351,179,44,54,179,179,44,54,217,218,217,218,217,218,217,218,241,241,241,241,181,76,241,241,179,241,241,179,179,179,179,179,352,352,353,241,241,179,
+115,241,217,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,99,354,354,354,354,355,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,
+354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,355,99,99,99,99,99,99,99,99,99,99,99,99,
+355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,
+355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,354,354,354,354,354,354,354,354,354,354,354,354,99,99,99,99,
+356,357,358,359,354,360,361,362,363,364,363,364,363,364,363,364,363,364,354,354,363,364,363,364,363,364,363,364,365,363,364,364,354,362,362,362,362,362,362,362,362,362,366,367,368,369,370,370,371,372,372,372,372,373,355,354,374,374,374,360,375,359,354,335,
+99,376,361,376,361,376,361,376,361,376,361,361,377,361,377,361,377,361,377,361,377,361,377,361,377,361,377,361,377,361,377,361,377,361,377,376,361,377,361,377,361,377,361,361,361,361,361,361,377,377,361,377,377,361,377,377,361,377,377,361,377,377,361,361,
+361,361,361,376,361,376,361,376,361,361,361,361,361,361,376,361,361,361,361,361,377,376,376,99,99,378,378,379,379,380,381,382,383,384,385,384,385,384,385,384,385,384,385,385,386,385,386,385,386,385,386,385,386,385,386,385,386,385,386,385,386,385,386,385,
+386,385,386,384,385,386,385,386,385,386,385,385,385,385,385,385,386,386,385,386,386,385,386,386,385,386,386,385,386,386,385,385,385,385,385,384,385,384,385,384,385,385,385,385,385,385,384,385,385,385,385,385,386,384,384,386,386,386,386,387,388,389,390,391,
+99,99,99,99,99,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,99,99,99,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,
+393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,
+393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,99,394,394,395,395,395,395,396,396,396,396,396,396,396,396,396,396,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,99,99,99,99,99,
+354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,99,99,99,99,99,99,99,99,99,99,99,99,384,384,384,384,384,384,384,384,384,384,384,384,384,384,384,384,
+396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,355,355,99,395,395,395,395,395,395,395,395,395,395,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,
+396,396,396,396,396,396,396,396,397,397,397,397,397,397,397,397,355,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,355,355,355,394,
+395,395,395,395,395,395,395,395,395,395,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,
+396,396,396,396,396,396,396,396,396,396,396,396,355,355,355,355,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,99,
+399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,
+399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,355,355,355,355,396,396,396,396,396,
+396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,
+396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,355,355,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,355,
+361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,
+361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,400,400,400,400,400,400,400,400,400,400,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,
+392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,360,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,
+392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,
+392,392,392,392,392,392,392,392,392,392,392,392,392,99,99,99,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,354,
+354,354,354,354,354,354,354,99,99,99,99,99,99,99,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,77,77,77,77,77,77,206,186,
+70,70,70,70,70,70,70,70,70,70,70,70,77,241,181,353,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,187,187,187,187,187,187,187,187,187,187,70,70,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,70,110,111,111,111,179,110,110,110,110,110,110,110,110,110,110,179,76,
+63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,75,75,110,110,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,237,237,237,237,237,237,237,237,237,237,110,110,112,186,206,206,206,186,99,99,99,99,99,99,99,99,
+79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,76,76,76,76,76,76,76,76,76,79,79,63,68,63,68,63,68,63,68,63,68,63,68,63,68,69,69,63,68,63,68,63,68,63,68,63,68,63,68,63,68,
+63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,75,69,69,69,69,69,69,69,69,63,68,63,68,63,63,68,
+63,68,63,68,63,68,63,68,76,401,401,63,68,63,69,70,63,68,63,68,69,69,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,68,63,63,63,63,99,99,63,63,63,63,63,68,63,68,99,99,99,99,99,99,99,99,
+99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,70,75,75,69,70,70,70,70,70,
+70,70,175,70,70,70,185,70,70,70,70,175,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,182,182,175,175,182,42,42,42,42,99,99,99,99,191,191,191,191,191,191,109,109,190,318,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,402,402,181,181,99,99,99,99,99,99,99,99,
+182,182,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,182,182,182,182,182,182,182,182,182,182,182,182,
+182,182,182,182,185,99,99,99,99,99,99,99,99,99,186,186,187,187,187,187,187,187,187,187,187,187,99,99,99,99,99,99,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,70,70,70,70,70,70,112,112,112,70,211,70,99,99,
+187,187,187,187,187,187,187,187,187,187,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,175,175,175,175,175,118,118,118,206,186,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,70,70,70,175,175,175,175,175,175,175,175,175,175,175,182,248,99,99,99,99,99,99,99,99,99,99,99,112,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,231,99,99,99,
+175,175,175,182,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,184,182,182,175,175,175,175,182,182,175,182,182,182,
+248,112,112,112,112,112,112,206,186,186,112,112,112,112,99,77,187,187,187,187,187,187,187,187,187,187,99,99,99,99,112,112,199,199,199,199,199,200,204,199,199,199,199,199,199,199,199,199,187,187,187,187,187,187,187,187,187,187,199,199,199,199,199,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,175,175,175,175,175,175,182,182,175,175,182,182,175,175,99,99,99,99,99,99,99,99,99,
+70,70,70,175,70,70,70,70,70,70,70,70,175,182,99,99,187,187,187,187,187,187,187,187,187,187,99,99,112,186,186,186,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,204,199,199,199,199,199,199,229,229,229,199,225,200,225,199,199,
+199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,239,199,239,239,228,199,199,239,239,199,199,199,199,199,239,239,
+199,239,199,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,199,199,204,246,246,70,70,70,70,70,70,70,70,70,70,70,182,175,175,182,182,186,186,70,77,77,182,185,99,99,99,99,99,99,99,99,99,
+99,70,70,70,70,70,70,99,99,70,70,70,70,70,70,99,99,70,70,70,70,70,70,99,99,99,99,99,99,99,99,99,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,99,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,68,69,69,69,69,69,69,69,401,75,75,75,75,69,69,69,69,69,69,99,99,99,99,99,99,99,99,99,99,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,
+103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,182,182,175,182,182,175,182,182,186,182,185,99,99,187,187,187,187,187,187,187,187,187,187,99,99,99,99,99,99,
+403,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,403,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,403,404,404,404,404,404,404,404,
+404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,403,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,403,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,
+404,404,404,404,404,404,404,404,404,404,404,404,403,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,403,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,
+404,404,404,404,403,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,403,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,403,404,404,404,
+404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,403,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,403,404,404,404,404,404,404,404,404,404,404,404,
+404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,403,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,403,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,
+404,404,404,404,404,404,404,404,403,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,403,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,
+404,404,404,404,404,404,404,404,403,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,404,99,99,99,99,99,99,99,99,99,99,99,99,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,232,
+232,232,232,232,232,232,232,99,99,99,99,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,233,99,99,99,99,
+405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,405,
+406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,
+377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,
+377,377,377,377,377,377,377,377,377,377,377,377,377,377,361,361,377,361,377,361,361,377,377,377,377,377,377,377,377,377,377,361,377,361,377,361,361,377,377,361,361,361,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,
+377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,400,400,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,
+377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,
+52,52,52,52,52,52,52,99,99,99,99,99,99,99,99,99,99,99,99,52,52,52,52,52,99,99,99,99,99,407,408,407,409,409,409,409,409,409,409,409,409,303,407,407,407,407,407,407,407,407,407,407,407,407,407,117,407,407,407,407,407,117,407,117,
+407,407,117,407,407,117,407,407,407,407,407,407,407,407,407,409,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,410,410,410,410,410,410,410,410,410,410,410,410,410,410,
+410,410,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,218,217,
+154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,154,154,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+169,169,169,169,169,169,169,169,154,154,154,154,154,154,154,154,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,411,169,169,169,169,169,169,169,169,169,169,169,169,412,42,154,154,
+413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,414,415,416,417,418,419,419,420,421,422,99,99,99,99,99,99,110,110,110,110,110,110,110,118,118,118,118,118,118,118,110,110,423,424,424,425,425,420,421,420,421,420,421,420,421,420,421,420,
+421,420,421,420,421,359,359,420,421,423,423,423,423,425,425,425,426,427,428,99,429,430,431,431,424,420,421,420,421,420,421,432,423,423,433,434,435,435,435,99,423,436,437,423,99,99,99,99,169,169,169,156,169,154,169,169,169,169,169,169,169,169,169,169,
+169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,154,154,294,
+99,438,439,440,441,442,439,443,444,445,439,446,447,448,449,450,451,451,451,451,451,451,451,451,451,451,452,453,454,454,454,438,439,455,455,455,455,455,455,455,455,455,455,455,455,455,455,455,455,455,455,455,455,455,455,455,455,455,455,444,439,445,456,457,
+456,458,458,458,458,458,458,458,458,458,458,458,458,458,458,458,458,458,458,458,458,458,458,458,458,458,458,444,454,445,454,444,445,459,460,461,462,463,464,465,465,465,465,465,465,465,465,465,466,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,
+464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,467,467,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,468,99,
+99,99,468,468,468,468,468,468,99,99,468,468,468,468,468,468,99,99,468,468,468,468,468,468,99,99,468,468,468,99,99,99,469,441,454,456,470,441,441,99,471,472,472,472,472,471,471,99,296,296,296,296,296,296,296,296,296,473,473,473,474,327,411,411,
+70,70,70,70,70,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,70,70,99,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,99,
+206,241,206,99,99,99,99,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,99,99,99,109,109,109,109,109,109,109,109,109,
+475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,475,196,196,196,196,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,196,196,42,99,99,99,42,42,42,42,42,42,42,42,42,42,42,42,99,99,99,99,42,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,118,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,118,476,476,476,476,476,476,476,476,476,476,476,476,476,476,476,476,476,476,476,476,476,476,476,476,476,476,476,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,191,191,191,191,99,99,99,99,99,99,99,99,99,99,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,237,70,70,70,70,70,70,70,70,237,99,99,99,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,110,110,110,110,110,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,206,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,99,99,99,99,70,70,70,70,70,70,70,70,206,237,237,237,237,237,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,187,187,187,187,187,187,187,187,187,187,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,99,99,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,99,99,99,99,99,99,99,112,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,99,99,99,99,99,99,70,70,70,70,70,70,70,70,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+177,177,177,177,177,177,117,117,177,117,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,117,177,177,117,117,117,177,117,117,177,
+177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,117,477,478,478,478,478,478,478,478,478,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,479,479,478,478,478,478,478,478,478,
+177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,117,117,117,117,117,117,117,117,478,478,478,478,478,478,478,478,478,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,
+117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,117,177,177,117,117,117,117,117,478,478,478,478,478,
+177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,478,478,478,478,478,478,117,117,117,241,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,117,117,117,117,117,136,
+117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,
+177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,117,117,117,117,478,478,177,177,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,117,117,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+177,175,175,175,117,175,175,117,117,117,117,117,175,118,175,110,177,177,177,177,117,177,177,177,117,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,117,117,117,117,110,249,118,117,117,117,117,185,
+478,478,478,478,478,478,478,478,117,117,117,117,117,117,117,117,477,477,477,477,477,477,480,480,136,117,117,117,117,117,117,117,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,478,478,136,
+177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,478,478,478,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,
+177,177,177,177,177,177,177,177,479,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,110,118,117,117,117,117,478,478,478,478,478,477,477,477,477,477,477,481,117,117,117,117,117,117,117,117,117,
+177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,117,117,117,241,241,241,241,241,241,241,
+177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,117,117,478,478,478,478,478,478,478,478,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,117,117,117,117,117,478,478,478,478,478,478,478,478,
+177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,117,117,117,117,117,117,117,136,136,136,136,117,117,117,117,117,117,117,117,117,117,117,117,478,478,478,478,478,478,478,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,
+177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,
+177,177,177,177,177,177,177,177,177,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,
+482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,117,117,117,117,117,117,117,117,117,117,117,117,117,
+483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,483,117,117,117,117,117,117,117,478,478,478,478,478,478,
+117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,484,117,
+182,175,182,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,175,175,175,175,175,175,175,175,
+175,175,175,175,175,175,185,186,186,112,112,112,112,112,99,99,99,99,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,187,187,187,187,187,187,187,187,187,187,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,185,
+175,175,182,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,183,70,183,70,70,70,70,70,70,70,70,70,70,70,70,70,70,183,70,70,70,70,182,182,182,175,175,175,175,182,182,185,184,112,112,485,186,186,
+186,186,99,99,99,99,99,99,99,99,99,99,99,99,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,99,99,99,187,187,187,187,187,187,187,187,187,187,99,99,99,99,99,99,
+110,110,110,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,175,175,175,175,175,182,175,193,193,175,175,175,185,185,99,187,187,187,187,187,187,187,187,187,187,
+206,186,186,186,99,99,99,99,99,99,99,99,99,99,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,184,112,211,70,99,99,99,99,99,99,99,99,99,
+175,175,182,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,182,182,182,175,175,175,175,175,175,175,175,175,182,
+248,70,70,70,70,186,186,112,206,112,184,175,175,234,99,99,187,187,187,187,187,187,187,187,187,187,70,211,70,206,186,186,99,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,99,99,99,99,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,182,182,182,175,175,175,182,182,175,248,184,175,186,186,112,186,186,112,99,99,
+70,70,70,70,70,70,70,99,70,99,70,70,70,70,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,70,70,70,186,99,99,99,99,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,175,182,182,182,175,175,175,175,175,175,184,185,99,99,99,99,99,187,187,187,187,187,187,187,187,187,187,99,99,99,99,99,99,
+175,175,182,182,99,70,70,70,70,70,70,70,70,99,99,70,70,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,70,70,70,70,70,70,70,99,70,70,99,70,70,70,70,70,99,99,184,70,188,182,
+175,182,182,182,182,99,99,182,182,99,99,189,189,248,99,99,70,99,99,99,99,99,99,188,99,99,99,99,99,70,70,70,70,70,182,182,99,99,110,110,110,110,110,110,110,99,99,99,110,110,110,110,110,99,99,99,99,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,188,182,182,175,175,175,175,175,175,182,175,189,189,188,189,175,
+175,182,185,184,70,70,112,70,99,99,99,99,99,99,99,99,187,187,187,187,187,187,187,187,187,187,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,188,182,182,175,175,175,175,99,99,182,182,189,189,175,175,182,185,
+184,211,186,186,214,214,112,112,112,186,186,186,186,186,186,186,186,186,186,186,186,186,186,186,70,70,70,70,175,175,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,182,182,182,175,175,175,175,175,175,175,175,182,182,175,182,185,
+175,186,186,112,70,99,99,99,99,99,99,99,99,99,99,99,187,187,187,187,187,187,187,187,187,187,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,175,182,175,182,182,175,175,175,175,175,175,248,184,99,99,99,99,99,99,99,99,
+187,187,187,187,187,187,187,187,187,187,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,199,99,99,99,200,200,200,226,226,200,200,200,200,226,200,200,200,200,203,99,99,99,99,187,187,187,187,187,187,187,187,187,187,244,244,186,186,186,229,
+99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,
+68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,187,187,187,187,187,187,187,187,187,187,191,191,191,191,191,191,191,191,191,99,99,99,99,99,99,99,99,99,99,99,99,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,
+237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,237,99,206,206,206,206,206,99,99,99,99,99,99,99,99,99,99,99,
+70,70,70,70,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,486,486,486,487,487,487,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,487,70,70,70,486,487,486,487,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,486,487,487,70,70,70,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,486,487,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,70,70,70,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,187,187,187,187,187,187,187,187,187,187,99,99,99,99,186,186,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,249,249,249,249,249,186,99,99,99,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,110,110,110,110,110,110,110,186,186,206,112,112,109,109,109,109,
+77,77,77,77,186,109,99,99,99,99,99,99,99,99,99,99,187,187,187,187,187,187,187,187,187,187,99,191,191,191,191,191,191,191,99,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,99,70,70,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+70,70,70,70,70,99,99,99,99,99,99,99,99,99,99,99,70,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,99,
+99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,175,175,175,175,77,77,77,77,77,77,77,77,77,77,77,77,77,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+385,361,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,99,99,70,70,70,70,70,70,70,70,70,70,70,70,70,99,99,99,
+70,70,70,70,70,70,70,70,70,99,99,99,99,99,99,99,70,70,70,70,70,70,70,70,70,70,99,99,109,175,249,186,301,301,301,301,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,99,99,99,99,99,99,99,99,99,99,
+109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,99,99,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,488,488,488,488,488,488,488,489,490,249,249,249,109,109,109,491,489,489,489,489,489,301,301,301,301,301,301,301,301,118,118,118,118,118,
+118,118,118,109,109,110,110,110,110,110,118,118,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,110,110,110,110,109,109,109,109,109,109,109,109,109,109,109,109,109,488,488,488,488,488,
+488,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+42,42,110,110,110,42,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,99,99,99,99,99,99,99,99,99,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,191,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,104,104,104,104,104,104,104,104,104,104,104,104,
+104,104,104,104,104,104,104,104,104,104,104,104,104,104,314,314,314,314,314,314,314,99,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
+104,104,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,104,99,104,104,99,99,104,99,99,104,104,99,99,104,104,104,104,99,104,104,104,104,104,104,104,104,314,314,314,314,99,314,99,314,314,314,
+314,314,314,314,99,314,314,314,314,314,314,314,314,314,314,314,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
+314,314,314,314,104,104,99,104,104,104,104,99,99,104,104,104,104,104,104,104,104,99,104,104,104,104,104,104,104,99,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,104,104,99,104,104,104,104,99,
+104,104,104,104,104,99,104,99,99,99,104,104,104,104,104,104,104,99,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
+104,104,104,104,104,104,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,314,314,314,314,314,314,
+314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
+314,314,314,314,314,314,314,314,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,104,104,104,104,
+104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
+104,104,104,104,104,104,104,104,104,104,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,99,99,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
+104,492,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,304,314,314,314,314,314,314,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,492,314,314,314,314,
+314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,304,314,314,314,314,314,314,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,492,314,314,314,314,314,314,314,314,314,314,
+314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,304,314,314,314,314,314,314,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,492,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
+314,314,314,314,314,314,314,314,314,304,314,314,314,314,314,314,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,492,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,314,
+314,314,314,304,314,314,314,314,314,314,104,314,99,99,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,493,
+175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,109,109,109,109,175,175,175,175,175,
+175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,109,109,109,109,109,109,109,109,175,109,109,109,109,109,109,109,109,109,109,
+109,109,109,109,175,109,109,206,186,206,206,112,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,175,175,175,175,175,99,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+177,177,177,177,177,117,117,478,478,478,478,478,478,478,478,478,118,118,118,118,118,118,118,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,
+169,169,169,169,154,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,154,169,169,154,169,154,154,169,154,169,169,169,169,169,169,169,169,169,169,154,169,169,169,169,154,169,154,169,154,154,154,154,
+154,154,169,154,154,154,154,169,154,169,154,169,154,169,169,169,154,169,169,154,169,154,154,169,154,169,154,169,154,169,154,169,154,169,169,154,169,154,154,169,169,169,169,154,169,169,169,169,169,169,169,154,169,169,169,169,154,169,169,169,169,154,169,154,
+169,169,169,169,169,169,169,169,169,169,154,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,154,154,154,154,154,169,169,169,154,169,169,169,169,169,154,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,154,154,154,154,
+154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,107,107,154,154,154,154,154,154,154,154,154,154,154,154,154,154,
+335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,99,99,99,99,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,
+335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,
+335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,99,99,99,99,99,99,99,99,99,99,99,99,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,99,99,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,
+99,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,99,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,99,99,99,99,99,99,99,99,99,99,
+50,50,50,50,50,50,50,50,50,50,50,347,347,99,99,99,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,494,99,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,495,
+495,495,495,495,495,495,495,495,495,495,338,338,338,338,338,338,496,496,496,496,496,496,496,496,496,496,496,496,496,496,496,496,496,496,496,496,496,496,496,496,496,496,311,311,99,99,99,99,496,496,496,496,496,496,496,496,496,496,496,496,496,496,496,496,
+496,496,496,496,496,496,496,496,496,496,497,497,497,497,497,497,338,497,497,497,497,497,497,497,497,497,497,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,
+396,396,396,99,99,99,99,99,99,99,99,99,99,99,99,99,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,396,99,99,99,99,99,
+396,396,396,396,396,396,396,396,396,99,99,99,99,99,99,99,396,396,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,42,42,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,42,42,335,335,335,335,335,42,335,335,335,
+335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,79,79,79,79,79,
+335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,42,335,42,335,42,335,335,335,335,335,335,335,335,335,335,42,335,42,42,335,335,335,335,335,335,335,335,335,335,335,335,335,
+42,42,42,42,42,42,42,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,42,42,42,42,42,42,42,42,42,42,42,42,42,42,335,335,335,335,335,335,335,335,335,335,335,335,335,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,42,42,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,99,335,335,335,335,335,
+335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,99,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,
+335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,42,42,42,42,42,42,42,42,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,42,42,42,42,42,42,335,335,335,335,335,335,
+335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,345,345,345,499,499,499,42,42,42,42,
+335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,335,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,335,335,335,335,335,335,335,335,335,335,335,335,335,99,99,99,335,335,335,335,99,99,99,99,99,99,99,99,99,99,99,99,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,99,99,99,99,99,99,99,99,99,99,99,99,
+42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+42,42,42,42,42,42,42,42,42,42,42,42,99,99,99,99,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,99,99,99,99,99,99,99,99,42,42,42,42,42,42,42,42,42,42,99,99,99,99,99,99,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+42,42,42,42,42,42,42,42,99,99,99,99,99,99,99,99,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,335,335,335,335,335,335,335,335,335,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+335,335,335,335,335,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+335,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,411,411,
+361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,
+361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,400,400,400,400,400,400,400,400,400,400,400,
+361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,400,400,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,
+361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,
+400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,
+377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,377,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,
+400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,411,411,
+296,301,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,
+301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,
+296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,
+413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,
+413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,413,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,296,
+406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,411,411,
+};
+
+const CharacterTrie<uint16_t> property_records_trie {property_records_trie_top, property_records_trie_index, property_records_trie_data, 99};
+
+}
+}
@@ -1603,5 +1603,1704 @@ const KeyValue<char32_t, char const*> script_extensions_array[] {
 
 const TableView<char32_t, char const*> script_extensions_table {std::begin(script_extensions_array), std::end(script_extensions_array)};
 
+const uint16_t scripts_trie_top[] {
+0,1,2,3,4,5,5,5,5,6,7,8,8,9,10,11,
+12,13,14,15,16,10,17,10,10,10,10,18,10,19,20,21,
+5,5,5,5,5,5,5,5,5,5,22,23,24,10,10,25,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+26,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+};
+
+const uint16_t scripts_trie_index[] {
+0,1,2,3,4,4,4,4,4,4,5,6,7,8,9,10,11,11,12,11,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,
+57,57,58,59,60,60,60,60,61,62,63,64,65,66,67,68,69,69,69,69,69,69,69,69,69,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,87,94,95,96,97,98,4,4,4,4,99,100,101,102,
+103,104,105,106,107,108,109,0,0,0,0,0,0,0,0,110,111,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,113,113,113,113,0,0,0,0,0,0,0,0,0,114,115,116,117,118,119,120,121,122,123,124,0,125,126,127,128,128,128,129,
+130,131,132,133,134,60,135,136,137,138,0,139,140,141,0,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,142,0,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,143,
+144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,145,146,147,147,147,147,148,11,149,150,151,4,152,153,154,155,156,157,158,159,160,161,162,163,164,165,166,167,168,169,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,170,171,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,128,128,128,128,128,172,128,173,174,175,19,176,19,19,19,19,177,178,179,180,181,182,19,183,184,185,186,187,
+188,189,190,191,192,193,194,195,87,87,196,197,198,199,200,201,202,203,204,87,205,206,87,87,207,207,207,207,208,209,87,87,210,211,212,213,214,87,215,216,217,218,219,220,221,222,223,87,224,225,226,227,87,87,87,87,87,228,87,87,87,87,87,87,
+229,230,231,232,233,234,235,236,237,87,238,239,240,241,87,87,87,87,242,243,87,87,244,245,246,247,248,249,250,87,87,87,87,87,251,252,87,87,87,87,87,87,87,253,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+254,254,254,254,254,254,254,254,254,254,254,254,254,254,255,87,254,256,254,254,254,257,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,259,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,260,260,260,260,260,260,260,260,260,261,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,262,262,262,262,262,262,262,262,263,264,87,265,266,267,268,87,87,87,87,87,87,87,87,87,87,87,87,87,269,270,271,87,
+272,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,273,274,275,87,87,87,87,87,87,87,87,87,87,87,87,87,
+0,0,0,276,277,278,279,280,193,281,87,87,0,282,87,87,0,283,284,285,286,287,0,0,0,0,288,0,0,0,0,289,290,290,290,290,290,290,290,290,290,290,291,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,292,292,292,293,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,294,295,296,297,87,87,87,87,
+298,0,299,300,301,298,302,303,304,305,87,87,0,0,0,0,0,0,0,0,0,306,307,0,0,0,0,308,0,309,0,310,311,312,313,87,314,87,315,316,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,317,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,318,128,128,128,319,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,320,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,128,128,128,128,128,128,128,128,321,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+322,0,87,87,7,7,7,323,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+};
+
+const uint32_t scripts_trie_data[] {
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,1651470447,1651470447,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,1735550315,1735550315,1735550315,1735550315,2054781305,1735550315,1735550315,1735550315,2054847098,2054847098,1735550315,1735550315,1735550315,1735550315,2054781305,1735550315,
+2054847098,2054847098,2054847098,2054847098,1735550315,2054781305,1735550315,2054781305,1735550315,1735550315,1735550315,2054847098,1735550315,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,2053729896,2053729896,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,2054847098,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,
+1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,2054847098,2054847098,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,2054847098,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,
+1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,2054847098,2054781305,1634889070,2054847098,2054847098,1634889070,1634889070,1634889070,2054847098,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,
+1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,2054847098,2054847098,2054847098,2054847098,2054847098,1751474802,1751474802,1751474802,1751474802,1751474802,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1634885998,1634885998,1634885998,1634885998,1634885998,2054781305,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054781305,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054781305,2054781305,2054847098,1634885998,2054781305,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+2054781305,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2053729896,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054781305,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,2054847098,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,
+1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,2054847098,2054847098,1937338990,1937338990,1937338990,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,2054847098,2054847098,2054847098,2054847098,2054847098,
+1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,2054847098,2054847098,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,2054847098,
+1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,2054847098,2054847098,1835101796,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,
+1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,2053729896,2053729896,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,2054781305,2054781305,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,
+1650814567,1650814567,1650814567,1650814567,2054847098,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,2054847098,2054847098,1650814567,1650814567,2054847098,2054847098,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,2054847098,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,2054847098,1650814567,2054847098,2054847098,2054847098,1650814567,1650814567,1650814567,1650814567,2054847098,2054847098,1650814567,1650814567,1650814567,1650814567,
+1650814567,1650814567,1650814567,1650814567,1650814567,2054847098,2054847098,1650814567,1650814567,2054847098,2054847098,1650814567,1650814567,1650814567,1650814567,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1650814567,2054847098,2054847098,2054847098,2054847098,1650814567,1650814567,2054847098,1650814567,1650814567,1650814567,1650814567,1650814567,2054847098,2054847098,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,2054847098,2054847098,2054847098,2054847098,
+2054847098,1735750261,1735750261,1735750261,2054847098,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,2054847098,2054847098,2054847098,2054847098,1735750261,1735750261,2054847098,2054847098,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,2054847098,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,2054847098,1735750261,1735750261,2054847098,1735750261,1735750261,2054847098,1735750261,1735750261,2054847098,2054847098,1735750261,2054847098,1735750261,1735750261,
+1735750261,1735750261,1735750261,2054847098,2054847098,2054847098,2054847098,1735750261,1735750261,2054847098,2054847098,1735750261,1735750261,1735750261,2054847098,2054847098,2054847098,1735750261,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1735750261,1735750261,1735750261,1735750261,2054847098,1735750261,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,1735748210,1735748210,1735748210,2054847098,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,2054847098,1735748210,1735748210,1735748210,2054847098,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,2054847098,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,2054847098,1735748210,1735748210,2054847098,1735748210,1735748210,1735748210,1735748210,1735748210,2054847098,2054847098,1735748210,1735748210,1735748210,1735748210,
+1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,2054847098,1735748210,1735748210,1735748210,2054847098,1735748210,1735748210,1735748210,2054847098,2054847098,1735748210,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1735748210,1735748210,1735748210,1735748210,2054847098,2054847098,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1735748210,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,1869773153,1869773153,1869773153,2054847098,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,2054847098,2054847098,1869773153,1869773153,2054847098,2054847098,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,2054847098,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,2054847098,1869773153,1869773153,2054847098,1869773153,1869773153,1869773153,1869773153,1869773153,2054847098,2054847098,1869773153,1869773153,1869773153,1869773153,
+1869773153,1869773153,1869773153,1869773153,1869773153,2054847098,2054847098,1869773153,1869773153,2054847098,2054847098,1869773153,1869773153,1869773153,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1869773153,1869773153,2054847098,2054847098,2054847098,2054847098,1869773153,1869773153,2054847098,1869773153,1869773153,1869773153,1869773153,1869773153,2054847098,2054847098,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,1952542060,1952542060,2054847098,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,2054847098,2054847098,2054847098,1952542060,1952542060,1952542060,2054847098,1952542060,1952542060,1952542060,1952542060,2054847098,2054847098,2054847098,1952542060,1952542060,2054847098,1952542060,2054847098,1952542060,1952542060,2054847098,2054847098,2054847098,1952542060,1952542060,2054847098,2054847098,2054847098,1952542060,1952542060,1952542060,2054847098,2054847098,2054847098,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,2054847098,2054847098,2054847098,2054847098,1952542060,1952542060,
+1952542060,1952542060,1952542060,2054847098,2054847098,2054847098,1952542060,1952542060,1952542060,2054847098,1952542060,1952542060,1952542060,1952542060,2054847098,2054847098,1952542060,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1952542060,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,2054847098,2054847098,2054847098,2054847098,2054847098,
+1952803957,1952803957,1952803957,1952803957,2054847098,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,2054847098,1952803957,1952803957,1952803957,2054847098,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,2054847098,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,2054847098,2054847098,2054847098,1952803957,1952803957,1952803957,
+1952803957,1952803957,1952803957,1952803957,1952803957,2054847098,1952803957,1952803957,1952803957,2054847098,1952803957,1952803957,1952803957,1952803957,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1952803957,1952803957,2054847098,1952803957,1952803957,1952803957,2054847098,2054847098,2054847098,2054847098,2054847098,1952803957,1952803957,1952803957,1952803957,2054847098,2054847098,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,
+2054847098,1802396769,1802396769,1802396769,2054847098,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,2054847098,1802396769,1802396769,1802396769,2054847098,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,2054847098,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,2054847098,1802396769,1802396769,1802396769,1802396769,1802396769,2054847098,2054847098,1802396769,1802396769,1802396769,1802396769,
+1802396769,1802396769,1802396769,1802396769,1802396769,2054847098,1802396769,1802396769,1802396769,2054847098,1802396769,1802396769,1802396769,1802396769,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1802396769,1802396769,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1802396769,2054847098,1802396769,1802396769,1802396769,1802396769,2054847098,2054847098,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,2054847098,1802396769,1802396769,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,1835825517,1835825517,1835825517,2054847098,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,2054847098,1835825517,1835825517,1835825517,2054847098,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,2054847098,2054847098,1835825517,1835825517,1835825517,
+1835825517,1835825517,1835825517,1835825517,1835825517,2054847098,1835825517,1835825517,1835825517,2054847098,1835825517,1835825517,1835825517,1835825517,1835825517,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1835825517,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1835825517,1835825517,1835825517,1835825517,1835825517,2054847098,2054847098,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,2054847098,2054847098,2054847098,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,
+2054847098,2054847098,1936289384,1936289384,2054847098,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,2054847098,2054847098,2054847098,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,2054847098,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,2054847098,1936289384,2054847098,2054847098,
+1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,2054847098,2054847098,2054847098,1936289384,2054847098,2054847098,2054847098,2054847098,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,2054847098,1936289384,2054847098,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,2054847098,2054847098,1936289384,1936289384,1936289384,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,2054847098,2054847098,2054847098,2054847098,2054781305,
+1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,1818324847,1818324847,2054847098,1818324847,2054847098,2054847098,1818324847,1818324847,2054847098,1818324847,2054847098,2054847098,1818324847,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1818324847,1818324847,1818324847,1818324847,2054847098,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,2054847098,1818324847,1818324847,1818324847,2054847098,1818324847,2054847098,1818324847,2054847098,2054847098,1818324847,1818324847,2054847098,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,2054847098,1818324847,1818324847,1818324847,2054847098,2054847098,
+1818324847,1818324847,1818324847,1818324847,1818324847,2054847098,1818324847,2054847098,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,2054847098,2054847098,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,2054847098,2054847098,1818324847,1818324847,1818324847,1818324847,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,
+1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,2054847098,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,2054847098,2054847098,2054847098,2054847098,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,
+1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,2054847098,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,2054847098,1953063540,1953063540,
+1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,2054847098,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,2054781305,2054781305,2054781305,2054781305,1953063540,1953063540,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,
+1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,
+1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,2054847098,1734700914,2054847098,2054847098,2054847098,2054847098,2054847098,1734700914,2054847098,2054847098,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,2054781305,1734700914,1734700914,1734700914,1734700914,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,
+1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,2054847098,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,
+1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,2054847098,2054847098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,2054847098,2054847098,
+1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,
+1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,2054847098,2054847098,2054847098,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,
+1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,2054781305,2054781305,2054781305,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1952935015,1952935015,1952935015,1952935015,1952935015,1952935015,1952935015,1952935015,1952935015,1952935015,1952935015,1952935015,1952935015,2054847098,1952935015,1952935015,1952935015,1952935015,1952935015,1952935015,1952935015,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1952540514,1952540514,1952540514,1952540514,1952540514,1952540514,1952540514,1952540514,1952540514,1952540514,1952540514,1952540514,1952540514,2054847098,1952540514,1952540514,1952540514,2054847098,1952540514,1952540514,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,
+1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,2054847098,2054847098,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1836019303,1836019303,2054781305,2054781305,1836019303,2054781305,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,2054847098,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,
+1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,2054847098,2054847098,2054847098,2054847098,2054847098,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,
+1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,2054847098,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,2054847098,2054847098,2054847098,2054847098,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,2054847098,2054847098,2054847098,2054847098,
+1818848610,2054847098,2054847098,2054847098,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,2054847098,2054847098,1952541797,1952541797,1952541797,1952541797,1952541797,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,2054847098,2054847098,2054847098,2054847098,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,
+1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,2054847098,2054847098,2054847098,1952541813,1952541813,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,
+1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,2054847098,2054847098,1651861353,1651861353,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,
+1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,2054847098,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,2054847098,2054847098,1818324577,
+1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,2054847098,2054847098,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,
+1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,2054847098,2054847098,2054847098,2054847098,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,2054847098,2054847098,2054847098,
+1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,
+1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1650553963,1650553963,1650553963,1650553963,
+1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,2054847098,2054847098,2054847098,1818587235,1818587235,1818587235,1818587235,1818587235,
+1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,2054847098,2054847098,2054847098,1818587235,1818587235,1818587235,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,
+1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2053729896,2053729896,2053729896,2054781305,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2054781305,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2054781305,2054781305,2054781305,2054781305,2053729896,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2053729896,2054781305,2054781305,2054847098,2053729896,2053729896,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1735550315,1735550315,1735550315,1735550315,1735550315,1668903539,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1735550315,1735550315,1735550315,1735550315,1735550315,1818326126,1818326126,1818326126,1818326126,1735550315,1735550315,1735550315,1735550315,1735550315,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1668903539,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1735550315,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2053729896,2053729896,2053729896,2053729896,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,1735550315,2054847098,1735550315,2054847098,1735550315,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,2054847098,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,2054847098,1735550315,1735550315,1735550315,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2053729896,2053729896,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1818326126,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1818326126,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1735550315,2054781305,2054781305,2054781305,1818326126,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,2054847098,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,
+1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,2054847098,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,
+1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,2054847098,2054847098,2054847098,2054847098,2054847098,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,
+1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,2054847098,1734700914,2054847098,2054847098,2054847098,2054847098,2054847098,1734700914,2054847098,2054847098,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,
+1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1952869991,1952869991,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1952869991,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,1751215732,2054781305,1751215732,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2053729896,2053729896,2053729896,2053729896,1751215719,1751215719,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1751215732,1751215732,1751215732,1751215732,2054781305,2054781305,2054781305,2054781305,
+2054847098,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,
+1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,2054847098,2054847098,2053729896,2053729896,2054781305,2054781305,1751741025,1751741025,1751741025,2054781305,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,2054781305,2054781305,1801547361,1801547361,1801547361,
+2054847098,2054847098,2054847098,2054847098,2054847098,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,2054847098,2054847098,2054847098,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,2054847098,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,
+2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2054847098,2054847098,2054847098,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,
+2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,
+1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,
+1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,2054781305,2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054847098,2054847098,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,
+1935766898,1935766898,1935766898,1935766898,1935766898,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,2054847098,2054847098,
+1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,2054781305,1801546857,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,
+1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1919577703,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054847098,2054847098,2054847098,
+1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,
+1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,2054847098,2054781305,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,2054847098,2054847098,2054847098,2054847098,1784772193,1784772193,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,2054847098,
+1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,2054847098,2054847098,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,2054847098,2054847098,1667785069,1667785069,1667785069,1667785069,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,
+1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,
+1952544372,1952544372,1952544372,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1952544372,1952544372,1952544372,1952544372,1952544372,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1735550315,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,
+1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,
+1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,2054847098,2054847098,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054847098,2054847098,2054847098,2054847098,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054847098,2054847098,2054847098,2054847098,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1634889070,1634889070,1634889070,1634889070,1634889070,2054847098,2054847098,2054847098,2054847098,2054847098,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,2054847098,1751474802,1751474802,1751474802,1751474802,1751474802,2054847098,1751474802,2054847098,
+1751474802,1751474802,2054847098,1751474802,1751474802,2054847098,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054781305,2054781305,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,2054847098,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,1668903539,1668903539,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,2054847098,2054781305,
+2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,2054781305,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,2054781305,2054781305,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054847098,
+2054847098,2054847098,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054847098,2054847098,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054847098,2054847098,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054847098,2054847098,1751215719,1751215719,1751215719,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,
+1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,2054847098,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,2054847098,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,2054847098,1818848866,1818848866,2054847098,1818848866,
+1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,2054847098,2054847098,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,
+1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,1735550315,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2053729896,2054847098,2054847098,
+1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,2054847098,2054847098,2054847098,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,
+1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2053729896,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,
+1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,
+1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,2054847098,2054847098,2054847098,2054847098,2054847098,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,2054847098,2054847098,2054847098,2054847098,2054847098,
+1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,2054847098,1969709426,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,
+2020631919,2020631919,2020631919,2020631919,2054847098,2054847098,2054847098,2054847098,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,
+1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,
+1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,2054847098,2054847098,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,
+1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1634166882,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,
+1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,2054847098,2054847098,1668313716,2054847098,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,2054847098,1668313716,1668313716,2054847098,2054847098,2054847098,1668313716,2054847098,2054847098,1668313716,
+1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,2054847098,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,
+1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,2054847098,1751217266,1751217266,2054847098,2054847098,2054847098,2054847098,2054847098,1751217266,1751217266,1751217266,1751217266,1751217266,
+1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,2054847098,2054847098,2054847098,1885892216,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,2054847098,2054847098,2054847098,2054847098,2054847098,1819894889,
+1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,2054847098,2054847098,2054847098,2054847098,1835364963,1835364963,1835364963,1835364963,
+1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,2054847098,2054847098,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,
+1802002802,1802002802,1802002802,1802002802,2054847098,1802002802,1802002802,2054847098,2054847098,2054847098,2054847098,2054847098,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,2054847098,1802002802,1802002802,1802002802,2054847098,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,2054847098,2054847098,2054847098,2054847098,1802002802,1802002802,1802002802,2054847098,2054847098,2054847098,2054847098,1802002802,
+1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,
+1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,2054847098,2054847098,2054847098,2054847098,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,2054847098,2054847098,2054847098,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,
+1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,2054847098,2054847098,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,2054847098,2054847098,2054847098,2054847098,2054847098,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,
+1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1885891696,1885891696,1885891696,1885891696,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,
+1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,
+1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,
+1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,2054847098,2054847098,2054847098,2054847098,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1651663208,
+1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,
+1802791017,1802791017,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,2054847098,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,
+1667328877,1667328877,1667328877,1667328877,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,
+1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,2054847098,2054847098,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,2054847098,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,2054847098,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,2054847098,2054847098,
+1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,2054847098,1836412020,2054847098,1836412020,1836412020,1836412020,1836412020,2054847098,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,2054847098,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,
+1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,2054847098,2054847098,2054847098,2054847098,2054847098,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1735549294,1735549294,1735549294,1735549294,2054847098,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,2054847098,2054847098,1735549294,1735549294,2054847098,2054847098,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,2054847098,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,2054847098,1735549294,1735549294,2054847098,1735549294,1735549294,1735549294,1735549294,1735549294,2054847098,2054847098,1735549294,1735549294,1735549294,1735549294,
+1735549294,1735549294,1735549294,1735549294,1735549294,2054847098,2054847098,1735549294,1735549294,2054847098,2054847098,1735549294,1735549294,1735549294,2054847098,2054847098,1735549294,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1735549294,2054847098,2054847098,2054847098,2054847098,2054847098,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,2054847098,2054847098,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,2054847098,2054847098,2054847098,1735549294,1735549294,1735549294,1735549294,1735549294,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,
+1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,2054847098,2054847098,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,
+1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,
+1836016745,1836016745,1836016745,1836016745,1836016745,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,2054847098,2054847098,2054847098,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,2054847098,2054847098,2054847098,2054847098,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,
+2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2002874977,
+1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2054847098,2020832632,2020832632,2020832632,2020832632,2020832632,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2020832632,2020832632,2020832632,2020832632,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,
+1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,
+1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,2054847098,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,2054847098,2054847098,2054847098,2054847098,1836216175,1836216175,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,2054847098,2054847098,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,
+1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,2054847098,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,2054847098,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,2054847098,2054847098,2054847098,2054847098,2054847098,1752002151,1752002151,1752002151,
+1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,
+1886155364,1886155364,1886155364,1886155364,1886155364,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1801547361,1751741025,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,
+1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,2054847098,2054847098,2054847098,2054847098,2054847098,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,2054847098,2054847098,2054847098,
+1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,2054847098,2054847098,1685418092,1685418092,1685418092,1685418092,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2053729896,2053729896,2053729896,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2054781305,2054781305,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2053729896,2053729896,2053729896,2053729896,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054847098,2054847098,2054781305,2054847098,2054847098,2054781305,2054781305,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054847098,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,
+1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1936158327,1936158327,1936158327,1936158327,1936158327,2054847098,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,
+1835363940,1835363940,1835363940,1835363940,1835363940,2054847098,2054847098,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,2054847098,1634885998,2054847098,2054847098,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,2054847098,1634885998,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,1634885998,2054847098,2054847098,2054847098,2054847098,1634885998,2054847098,1634885998,2054847098,1634885998,2054847098,1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,2054847098,1634885998,2054847098,2054847098,1634885998,2054847098,1634885998,2054847098,1634885998,2054847098,1634885998,2054847098,1634885998,2054847098,1634885998,1634885998,2054847098,1634885998,2054847098,2054847098,1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,2054847098,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,2054847098,2054847098,2054847098,2054847098,1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1634885998,1634885998,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+1751741025,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+};
+
+const CharacterTrie<uint32_t> scripts_trie {scripts_trie_top, scripts_trie_index, scripts_trie_data, 2054847098};
+
+const uint16_t script_extensions_trie_top[] {
+0,1,2,3,4,4,4,4,4,4,5,6,6,6,6,7,
+8,9,9,9,9,9,9,9,9,9,9,10,11,12,13,13,
+13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+};
+
+const uint16_t script_extensions_trie_index[] {
+0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,2,2,2,3,4,4,4,5,6,7,8,9,9,9,9,9,9,9,9,9,9,9,10,11,12,13,14,15,16,17,17,18,19,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+20,21,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,23,24,24,24,25,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,27,28,28,28,29,30,30,30,30,30,30,30,30,
+30,30,30,31,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+33,34,35,36,37,37,38,39,40,41,42,43,44,45,46,47,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,49,50,50,50,50,50,50,51,52,52,53,54,55,55,56,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,
+57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,
+57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,58,59,60,61,61,61,62,63,64,
+64,64,64,64,65,66,66,66,66,66,66,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,69,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+70,70,70,70,70,70,70,70,70,70,70,70,70,71,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+};
+
+const uint16_t script_extensions_trie_data[] {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,2,2,3,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,7,8,9,9,10,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+11,11,11,11,11,11,11,11,11,12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,13,13,13,13,14,15,15,15,15,15,15,15,15,15,15,15,15,15,15,16,17,17,17,18,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,
+20,21,21,21,21,21,21,21,21,21,21,22,22,22,22,22,22,22,22,22,22,22,23,23,23,23,23,23,23,23,23,23,24,24,24,24,24,24,24,24,24,24,25,25,25,25,25,25,26,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,28,29,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,31,32,33,33,33,33,33,33,33,33,33,33,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,35,35,35,35,35,35,35,35,35,35,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,37,37,37,37,37,37,37,37,37,37,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,39,39,39,39,39,39,39,39,39,39,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,41,42,42,42,42,42,42,42,42,42,42,43,44,44,44,44,44,44,44,44,44,44,
+44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,45,45,45,45,45,45,45,45,45,45,45,45,45,46,46,46,46,46,46,46,46,46,46,46,46,46,
+46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+47,47,47,47,47,47,47,47,47,47,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,49,49,50,50,50,50,50,50,50,50,50,
+50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+50,50,51,51,52,53,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,55,56,57,57,58,58,58,59,60,61,62,63,64,64,65,65,66,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,68,68,68,69,70,71,72,72,73,73,73,73,73,73,
+73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+74,74,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,
+75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,
+75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,76,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,
+77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,
+77,78,78,79,80,80,81,82,83,83,83,83,83,83,83,83,83,83,84,85,86,86,86,86,86,86,86,86,87,87,87,87,88,88,88,88,88,88,88,88,88,88,89,89,89,89,90,90,91,92,92,92,92,92,93,94,95,95,95,95,96,96,97,97,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,99,99,99,99,100,100,100,101,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
+102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,103,104,105,105,105,
+105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,
+105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+110,110,110,110,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,
+112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+114,114,114,114,114,114,114,114,114,114,114,114,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,117,117,117,117,117,117,117,117,117,117,118,118,118,118,118,
+119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,
+119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,121,
+121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,122,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,124,124,124,124,124,124,124,124,124,124,125,125,125,125,125,125,
+125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,126,127,127,127,127,127,127,127,127,127,127,127,127,
+127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,128,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,
+129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,
+129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,130,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
+131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
+131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,132,133,133,133,133,133,133,133,133,133,133,134,135,135,
+135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,
+135,135,135,135,135,136,136,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,
+137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,
+137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,138,138,138,138,138,139,139,139,139,139,139,139,139,139,139,140,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,
+141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,142,142,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+144,144,144,145,145,145,145,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,147,147,147,148,148,148,148,148,148,148,148,148,
+149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,
+149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,151,151,151,151,
+151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,
+151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,152,152,152,152,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,
+153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,
+153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,155,155,155,155,155,155,155,155,155,155,155,155,155,155,
+155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,
+};
+
+const CharacterTrie<uint16_t> script_extensions_trie {script_extensions_trie_top, script_extensions_trie_index, script_extensions_trie_data, 155};
+
+static_assert(size_t(Script::Zzzz) == 0, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Aghb) == 1, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Ahom) == 2, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Arab) == 3, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Armi) == 4, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Armn) == 5, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Avst) == 6, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Bali) == 7, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Bamu) == 8, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Bass) == 9, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Batk) == 10, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Beng) == 11, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Bopo) == 12, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Brah) == 13, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Brai) == 14, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Bugi) == 15, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Buhd) == 16, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Cakm) == 17, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Cans) == 18, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Cari) == 19, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Cham) == 20, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Cher) == 21, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Copt) == 22, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Cprt) == 23, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Cyrl) == 24, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Deva) == 25, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Dsrt) == 26, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Dupl) == 27, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Egyp) == 28, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Elba) == 29, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Ethi) == 30, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Geor) == 31, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Glag) == 32, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Goth) == 33, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Gran) == 34, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Grek) == 35, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Gujr) == 36, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Guru) == 37, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Hang) == 38, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Hani) == 39, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Hano) == 40, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Hatr) == 41, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Hebr) == 42, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Hira) == 43, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Hluw) == 44, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Hmng) == 45, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Hung) == 46, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Ital) == 47, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Java) == 48, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Kali) == 49, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Kana) == 50, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Khar) == 51, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Khmr) == 52, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Khoj) == 53, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Knda) == 54, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Kthi) == 55, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Lana) == 56, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Laoo) == 57, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Latn) == 58, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Lepc) == 59, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Limb) == 60, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Lina) == 61, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Linb) == 62, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Lisu) == 63, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Lyci) == 64, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Lydi) == 65, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Mahj) == 66, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Mand) == 67, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Mani) == 68, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Mend) == 69, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Merc) == 70, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Mero) == 71, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Mlym) == 72, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Modi) == 73, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Mong) == 74, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Mroo) == 75, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Mtei) == 76, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Mult) == 77, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Mymr) == 78, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Narb) == 79, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Nbat) == 80, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Nkoo) == 81, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Ogam) == 82, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Olck) == 83, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Orkh) == 84, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Orya) == 85, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Osma) == 86, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Palm) == 87, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Pauc) == 88, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Perm) == 89, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Phag) == 90, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Phli) == 91, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Phlp) == 92, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Phnx) == 93, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Plrd) == 94, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Prti) == 95, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Rjng) == 96, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Runr) == 97, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Samr) == 98, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Sarb) == 99, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Saur) == 100, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Sgnw) == 101, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Shaw) == 102, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Shrd) == 103, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Sidd) == 104, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Sind) == 105, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Sinh) == 106, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Sora) == 107, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Sund) == 108, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Sylo) == 109, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Syrc) == 110, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Tagb) == 111, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Takr) == 112, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Tale) == 113, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Talu) == 114, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Taml) == 115, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Tavt) == 116, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Telu) == 117, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Tfng) == 118, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Tglg) == 119, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Thaa) == 120, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Thai) == 121, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Tibt) == 122, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Tirh) == 123, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Ugar) == 124, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Vaii) == 125, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Wara) == 126, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Xpeo) == 127, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Xsux) == 128, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Yiii) == 129, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Zinh) == 130, "Script enumeration does not match make-tables");
+static_assert(size_t(Script::Zyyy) == 131, "Script enumeration does not match make-tables");
+
+char const* const script_codes_array[] {
+"Zzzz",
+"Aghb",
+"Ahom",
+"Arab",
+"Armi",
+"Armn",
+"Avst",
+"Bali",
+"Bamu",
+"Bass",
+"Batk",
+"Beng",
+"Bopo",
+"Brah",
+"Brai",
+"Bugi",
+"Buhd",
+"Cakm",
+"Cans",
+"Cari",
+"Cham",
+"Cher",
+"Copt",
+"Cprt",
+"Cyrl",
+"Deva",
+"Dsrt",
+"Dupl",
+"Egyp",
+"Elba",
+"Ethi",
+"Geor",
+"Glag",
+"Goth",
+"Gran",
+"Grek",
+"Gujr",
+"Guru",
+"Hang",
+"Hani",
+"Hano",
+"Hatr",
+"Hebr",
+"Hira",
+"Hluw",
+"Hmng",
+"Hung",
+"Ital",
+"Java",
+"Kali",
+"Kana",
+"Khar",
+"Khmr",
+"Khoj",
+"Knda",
+"Kthi",
+"Lana",
+"Laoo",
+"Latn",
+"Lepc",
+"Limb",
+"Lina",
+"Linb",
+"Lisu",
+"Lyci",
+"Lydi",
+"Mahj",
+"Mand",
+"Mani",
+"Mend",
+"Merc",
+"Mero",
+"Mlym",
+"Modi",
+"Mong",
+"Mroo",
+"Mtei",
+"Mult",
+"Mymr",
+"Narb",
+"Nbat",
+"Nkoo",
+"Ogam",
+"Olck",
+"Orkh",
+"Orya",
+"Osma",
+"Palm",
+"Pauc",
+"Perm",
+"Phag",
+"Phli",
+"Phlp",
+"Phnx",
+"Plrd",
+"Prti",
+"Rjng",
+"Runr",
+"Samr",
+"Sarb",
+"Saur",
+"Sgnw",
+"Shaw",
+"Shrd",
+"Sidd",
+"Sind",
+"Sinh",
+"Sora",
+"Sund",
+"Sylo",
+"Syrc",
+"Tagb",
+"Takr",
+"Tale",
+"Talu",
+"Taml",
+"Tavt",
+"Telu",
+"Tfng",
+"Tglg",
+"Thaa",
+"Thai",
+"Tibt",
+"Tirh",
+"Ugar",
+"Vaii",
+"Wara",
+"Xpeo",
+"Xsux",
+"Yiii",
+"Zinh",
+"Zyyy",
+};
+
+const Irange<char const* const*> script_codes_table {std::begin(script_codes_array), std::end(script_codes_array)};
+
+const uint16_t script_ids_trie_top[] {
+0,1,2,3,4,5,5,5,5,6,7,8,8,9,10,11,
+12,13,14,15,16,10,17,10,10,10,10,18,10,19,20,21,
+5,5,5,5,5,5,5,5,5,5,22,23,24,10,10,25,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+26,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+};
+
+const uint16_t script_ids_trie_index[] {
+0,1,2,3,4,4,4,4,4,4,5,6,7,8,9,10,11,11,12,11,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,
+57,57,58,59,60,60,60,60,61,62,63,64,65,66,67,68,69,69,69,69,69,69,69,69,69,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,87,94,95,96,97,98,4,4,4,4,99,100,101,102,
+103,104,105,106,107,108,109,0,0,0,0,0,0,0,0,110,111,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,113,113,113,113,0,0,0,0,0,0,0,0,0,114,115,116,117,118,119,120,121,122,123,124,0,125,126,127,128,128,128,129,
+130,131,132,133,134,60,135,136,137,138,0,139,140,141,0,0,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,142,0,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,143,
+144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,145,146,147,147,147,147,148,11,149,150,151,4,152,153,154,155,156,157,158,159,160,161,162,163,164,165,166,167,168,169,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,170,171,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,128,128,128,128,128,172,128,173,174,175,19,176,19,19,19,19,177,178,179,180,181,182,19,183,184,185,186,187,
+188,189,190,191,192,193,194,195,87,87,196,197,198,199,200,201,202,203,204,87,205,206,87,87,207,207,207,207,208,209,87,87,210,211,212,213,214,87,215,216,217,218,219,220,221,222,223,87,224,225,226,227,87,87,87,87,87,228,87,87,87,87,87,87,
+229,230,231,232,233,234,235,236,237,87,238,239,240,241,87,87,87,87,242,243,87,87,244,245,246,247,248,249,250,87,87,87,87,87,251,252,87,87,87,87,87,87,87,253,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+254,254,254,254,254,254,254,254,254,254,254,254,254,254,255,87,254,256,254,254,254,257,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,259,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,260,260,260,260,260,260,260,260,260,261,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,262,262,262,262,262,262,262,262,263,264,87,265,266,267,268,87,87,87,87,87,87,87,87,87,87,87,87,87,269,270,271,87,
+272,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,273,274,275,87,87,87,87,87,87,87,87,87,87,87,87,87,
+0,0,0,276,277,278,279,280,193,281,87,87,0,282,87,87,0,283,284,285,286,287,0,0,0,0,288,0,0,0,0,289,290,290,290,290,290,290,290,290,290,290,291,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,292,292,292,293,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,294,295,296,297,87,87,87,87,
+298,0,299,300,301,298,302,303,304,305,87,87,0,0,0,0,0,0,0,0,0,306,307,0,0,0,0,308,0,309,0,310,311,312,313,87,314,87,315,316,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,317,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,318,128,128,128,319,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,320,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,128,128,128,128,128,128,128,128,321,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+322,0,87,87,7,7,7,323,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+};
+
+const Script script_ids_trie_data[] {
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Latn,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Latn,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Zyyy,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Zyyy,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,
+Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,
+Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Bopo,Script::Bopo,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,
+Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Zyyy,Script::Grek,Script::Grek,Script::Grek,Script::Zzzz,Script::Zzzz,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Zyyy,Script::Grek,
+Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Grek,Script::Zyyy,Script::Grek,Script::Zyyy,Script::Grek,Script::Grek,Script::Grek,Script::Zzzz,Script::Grek,Script::Zzzz,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Zzzz,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,
+Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,
+Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,
+Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Zinh,Script::Zinh,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,
+Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Zzzz,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,
+Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Zzzz,Script::Zzzz,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Zzzz,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,
+Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Zzzz,Script::Zyyy,Script::Armn,Script::Zzzz,Script::Zzzz,Script::Armn,Script::Armn,Script::Armn,Script::Zzzz,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,
+Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zyyy,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zyyy,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Arab,Script::Zyyy,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,
+Script::Zyyy,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zinh,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,
+Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,
+Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zyyy,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,
+Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Zzzz,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,
+Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Syrc,Script::Zzzz,Script::Zzzz,Script::Syrc,Script::Syrc,Script::Syrc,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,
+Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Thaa,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Nkoo,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Zzzz,Script::Zzzz,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Samr,Script::Zzzz,
+Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Mand,Script::Zzzz,Script::Zzzz,Script::Mand,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,
+Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,
+Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Zinh,Script::Zinh,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Zyyy,Script::Zyyy,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,
+Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Zzzz,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Zzzz,Script::Zzzz,Script::Beng,Script::Beng,Script::Zzzz,Script::Zzzz,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Zzzz,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Zzzz,Script::Beng,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Zzzz,Script::Zzzz,Script::Beng,Script::Beng,Script::Beng,Script::Beng,
+Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Zzzz,Script::Zzzz,Script::Beng,Script::Beng,Script::Zzzz,Script::Zzzz,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Beng,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Beng,Script::Beng,Script::Zzzz,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Zzzz,Script::Zzzz,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Beng,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Guru,Script::Guru,Script::Guru,Script::Zzzz,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Guru,Script::Guru,Script::Zzzz,Script::Zzzz,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Zzzz,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Zzzz,Script::Guru,Script::Guru,Script::Zzzz,Script::Guru,Script::Guru,Script::Zzzz,Script::Guru,Script::Guru,Script::Zzzz,Script::Zzzz,Script::Guru,Script::Zzzz,Script::Guru,Script::Guru,
+Script::Guru,Script::Guru,Script::Guru,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Guru,Script::Guru,Script::Zzzz,Script::Zzzz,Script::Guru,Script::Guru,Script::Guru,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Guru,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Zzzz,Script::Guru,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Guru,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Gujr,Script::Gujr,Script::Gujr,Script::Zzzz,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Zzzz,Script::Gujr,Script::Gujr,Script::Gujr,Script::Zzzz,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Zzzz,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Zzzz,Script::Gujr,Script::Gujr,Script::Zzzz,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Zzzz,Script::Zzzz,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,
+Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Zzzz,Script::Gujr,Script::Gujr,Script::Gujr,Script::Zzzz,Script::Gujr,Script::Gujr,Script::Gujr,Script::Zzzz,Script::Zzzz,Script::Gujr,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Zzzz,Script::Zzzz,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Gujr,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Gujr,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Orya,Script::Orya,Script::Orya,Script::Zzzz,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Zzzz,Script::Zzzz,Script::Orya,Script::Orya,Script::Zzzz,Script::Zzzz,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Zzzz,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Zzzz,Script::Orya,Script::Orya,Script::Zzzz,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Zzzz,Script::Zzzz,Script::Orya,Script::Orya,Script::Orya,Script::Orya,
+Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Zzzz,Script::Zzzz,Script::Orya,Script::Orya,Script::Zzzz,Script::Zzzz,Script::Orya,Script::Orya,Script::Orya,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Orya,Script::Orya,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Orya,Script::Orya,Script::Zzzz,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Zzzz,Script::Zzzz,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Orya,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Zzzz,Script::Taml,Script::Taml,Script::Zzzz,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Taml,Script::Taml,Script::Taml,Script::Zzzz,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Taml,Script::Taml,Script::Zzzz,Script::Taml,Script::Zzzz,Script::Taml,Script::Taml,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Taml,Script::Taml,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Taml,Script::Taml,Script::Taml,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Taml,Script::Taml,
+Script::Taml,Script::Taml,Script::Taml,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Taml,Script::Taml,Script::Taml,Script::Zzzz,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Zzzz,Script::Zzzz,Script::Taml,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Taml,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Taml,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Zzzz,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Zzzz,Script::Telu,Script::Telu,Script::Telu,Script::Zzzz,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Zzzz,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Telu,Script::Telu,Script::Telu,
+Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Zzzz,Script::Telu,Script::Telu,Script::Telu,Script::Zzzz,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Telu,Script::Telu,Script::Zzzz,Script::Telu,Script::Telu,Script::Telu,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Zzzz,Script::Zzzz,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,Script::Telu,
+Script::Zzzz,Script::Knda,Script::Knda,Script::Knda,Script::Zzzz,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Zzzz,Script::Knda,Script::Knda,Script::Knda,Script::Zzzz,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Zzzz,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Zzzz,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Zzzz,Script::Zzzz,Script::Knda,Script::Knda,Script::Knda,Script::Knda,
+Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Zzzz,Script::Knda,Script::Knda,Script::Knda,Script::Zzzz,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Knda,Script::Knda,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Knda,Script::Zzzz,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Zzzz,Script::Zzzz,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Knda,Script::Zzzz,Script::Knda,Script::Knda,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Mlym,Script::Mlym,Script::Mlym,Script::Zzzz,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Zzzz,Script::Mlym,Script::Mlym,Script::Mlym,Script::Zzzz,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Zzzz,Script::Zzzz,Script::Mlym,Script::Mlym,Script::Mlym,
+Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Zzzz,Script::Mlym,Script::Mlym,Script::Mlym,Script::Zzzz,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Mlym,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Zzzz,Script::Zzzz,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,Script::Mlym,
+Script::Zzzz,Script::Zzzz,Script::Sinh,Script::Sinh,Script::Zzzz,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Zzzz,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Zzzz,Script::Sinh,Script::Zzzz,Script::Zzzz,
+Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Sinh,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Zzzz,Script::Sinh,Script::Zzzz,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Zzzz,Script::Zzzz,Script::Sinh,Script::Sinh,Script::Sinh,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,
+Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Thai,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Laoo,Script::Laoo,Script::Zzzz,Script::Laoo,Script::Zzzz,Script::Zzzz,Script::Laoo,Script::Laoo,Script::Zzzz,Script::Laoo,Script::Zzzz,Script::Zzzz,Script::Laoo,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Zzzz,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Zzzz,Script::Laoo,Script::Laoo,Script::Laoo,Script::Zzzz,Script::Laoo,Script::Zzzz,Script::Laoo,Script::Zzzz,Script::Zzzz,Script::Laoo,Script::Laoo,Script::Zzzz,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Zzzz,Script::Laoo,Script::Laoo,Script::Laoo,Script::Zzzz,Script::Zzzz,
+Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Zzzz,Script::Laoo,Script::Zzzz,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Zzzz,Script::Zzzz,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Zzzz,Script::Zzzz,Script::Laoo,Script::Laoo,Script::Laoo,Script::Laoo,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,
+Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Zzzz,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,
+Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Zzzz,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Zzzz,Script::Tibt,Script::Tibt,
+Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Zzzz,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Tibt,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Tibt,Script::Tibt,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,
+Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,
+Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Zzzz,Script::Geor,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Geor,Script::Zzzz,Script::Zzzz,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Zyyy,Script::Geor,Script::Geor,Script::Geor,Script::Geor,
+Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,
+Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,
+Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Ethi,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,
+Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,
+Script::Ethi,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,
+Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,
+Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,
+Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Zzzz,Script::Zzzz,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Zzzz,Script::Zzzz,
+Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,
+Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Ogam,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,
+Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Runr,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Tglg,Script::Tglg,Script::Tglg,Script::Tglg,Script::Tglg,Script::Tglg,Script::Tglg,Script::Tglg,Script::Tglg,Script::Tglg,Script::Tglg,Script::Tglg,Script::Tglg,Script::Zzzz,Script::Tglg,Script::Tglg,Script::Tglg,Script::Tglg,Script::Tglg,Script::Tglg,Script::Tglg,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Hano,Script::Hano,Script::Hano,Script::Hano,Script::Hano,Script::Hano,Script::Hano,Script::Hano,Script::Hano,Script::Hano,Script::Hano,Script::Hano,Script::Hano,Script::Hano,Script::Hano,Script::Hano,Script::Hano,Script::Hano,Script::Hano,Script::Hano,Script::Hano,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Buhd,Script::Buhd,Script::Buhd,Script::Buhd,Script::Buhd,Script::Buhd,Script::Buhd,Script::Buhd,Script::Buhd,Script::Buhd,Script::Buhd,Script::Buhd,Script::Buhd,Script::Buhd,Script::Buhd,Script::Buhd,Script::Buhd,Script::Buhd,Script::Buhd,Script::Buhd,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Tagb,Script::Tagb,Script::Tagb,Script::Tagb,Script::Tagb,Script::Tagb,Script::Tagb,Script::Tagb,Script::Tagb,Script::Tagb,Script::Tagb,Script::Tagb,Script::Tagb,Script::Zzzz,Script::Tagb,Script::Tagb,Script::Tagb,Script::Zzzz,Script::Tagb,Script::Tagb,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,
+Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Zzzz,Script::Zzzz,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Mong,Script::Mong,Script::Zyyy,Script::Zyyy,Script::Mong,Script::Zyyy,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Zzzz,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,
+Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Mong,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,
+Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Cans,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Zzzz,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Limb,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Limb,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Zzzz,Script::Zzzz,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Tale,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,
+Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Talu,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Talu,Script::Talu,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,Script::Khmr,
+Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Bugi,Script::Zzzz,Script::Zzzz,Script::Bugi,Script::Bugi,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,
+Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Zzzz,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Zzzz,Script::Zzzz,Script::Lana,
+Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Lana,Script::Zzzz,Script::Zzzz,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zzzz,
+Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,
+Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Bali,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,
+Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Batk,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Batk,Script::Batk,Script::Batk,Script::Batk,
+Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,
+Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Lepc,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Lepc,Script::Lepc,Script::Lepc,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,Script::Olck,
+Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Sund,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zyyy,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zyyy,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zinh,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zinh,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zinh,Script::Zinh,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Cyrl,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,
+Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Cyrl,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,
+Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Grek,
+Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,
+Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Zzzz,Script::Zzzz,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Zzzz,Script::Zzzz,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,
+Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Zzzz,Script::Zzzz,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Zzzz,Script::Zzzz,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Zzzz,Script::Grek,Script::Zzzz,Script::Grek,Script::Zzzz,Script::Grek,Script::Zzzz,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Zzzz,Script::Zzzz,
+Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Zzzz,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,
+Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Zzzz,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Zzzz,Script::Zzzz,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Zzzz,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Zzzz,Script::Zzzz,Script::Grek,Script::Grek,Script::Grek,Script::Zzzz,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zinh,Script::Zinh,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Latn,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Latn,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,
+Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Grek,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Latn,Script::Latn,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Latn,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Latn,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,
+Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,Script::Brai,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Zzzz,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,
+Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Glag,Script::Zzzz,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,
+Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,
+Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,Script::Copt,
+Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Geor,Script::Zzzz,Script::Geor,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Geor,Script::Zzzz,Script::Zzzz,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,
+Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Tfng,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Tfng,Script::Tfng,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Tfng,
+Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,
+Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Zzzz,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,
+Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,
+Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Hani,Script::Zyyy,Script::Hani,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Hang,Script::Hang,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zzzz,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,
+Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Hira,Script::Zzzz,Script::Zzzz,Script::Zinh,Script::Zinh,Script::Zyyy,Script::Zyyy,Script::Hira,Script::Hira,Script::Hira,Script::Zyyy,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,
+Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Zyyy,Script::Zyyy,Script::Kana,Script::Kana,Script::Kana,
+Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,
+Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Bopo,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,
+Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Zzzz,
+Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,
+Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,
+Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,
+Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Yiii,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,Script::Lisu,
+Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,
+Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Vaii,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Cyrl,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,
+Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,
+Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Zzzz,Script::Zzzz,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,
+Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Sylo,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Phag,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,
+Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Saur,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Deva,Script::Zzzz,Script::Zzzz,
+Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Kali,Script::Zyyy,Script::Kali,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,
+Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Rjng,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Rjng,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,
+Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Zzzz,Script::Zyyy,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Java,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Java,Script::Java,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Zzzz,
+Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Zzzz,Script::Zzzz,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Zzzz,Script::Zzzz,Script::Cham,Script::Cham,Script::Cham,Script::Cham,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,Script::Mymr,
+Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,
+Script::Tavt,Script::Tavt,Script::Tavt,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Tavt,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Ethi,Script::Zzzz,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,
+Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Zyyy,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Grek,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,
+Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,Script::Cher,
+Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Zzzz,Script::Zzzz,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Mtei,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,
+Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Zzzz,Script::Zzzz,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,
+Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Armn,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Zzzz,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Zzzz,Script::Hebr,Script::Zzzz,
+Script::Hebr,Script::Hebr,Script::Zzzz,Script::Hebr,Script::Hebr,Script::Zzzz,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Hebr,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,
+Script::Arab,Script::Arab,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,
+Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zyyy,Script::Zyyy,
+Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,
+Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,
+Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Zzzz,
+Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Cyrl,Script::Cyrl,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,
+Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Zzzz,Script::Zyyy,
+Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Latn,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Zyyy,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,
+Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Kana,Script::Zyyy,Script::Zyyy,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Zzzz,
+Script::Zzzz,Script::Zzzz,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Zzzz,Script::Zzzz,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Zzzz,Script::Zzzz,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Hang,Script::Zzzz,Script::Zzzz,Script::Hang,Script::Hang,Script::Hang,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,
+Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Zzzz,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Zzzz,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Zzzz,Script::Linb,Script::Linb,Script::Zzzz,Script::Linb,
+Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Zzzz,Script::Zzzz,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,
+Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Linb,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,
+Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Grek,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zinh,Script::Zzzz,Script::Zzzz,
+Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Lyci,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,
+Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Cari,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zinh,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Ital,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,
+Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Goth,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Perm,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Ugar,Script::Zzzz,Script::Ugar,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,
+Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Xpeo,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,
+Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Dsrt,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,Script::Shaw,
+Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Zzzz,Script::Zzzz,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Osma,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Elba,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,
+Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Aghb,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Aghb,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,
+Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Lina,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Zzzz,Script::Zzzz,Script::Cprt,Script::Zzzz,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Cprt,Script::Zzzz,Script::Cprt,Script::Cprt,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Cprt,Script::Zzzz,Script::Zzzz,Script::Cprt,
+Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Zzzz,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Armi,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,Script::Palm,
+Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Nbat,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Hatr,Script::Hatr,Script::Hatr,Script::Hatr,Script::Hatr,Script::Hatr,Script::Hatr,Script::Hatr,Script::Hatr,Script::Hatr,Script::Hatr,Script::Hatr,Script::Hatr,Script::Hatr,Script::Hatr,Script::Hatr,Script::Hatr,Script::Hatr,Script::Hatr,Script::Zzzz,Script::Hatr,Script::Hatr,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Hatr,Script::Hatr,Script::Hatr,Script::Hatr,Script::Hatr,
+Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Phnx,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Phnx,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Lydi,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Lydi,
+Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Mero,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Merc,Script::Merc,Script::Merc,Script::Merc,
+Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Zzzz,Script::Zzzz,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,Script::Merc,
+Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Zzzz,Script::Khar,Script::Khar,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Zzzz,Script::Khar,Script::Khar,Script::Khar,Script::Zzzz,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Khar,Script::Khar,Script::Khar,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Khar,
+Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Khar,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,Script::Sarb,
+Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Narb,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Mani,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,Script::Avst,
+Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Zzzz,Script::Zzzz,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Prti,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,Script::Phli,
+Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Phlp,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,
+Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Orkh,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,Script::Hung,
+Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,
+Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,
+Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Brah,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Brah,
+Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,Script::Kthi,
+Script::Kthi,Script::Kthi,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Sora,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Zzzz,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,
+Script::Cakm,Script::Cakm,Script::Cakm,Script::Cakm,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Mahj,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,
+Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Zzzz,Script::Zzzz,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Shrd,Script::Zzzz,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Sinh,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Zzzz,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Khoj,Script::Zzzz,Script::Zzzz,
+Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Zzzz,Script::Mult,Script::Zzzz,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Zzzz,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Zzzz,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Mult,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,
+Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Sind,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Zzzz,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Zzzz,Script::Zzzz,Script::Gran,Script::Gran,Script::Zzzz,Script::Zzzz,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Zzzz,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Zzzz,Script::Gran,Script::Gran,Script::Zzzz,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Zzzz,Script::Zzzz,Script::Gran,Script::Gran,Script::Gran,Script::Gran,
+Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Zzzz,Script::Zzzz,Script::Gran,Script::Gran,Script::Zzzz,Script::Zzzz,Script::Gran,Script::Gran,Script::Gran,Script::Zzzz,Script::Zzzz,Script::Gran,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Gran,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Zzzz,Script::Zzzz,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Gran,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,
+Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Tirh,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Zzzz,Script::Zzzz,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,
+Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Sidd,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,
+Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Modi,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Takr,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,Script::Ahom,
+Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,
+Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Wara,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Wara,
+Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Pauc,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,
+Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Zzzz,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Xsux,Script::Xsux,Script::Xsux,Script::Xsux,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,
+Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Egyp,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,
+Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Hluw,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,
+Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Bamu,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Zzzz,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Mroo,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Mroo,Script::Mroo,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Zzzz,Script::Zzzz,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Bass,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,
+Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Zzzz,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Zzzz,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Hmng,Script::Hmng,Script::Hmng,
+Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Hmng,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,
+Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Zzzz,
+Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Plrd,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Kana,Script::Hira,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,
+Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Zzzz,Script::Zzzz,Script::Dupl,Script::Dupl,Script::Dupl,Script::Dupl,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,
+Script::Zinh,Script::Zinh,Script::Zinh,Script::Zyyy,Script::Zyyy,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Grek,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,
+Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Zzzz,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Sgnw,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,
+Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Zzzz,Script::Zzzz,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Mend,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Arab,Script::Arab,Script::Zzzz,Script::Arab,Script::Zzzz,Script::Zzzz,Script::Arab,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Arab,Script::Zzzz,Script::Arab,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Zzzz,Script::Arab,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Arab,Script::Zzzz,Script::Arab,Script::Zzzz,Script::Arab,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Arab,Script::Arab,Script::Zzzz,Script::Arab,Script::Zzzz,Script::Zzzz,Script::Arab,Script::Zzzz,Script::Arab,Script::Zzzz,Script::Arab,Script::Zzzz,Script::Arab,Script::Zzzz,Script::Arab,Script::Zzzz,Script::Arab,Script::Arab,Script::Zzzz,Script::Arab,Script::Zzzz,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Arab,Script::Zzzz,
+Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Arab,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Arab,Script::Arab,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Hira,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Zzzz,Script::Zzzz,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,
+Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Hani,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+Script::Zzzz,Script::Zyyy,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,Script::Zyyy,
+Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zinh,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,Script::Zzzz,
+};
+
+const CharacterTrie<Script> script_ids_trie {script_ids_trie_top, script_ids_trie_index, script_ids_trie_data, Script::Zzzz};
+
+std::array<uint64_t, 3> const script_sets_array[] {
+{{0x0,0x0,0x8}},
+{{0x400000000000000,0x0,0x0}},
+{{0x1000,0x0,0x0}},
+{{0x0,0x0,0x4}},
+{{0x800000000,0x0,0x0}},
+{{0x1,0x0,0x0}},
+{{0x400000,0x0,0x0}},
+{{0x1000000,0x0,0x0}},
+{{0x1000000,0x2000000,0x0}},
+{{0x400000001000000,0x0,0x0}},
+{{0x101000000,0x0,0x0}},
+{{0x20,0x0,0x0}},
+{{0x80000020,0x0,0x0}},
+{{0x40000000000,0x0,0x0}},
+{{0x8,0x0,0x0}},
+{{0x8,0x100400000000000,0x0}},
+{{0x8,0x400010000018,0x0}},
+{{0x8,0x400000000000,0x0}},
+{{0x8,0x100000000000000,0x0}},
+{{0x0,0x400000000000,0x0}},
+{{0x0,0x100000000000000,0x0}},
+{{0x0,0x20000,0x0}},
+{{0x0,0x400000000,0x0}},
+{{0x0,0x8,0x0}},
+{{0x2000000,0x0,0x0}},
+{{0x440003402000800,0x28008000200100,0x0}},
+{{0x440003402000800,0x28000000200100,0x0}},
+{{0x40003402000800,0x829260000200104,0x0}},
+{{0x1040003402000800,0x829260000200104,0x0}},
+{{0x80000002000000,0x4,0x0}},
+{{0x800,0x0,0x0}},
+{{0x20800,0x200000000000,0x0}},
+{{0x2000000000,0x0,0x0}},
+{{0x2000000000,0x2000,0x0}},
+{{0x1000000000,0x0,0x0}},
+{{0x20001000000000,0x0,0x0}},
+{{0x0,0x200000,0x0}},
+{{0x0,0x8000000000000,0x0}},
+{{0x400000000,0x8000000000000,0x0}},
+{{0x0,0x20000000000000,0x0}},
+{{0x40000000000000,0x0,0x0}},
+{{0x0,0x100,0x0}},
+{{0x0,0x40000000000,0x0}},
+{{0x0,0x200000000000000,0x0}},
+{{0x200000000000000,0x0,0x0}},
+{{0x0,0x400000000000000,0x0}},
+{{0x0,0x4000,0x0}},
+{{0x20000,0x2000000004000,0x0}},
+{{0x80000000,0x0,0x0}},
+{{0x4000000000,0x0,0x0}},
+{{0x40000000,0x0,0x0}},
+{{0x200000,0x0,0x0}},
+{{0x40000,0x0,0x0}},
+{{0x0,0x40000,0x0}},
+{{0x0,0x200000000,0x0}},
+{{0x0,0x80000000000000,0x0}},
+{{0x10000000000,0x0,0x0}},
+{{0x10000010000,0x80800000000000,0x0}},
+{{0x10000,0x0,0x0}},
+{{0x0,0x800000000000,0x0}},
+{{0x10000000000000,0x0,0x0}},
+{{0x0,0x400,0x0}},
+{{0x0,0x4000400,0x0}},
+{{0x1000000000000000,0x0,0x0}},
+{{0x0,0x2000000000000,0x0}},
+{{0x0,0x4000000000000,0x0}},
+{{0x8000,0x0,0x0}},
+{{0x100000000000000,0x0,0x0}},
+{{0x80,0x0,0x0}},
+{{0x0,0x100000000000,0x0}},
+{{0x400,0x0,0x0}},
+{{0x800000000000000,0x0,0x0}},
+{{0x0,0x80000,0x0}},
+{{0x402000000,0x0,0x0}},
+{{0x2000000,0x8000000000,0x0}},
+{{0x40000002000000,0x28000000000100,0x0}},
+{{0x40000002000000,0x0,0x0}},
+{{0x400000402000000,0x0,0x0}},
+{{0x4000,0x0,0x0}},
+{{0x100000000,0x0,0x0}},
+{{0x0,0x40000000000000,0x0}},
+{{0x8000000000,0x0,0x0}},
+{{0x408c000001000,0x0,0x2}},
+{{0x408c000001000,0x0,0x0}},
+{{0x4088000000000,0x0,0x0}},
+{{0x8000001000,0x0,0x0}},
+{{0x4080000000000,0x0,0x0}},
+{{0x80000000000,0x0,0x0}},
+{{0x4000000000000,0x0,0x0}},
+{{0x0,0x0,0x2}},
+{{0x8000000000000000,0x0,0x0}},
+{{0x0,0x2000000000000000,0x0}},
+{{0x100,0x0,0x0}},
+{{0x0,0x200000000000,0x0}},
+{{0x80003002000000,0x801020000000204,0x0}},
+{{0x0,0x4000000,0x0}},
+{{0x0,0x1000000000,0x0}},
+{{0x2000000,0x8000000000000,0x0}},
+{{0x2000000000000,0x0,0x0}},
+{{0x402000000000000,0x4000,0x0}},
+{{0x0,0x100000000,0x0}},
+{{0x1000000000000,0x0,0x0}},
+{{0x1000000008000,0x0,0x0}},
+{{0x100000,0x0,0x0}},
+{{0x0,0x10000000000000,0x0}},
+{{0x0,0x1000,0x0}},
+{{0x4000000000000000,0x0,0x0}},
+{{0x4000000000800000,0x0,0x0}},
+{{0x0,0x1,0x0}},
+{{0x80000,0x0,0x0}},
+{{0x400008,0x0,0x0}},
+{{0x800000000000,0x0,0x0}},
+{{0x200000000,0x0,0x0}},
+{{0x0,0x2000000,0x0}},
+{{0x0,0x1000000000000000,0x0}},
+{{0x0,0x8000000000000000,0x0}},
+{{0x4000000,0x0,0x0}},
+{{0x0,0x4000000000,0x0}},
+{{0x0,0x400000,0x0}},
+{{0x20000000,0x0,0x0}},
+{{0x2,0x0,0x0}},
+{{0x2000000000000000,0x0,0x0}},
+{{0x800000,0x0,0x0}},
+{{0x10,0x0,0x0}},
+{{0x0,0x800000,0x0}},
+{{0x0,0x10000,0x0}},
+{{0x20000000000,0x0,0x0}},
+{{0x0,0x20000000,0x0}},
+{{0x0,0x2,0x0}},
+{{0x0,0x80,0x0}},
+{{0x0,0x40,0x0}},
+{{0x8000000000000,0x0,0x0}},
+{{0x0,0x800000000,0x0}},
+{{0x0,0x8000,0x0}},
+{{0x0,0x10,0x0}},
+{{0x40,0x0,0x0}},
+{{0x0,0x80000000,0x0}},
+{{0x0,0x8000000,0x0}},
+{{0x0,0x10000000,0x0}},
+{{0x0,0x100000,0x0}},
+{{0x400000000000,0x0,0x0}},
+{{0x2000,0x0,0x0}},
+{{0x80000000000000,0x0,0x0}},
+{{0x0,0x80000000000,0x0}},
+{{0x20000,0x0,0x0}},
+{{0x0,0x4,0x0}},
+{{0x0,0x8000000000,0x0}},
+{{0x20000000000000,0x0,0x0}},
+{{0x0,0x2000,0x0}},
+{{0x0,0x20000000000,0x0}},
+{{0x400000000,0x0,0x0}},
+{{0x0,0x800000000000000,0x0}},
+{{0x0,0x10000000000,0x0}},
+{{0x0,0x200,0x0}},
+{{0x0,0x1000000000000,0x0}},
+{{0x4,0x0,0x0}},
+{{0x0,0x4000000000000000,0x0}},
+{{0x0,0x1000000,0x0}},
+{{0x0,0x0,0x1}},
+{{0x10000000,0x0,0x0}},
+{{0x100000000000,0x0,0x0}},
+{{0x0,0x800,0x0}},
+{{0x200,0x0,0x0}},
+{{0x200000000000,0x0,0x0}},
+{{0x0,0x40000000,0x0}},
+{{0x8000000,0x0,0x0}},
+{{0x0,0x2000000000,0x0}},
+{{0x0,0x20,0x0}},
+};
+
+const Irange<std::array<uint64_t, 3> const*> script_sets_table {std::begin(script_sets_array), std::end(script_sets_array)};
+
+const uint16_t script_sets_trie_top[] {
+0,1,2,3,4,5,5,5,5,6,7,8,8,9,10,11,
+12,13,14,15,16,10,17,10,10,10,10,18,10,19,20,21,
+5,5,5,5,5,5,5,5,5,5,22,23,24,10,10,25,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+26,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+};
+
+const uint16_t script_sets_trie_index[] {
+0,1,2,3,4,4,4,4,4,4,5,6,7,8,9,10,11,11,12,11,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,
+57,58,59,60,61,61,61,61,62,63,64,65,66,67,68,69,70,70,70,70,70,70,70,70,70,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,88,95,96,97,98,99,4,4,4,4,100,101,102,103,
+104,105,106,107,108,109,110,0,0,0,0,0,0,0,0,111,112,113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,114,114,114,0,0,0,0,0,0,0,0,0,115,116,117,118,119,120,121,122,123,124,125,0,126,127,128,129,129,129,130,
+131,132,133,134,135,61,136,137,138,139,140,141,142,143,0,144,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,
+129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,145,0,129,129,129,129,129,129,129,129,
+129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,
+129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,146,
+147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,148,149,150,150,150,150,151,152,153,154,155,4,156,157,158,159,160,161,162,163,164,165,166,167,168,169,170,171,172,173,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,174,175,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,129,129,129,129,129,176,129,177,178,179,19,180,19,19,19,19,181,182,183,184,185,186,19,187,188,189,190,191,
+192,193,194,195,196,197,198,199,88,88,200,201,202,203,204,205,206,207,208,88,209,210,88,88,211,211,211,211,212,213,88,88,214,215,216,217,218,88,219,220,221,222,223,224,225,226,227,88,228,229,230,231,88,88,88,88,88,232,88,88,88,88,88,88,
+233,234,235,236,237,238,239,240,241,88,242,243,244,245,88,88,88,88,246,247,88,88,248,249,250,251,252,253,254,88,88,88,88,88,255,256,88,88,88,88,88,88,88,257,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+258,258,258,258,258,258,258,258,258,258,258,258,258,258,259,88,258,260,258,258,258,261,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,262,263,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,264,264,264,264,264,264,264,264,264,265,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,266,266,266,266,266,266,266,266,267,268,88,269,270,271,272,88,88,88,88,88,88,88,88,88,88,88,88,88,273,274,275,88,
+276,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,277,278,279,88,88,88,88,88,88,88,88,88,88,88,88,88,
+0,0,0,280,281,282,283,284,197,285,88,88,0,286,88,88,0,287,288,289,290,291,0,0,0,0,292,0,0,0,0,293,294,294,294,294,294,294,294,294,294,294,295,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,296,296,296,297,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,298,299,300,301,88,88,88,88,
+302,0,303,304,305,302,306,307,308,309,88,88,0,0,0,0,0,0,0,0,0,310,311,0,0,0,0,312,0,313,0,314,315,316,317,88,318,88,319,320,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,321,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,
+129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,322,129,129,129,323,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,
+129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,324,88,88,88,88,88,
+88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,129,129,129,129,129,129,129,129,325,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+326,0,88,88,7,7,7,327,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+};
+
+const uint16_t script_sets_trie_data[] {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,4,3,3,4,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,1,1,1,1,1,1,1,1,1,1,1,1,1,4,4,4,4,0,4,4,4,5,5,4,4,4,4,0,4,
+5,5,5,5,4,0,4,0,4,4,4,5,4,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,6,6,6,6,6,6,6,6,6,6,6,6,6,6,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+7,7,7,8,7,9,9,10,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,5,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,5,5,11,11,11,11,11,11,11,5,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+11,11,11,11,11,11,11,11,5,12,11,5,5,11,11,11,5,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,5,5,5,5,5,5,5,5,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,5,5,5,5,5,13,13,13,13,13,5,5,5,5,5,5,5,5,5,5,5,
+14,14,14,14,14,0,14,14,14,14,14,14,15,14,14,14,14,14,14,14,14,14,14,14,14,14,14,15,0,5,14,15,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+16,14,14,14,14,14,14,14,14,14,14,17,17,17,17,17,17,17,17,17,17,17,14,14,14,14,14,14,14,14,14,14,18,18,18,18,18,18,18,18,18,18,14,14,14,14,14,14,17,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,0,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+19,19,19,19,19,19,19,19,19,19,19,19,19,19,5,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,
+19,19,19,19,19,19,19,19,19,19,19,5,5,19,19,19,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,5,5,5,5,5,
+22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,5,5,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,5,
+23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,5,5,23,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,25,26,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,27,28,29,29,29,29,29,29,29,29,29,29,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+30,30,30,30,5,30,30,30,30,30,30,30,30,5,5,30,30,5,5,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,5,30,30,30,30,30,30,30,5,30,5,5,5,30,30,30,30,5,5,30,30,30,30,
+30,30,30,30,30,5,5,30,30,5,5,30,30,30,30,5,5,5,5,5,5,5,5,30,5,5,5,5,30,30,5,30,30,30,30,30,5,5,31,31,31,31,31,31,31,31,31,31,30,30,30,30,30,30,30,30,30,30,30,30,5,5,5,5,
+5,32,32,32,5,32,32,32,32,32,32,5,5,5,5,32,32,5,5,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,5,32,32,32,32,32,32,32,5,32,32,5,32,32,5,32,32,5,5,32,5,32,32,
+32,32,32,5,5,5,5,32,32,5,5,32,32,32,5,5,5,32,5,5,5,5,5,5,5,32,32,32,32,5,32,5,5,5,5,5,5,5,33,33,33,33,33,33,33,33,33,33,32,32,32,32,32,32,5,5,5,5,5,5,5,5,5,5,
+5,34,34,34,5,34,34,34,34,34,34,34,34,34,5,34,34,34,5,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,5,34,34,34,34,34,34,34,5,34,34,5,34,34,34,34,34,5,5,34,34,34,34,
+34,34,34,34,34,34,5,34,34,34,5,34,34,34,5,5,34,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,34,34,34,34,5,5,35,35,35,35,35,35,35,35,35,35,34,34,5,5,5,5,5,5,5,34,5,5,5,5,5,5,
+5,36,36,36,5,36,36,36,36,36,36,36,36,5,5,36,36,5,5,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,5,36,36,36,36,36,36,36,5,36,36,5,36,36,36,36,36,5,5,36,36,36,36,
+36,36,36,36,36,5,5,36,36,5,5,36,36,36,5,5,5,5,5,5,5,5,36,36,5,5,5,5,36,36,5,36,36,36,36,36,5,5,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,5,5,5,5,5,5,5,5,
+5,5,37,37,5,37,37,37,37,37,37,5,5,5,37,37,37,5,37,37,37,37,5,5,5,37,37,5,37,5,37,37,5,5,5,37,37,5,5,5,37,37,38,5,5,5,37,37,37,37,37,37,37,38,37,37,37,37,5,5,5,5,37,37,
+37,37,37,5,5,5,37,37,37,5,37,37,37,37,5,5,37,5,5,5,5,5,5,37,5,5,5,5,5,5,5,5,5,5,5,5,5,5,38,38,38,38,38,38,38,38,38,38,38,38,38,37,37,37,37,37,37,37,37,5,5,5,5,5,
+39,39,39,39,5,39,39,39,39,39,39,39,39,5,39,39,39,5,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,5,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,5,5,5,39,39,39,
+39,39,39,39,39,5,39,39,39,5,39,39,39,39,5,5,5,5,5,5,5,39,39,5,39,39,39,5,5,5,5,5,39,39,39,39,5,5,39,39,39,39,39,39,39,39,39,39,5,5,5,5,5,5,5,5,39,39,39,39,39,39,39,39,
+5,40,40,40,5,40,40,40,40,40,40,40,40,5,40,40,40,5,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,5,40,40,40,40,40,40,40,40,40,40,5,40,40,40,40,40,5,5,40,40,40,40,
+40,40,40,40,40,5,40,40,40,5,40,40,40,40,5,5,5,5,5,5,5,40,40,5,5,5,5,5,5,5,40,5,40,40,40,40,5,5,40,40,40,40,40,40,40,40,40,40,5,40,40,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,41,41,41,5,41,41,41,41,41,41,41,41,5,41,41,41,5,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,5,5,41,41,41,
+41,41,41,41,41,5,41,41,41,5,41,41,41,41,41,5,5,5,5,5,5,5,5,41,5,5,5,5,5,5,5,41,41,41,41,41,5,5,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,5,5,5,41,41,41,41,41,41,41,
+5,5,42,42,5,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,5,5,5,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,5,42,42,42,42,42,42,42,42,42,5,42,5,5,
+42,42,42,42,42,42,42,5,5,5,42,5,5,5,5,42,42,42,42,42,42,5,42,5,42,42,42,42,42,42,42,42,5,5,5,5,5,5,42,42,42,42,42,42,42,42,42,42,5,5,42,42,42,5,5,5,5,5,5,5,5,5,5,5,
+5,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,5,5,5,5,0,
+43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,44,44,5,44,5,5,44,44,5,44,5,5,44,5,5,5,5,5,5,44,44,44,44,5,44,44,44,44,44,44,44,5,44,44,44,5,44,5,44,5,5,44,44,5,44,44,44,44,44,44,44,44,44,44,44,44,44,5,44,44,44,5,5,
+44,44,44,44,44,5,44,5,44,44,44,44,44,44,5,5,44,44,44,44,44,44,44,44,44,44,5,5,44,44,44,44,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,
+45,45,45,45,45,45,45,45,5,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,5,5,5,5,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,
+45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,5,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,5,45,45,
+45,45,45,45,45,45,45,45,45,45,45,45,45,5,45,45,45,45,45,45,45,0,0,0,0,45,45,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+47,47,47,47,47,47,47,47,47,47,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+48,48,48,48,48,48,5,48,5,5,5,5,5,48,5,5,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,48,48,48,48,
+49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+50,50,50,50,50,50,50,50,50,5,50,50,50,50,5,5,50,50,50,50,50,50,50,5,50,5,50,50,50,50,5,5,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+50,50,50,50,50,50,50,50,50,5,50,50,50,50,5,5,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,5,50,50,50,50,5,5,50,50,50,50,50,50,50,5,
+50,5,50,50,50,50,5,5,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,5,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,5,50,50,50,50,5,5,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,5,5,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,5,5,5,
+50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,5,5,5,5,5,5,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,5,5,51,51,51,51,51,51,5,5,
+52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,5,5,5,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,0,0,0,54,54,54,54,54,54,54,54,54,54,54,5,5,5,5,5,5,5,
+55,55,55,55,55,55,55,55,55,55,55,55,55,5,55,55,55,55,55,55,55,5,5,5,5,5,5,5,5,5,5,5,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,57,57,5,5,5,5,5,5,5,5,5,
+58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,5,5,5,5,5,5,5,5,5,5,5,5,59,59,59,59,59,59,59,59,59,59,59,59,59,5,59,59,59,5,59,59,5,5,5,5,5,5,5,5,5,5,5,5,
+60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,5,5,60,60,60,60,60,60,60,60,60,60,5,5,5,5,5,5,60,60,60,60,60,60,60,60,60,60,5,5,5,5,5,5,
+61,61,62,62,61,62,61,61,61,61,61,61,61,61,61,5,61,61,61,61,61,61,61,61,61,61,5,5,5,5,5,5,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,5,5,5,5,5,5,5,5,
+61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,5,5,5,5,5,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,5,5,5,5,5,5,5,5,5,5,
+63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,5,63,63,63,63,63,63,63,63,63,63,63,63,5,5,5,5,63,63,63,63,63,63,63,63,63,63,63,63,5,5,5,5,
+63,5,5,5,63,63,63,63,63,63,63,63,63,63,63,63,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,5,5,64,64,64,64,64,5,5,5,5,5,5,5,5,5,5,5,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,5,5,5,5,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,65,65,65,65,5,5,5,5,5,5,65,65,65,65,65,65,65,65,65,65,65,5,5,5,65,65,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,5,5,66,66,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,
+67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,5,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,5,5,67,
+67,67,67,67,67,67,67,67,67,67,5,5,5,5,5,5,67,67,67,67,67,67,67,67,67,67,5,5,5,5,5,5,67,67,67,67,67,67,67,67,67,67,67,67,67,67,5,5,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+68,68,68,68,68,68,68,68,68,68,68,68,5,5,5,5,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,5,5,5,
+69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,5,5,5,5,5,5,5,5,70,70,70,70,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,5,5,5,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,5,5,5,71,71,71,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+69,69,69,69,69,69,69,69,5,5,5,5,5,5,5,5,73,24,73,73,24,24,24,74,24,74,75,24,74,74,24,24,74,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,73,73,73,76,24,5,73,73,5,5,5,5,5,5,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4,4,4,4,4,7,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4,4,4,4,4,1,1,1,1,4,4,4,4,4,1,1,1,1,1,1,1,1,1,1,1,1,1,7,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4,
+4,4,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,3,3,3,3,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,5,4,4,4,4,4,4,5,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,5,5,4,4,4,4,4,4,5,5,4,4,4,4,4,4,4,4,5,4,5,4,5,4,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,5,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,5,4,4,4,4,4,4,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,5,4,4,4,5,4,4,4,4,4,4,4,4,4,5,
+0,0,0,0,0,0,0,0,0,0,0,0,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,1,5,5,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,77,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,0,0,0,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,0,0,0,
+0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,5,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,5,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,5,5,5,5,5,6,6,6,6,6,6,6,
+48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,5,48,5,5,5,5,5,48,5,5,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,5,5,5,5,5,5,5,80,80,5,5,5,5,5,5,5,5,5,5,5,5,5,5,80,
+50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,5,5,5,5,5,5,5,5,5,50,50,50,50,50,50,50,5,50,50,50,50,50,50,50,5,50,50,50,50,50,50,50,5,50,50,50,50,50,50,50,5,
+50,50,50,50,50,50,50,5,50,50,50,50,50,50,50,5,50,50,50,50,50,50,50,5,50,50,50,50,50,50,50,5,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,5,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,5,5,5,5,5,5,5,5,5,5,5,5,
+81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
+0,82,82,83,0,81,84,81,82,82,82,82,82,82,82,82,82,82,0,83,82,82,82,82,82,82,82,82,83,83,83,83,0,81,81,81,81,81,81,81,81,81,85,85,85,85,49,49,83,86,86,86,86,86,0,83,81,81,81,81,84,84,83,83,
+5,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,5,5,86,86,86,86,87,87,87,86,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,82,86,88,88,88,
+5,5,5,5,5,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,5,5,5,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,5,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,5,5,5,5,5,
+83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,5,5,5,5,5,5,5,5,5,5,5,5,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,5,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
+83,83,83,83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,0,
+83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+83,83,83,83,83,83,83,83,83,83,83,83,0,0,0,0,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,5,
+88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,0,0,0,0,0,0,0,0,0,0,83,83,83,83,83,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,0,
+81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,5,5,5,5,5,5,5,5,5,5,
+81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
+89,89,89,89,89,89,89,89,89,89,89,89,89,5,5,5,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
+89,89,89,89,89,89,89,5,5,5,5,5,5,5,5,5,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,10,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,5,5,5,5,5,5,5,5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,1,1,1,1,1,1,1,1,1,
+93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,5,5,5,5,94,94,94,94,94,94,94,94,94,94,5,5,5,5,5,5,
+95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,5,5,5,5,5,5,5,5,
+96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+96,96,96,96,96,5,5,5,5,5,5,5,5,5,96,96,96,96,96,96,96,96,96,96,96,96,5,5,5,5,5,5,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,97,24,24,24,24,24,24,24,24,24,24,5,5,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,99,98,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,
+100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,5,5,5,5,5,5,5,5,5,5,5,100,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,5,5,5,
+101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,
+101,101,101,101,101,101,101,101,101,101,101,101,101,101,5,102,101,101,101,101,101,101,101,101,101,101,5,5,5,5,101,101,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,5,
+103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,5,5,5,5,5,5,5,5,5,
+103,103,103,103,103,103,103,103,103,103,103,103,103,103,5,5,103,103,103,103,103,103,103,103,103,103,5,5,103,103,103,103,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
+104,104,104,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,104,104,104,104,104,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,5,5,5,5,5,5,5,5,5,
+5,50,50,50,50,50,50,5,5,50,50,50,50,50,50,5,5,50,50,50,50,50,50,5,5,5,5,5,5,5,5,5,50,50,50,50,50,50,50,5,50,50,50,50,50,50,50,5,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,4,5,5,5,5,5,5,5,5,5,5,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,5,5,105,105,105,105,105,105,105,105,105,105,5,5,5,5,5,5,
+49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,5,5,5,5,5,5,5,5,5,5,5,5,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+49,49,49,49,49,49,49,5,5,5,5,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,5,5,5,5,
+81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,5,5,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,11,11,11,11,11,5,5,5,5,5,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,5,13,13,13,13,13,5,13,5,
+13,13,5,13,13,5,13,13,13,13,13,13,13,13,13,13,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+14,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,0,0,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,5,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+14,14,14,14,14,14,14,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,18,14,14,14,14,14,14,14,14,14,14,18,5,5,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,3,3,3,3,3,3,3,3,3,3,3,3,3,3,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,83,83,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,5,5,5,5,14,14,14,14,14,5,14,14,14,14,14,14,14,14,14,14,
+14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,5,5,0,
+5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,82,82,82,82,82,88,88,88,88,88,88,88,88,88,88,86,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,86,86,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,5,
+5,5,49,49,49,49,49,49,5,5,49,49,49,49,49,49,5,5,49,49,49,49,49,49,5,5,49,49,49,5,5,5,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,5,5,
+106,106,106,106,106,106,106,106,106,106,106,106,5,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,5,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,5,106,106,5,106,
+106,106,106,106,106,106,106,106,106,106,106,106,106,106,5,5,106,106,106,106,106,106,106,106,106,106,106,106,106,106,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,
+106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,5,5,5,5,5,
+107,107,107,5,5,5,5,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,5,5,5,107,107,107,107,107,107,107,107,107,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,5,5,
+108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,5,5,5,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,5,5,5,5,
+111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,5,5,5,5,5,5,5,5,5,5,5,5,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,
+112,112,112,112,112,112,112,112,112,112,112,5,5,5,5,5,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,5,5,5,5,5,
+114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,5,114,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+115,115,115,115,5,5,5,5,115,115,115,115,115,115,115,115,115,115,115,115,115,115,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,
+116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,
+118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,5,5,118,118,118,118,118,118,118,118,118,118,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,5,5,5,5,5,5,5,5,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,
+120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,5,5,5,5,5,5,5,5,5,5,5,120,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,5,5,5,5,5,5,5,5,5,
+121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,5,5,5,5,5,5,5,5,5,5,121,121,121,121,121,121,121,121,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+122,122,122,122,122,122,5,5,122,5,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,5,122,122,5,5,5,122,5,5,122,
+123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,5,123,123,123,123,123,123,123,123,123,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,
+125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,5,5,5,5,5,5,5,5,125,125,125,125,125,125,125,125,125,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,5,126,126,5,5,5,5,5,126,126,126,126,126,
+127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,5,5,5,127,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,5,5,5,5,5,128,
+129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,5,5,5,5,130,130,130,130,
+130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,5,5,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+131,131,131,131,5,131,131,5,5,5,5,5,131,131,131,131,131,131,131,131,5,131,131,131,5,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,5,5,5,5,131,131,131,5,5,5,5,131,
+131,131,131,131,131,131,131,131,5,5,5,5,5,5,5,5,131,131,131,131,131,131,131,131,131,5,5,5,5,5,5,5,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,
+133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,5,5,5,5,134,134,134,134,134,134,134,134,134,134,134,134,5,5,5,5,5,5,5,5,5,
+135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,135,5,5,5,135,135,135,135,135,135,135,
+136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,5,5,136,136,136,136,136,136,136,136,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,5,5,5,5,5,137,137,137,137,137,137,137,137,
+138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,5,5,5,5,5,5,5,138,138,138,138,5,5,5,5,5,5,5,5,5,5,5,5,138,138,138,138,138,138,138,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,
+139,139,139,139,139,139,139,139,139,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,5,5,5,5,5,5,5,5,5,5,5,5,5,
+140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,5,5,5,5,5,5,5,140,140,140,140,140,140,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,5,
+141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,
+141,141,141,141,141,141,141,141,141,141,141,141,141,141,5,5,5,5,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,141,
+142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,
+142,142,5,5,5,5,5,5,5,5,5,5,5,5,5,5,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,5,5,5,5,5,5,5,143,143,143,143,143,143,143,143,143,143,5,5,5,5,5,5,
+144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,5,144,144,144,144,144,144,144,144,144,144,
+144,144,144,144,5,5,5,5,5,5,5,5,5,5,5,5,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,5,5,5,5,5,5,5,5,5,
+146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,
+146,146,146,146,146,146,146,146,146,146,146,146,146,146,5,5,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,5,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,5,5,5,5,5,5,5,5,5,5,5,
+147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,5,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,5,5,
+148,148,148,148,148,148,148,5,148,5,148,148,148,148,5,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,5,148,148,148,148,148,148,148,148,148,148,148,5,5,5,5,5,5,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,
+149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,5,5,5,5,5,149,149,149,149,149,149,149,149,149,149,5,5,5,5,5,5,
+150,150,150,150,5,150,150,150,150,150,150,150,150,5,5,150,150,5,5,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,5,150,150,150,150,150,150,150,5,150,150,5,150,150,150,150,150,5,5,150,150,150,150,
+150,150,150,150,150,5,5,150,150,5,5,150,150,150,5,5,150,5,5,5,5,5,5,150,5,5,5,5,5,150,150,150,150,150,150,150,5,5,150,150,150,150,150,150,150,5,5,5,150,150,150,150,150,5,5,5,5,5,5,5,5,5,5,5,
+151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,
+151,151,151,151,151,151,151,151,5,5,5,5,5,5,5,5,151,151,151,151,151,151,151,151,151,151,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,5,5,152,152,152,152,152,152,152,152,
+152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,
+153,153,153,153,153,5,5,5,5,5,5,5,5,5,5,5,153,153,153,153,153,153,153,153,153,153,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,5,5,5,5,5,5,5,5,
+154,154,154,154,154,154,154,154,154,154,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,5,5,5,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,5,5,5,5,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,
+156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,5,5,5,5,5,5,5,5,5,5,5,5,156,
+157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,5,5,5,5,5,5,5,
+158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,5,158,158,158,158,158,5,5,5,5,5,5,5,5,5,5,5,
+158,158,158,158,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+160,160,160,160,160,160,160,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,5,5,5,5,5,5,5,
+161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,5,161,161,161,161,161,161,161,161,161,161,5,5,5,5,161,161,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,5,5,162,162,162,162,162,162,5,5,5,5,5,5,5,5,5,5,
+163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,
+163,163,163,163,163,163,5,5,5,5,5,5,5,5,5,5,163,163,163,163,163,163,163,163,163,163,5,163,163,163,163,163,163,163,5,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,5,5,5,5,5,163,163,163,
+163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,
+164,164,164,164,164,5,5,5,5,5,5,5,5,5,5,5,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+88,87,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,
+165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,5,5,5,5,5,165,165,165,165,165,165,165,165,165,165,165,165,165,5,5,5,
+165,165,165,165,165,165,165,165,165,5,5,5,5,5,5,5,165,165,165,165,165,165,165,165,165,165,5,5,165,165,165,165,165,165,165,165,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,3,3,3,
+3,3,3,0,0,3,3,3,3,3,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,5,5,0,5,5,0,0,5,5,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,5,0,5,0,0,0,
+0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,5,
+0,0,0,0,0,5,0,5,5,5,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,
+166,166,166,166,166,166,166,166,166,166,166,166,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,166,166,166,166,166,5,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,
+167,167,167,167,167,5,5,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+14,14,14,14,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,5,14,14,5,14,5,5,14,5,14,14,14,14,14,14,14,14,14,14,5,14,14,14,14,5,14,5,14,5,5,5,5,
+5,5,14,5,5,5,5,14,5,14,5,14,5,14,14,14,5,14,14,5,14,5,5,14,5,14,5,14,5,14,5,14,5,14,14,5,14,5,5,14,14,14,14,5,14,14,14,14,14,14,14,5,14,14,14,14,5,14,14,14,14,5,14,5,
+14,14,14,14,14,14,14,14,14,14,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,5,5,5,5,5,14,14,14,5,14,14,14,14,14,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+87,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,
+0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,5,5,5,5,5,5,5,5,5,5,5,
+81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,5,5,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+};
+
+const CharacterTrie<uint16_t> script_sets_trie {script_sets_trie_top, script_sets_trie_index, script_sets_trie_data, 5};
+
 }
 }
@@ -9,18 +9,33 @@
 #include <array>
 #include <cstdint>
 #include <functional>
+#include <string>
 #include <utility>
 
 namespace Unicorn {
 
     using namespace Prion;
 
+    struct CharProps;
+
     namespace UnicornDetail {
 
         // Constants
 
         constexpr char32_t not_found = 0xffffffff;
 
+        // Hangul syllable arithmetic, from section 3.12 of the Unicode Standard
+
+        constexpr char32_t hangul_sbase = 0xac00;
+        constexpr char32_t hangul_lbase = 0x1100;
+        constexpr char32_t hangul_vbase = 0x1161;
+        constexpr char32_t hangul_tbase = 0x11a7;
+        constexpr char32_t hangul_lcount = 19;
+        constexpr char32_t hangul_vcount = 21;
+        constexpr char32_t hangul_tcount = 28;
+        constexpr char32_t hangul_ncount = hangul_vcount * hangul_tcount;
+        constexpr char32_t hangul_scount = hangul_lcount * hangul_ncount;
+
         // Types
 
         template <typename K, typename V>
@@ -101,6 +116,40 @@ namespace Unicorn {
             return it->value;
         }
 
+        // Multi-stage lookup tables
+
+        // A CharacterTrie maps every code point to a value with three
+        // dependent loads and no branches. The code point is split into a
+        // page number (bits 12-20), an offset into a shared index block (bits
+        // 6-11), and an offset into a shared data block (bits 0-5). Identical
+        // blocks at both levels are stored only once. The stages are static
+        // arrays generated by make-tables, and the trie itself is only a view
+        // of them, so it needs no construction at run time; the outside value
+        // is returned for anything beyond the Unicode range.
+
+        template <typename V>
+        class CharacterTrie {
+        public:
+            template <size_t NI, size_t ND>
+            constexpr CharacterTrie(const uint16_t (&top)[0x110], const uint16_t (&index)[NI], const V (&data)[ND], V outside) noexcept:
+                CharacterTrie(top, index, NI, data, ND, outside) {}
+            constexpr CharacterTrie(const uint16_t* top, const uint16_t* index, size_t ni, const V* data, size_t nd, V outside) noexcept:
+                top(top), index(index), data(data), index_size(ni), data_size(nd), outside(outside) {}
+            V operator[](char32_t c) const noexcept {
+                if (c > 0x10ffff)
+                    return outside;
+                return data[size_t(index[size_t(top[c >> 12]) << 6 | ((c >> 6) & 63)]) << 6 | (c & 63)];
+            }
+            size_t bytes() const noexcept { return sizeof(*this) + (0x110 + index_size) * sizeof(uint16_t) + data_size * sizeof(V); }
+        private:
+            const uint16_t* top;
+            const uint16_t* index;
+            const V* data;
+            size_t index_size;
+            size_t data_size;
+            V outside;
+        };
+
         // General character property tables
 
         extern const TableView<char32_t, uint16_t> general_category_table;
@@ -113,11 +162,23 @@ namespace Unicorn {
         extern const TableView<char32_t, char32_t> xid_nonstart_table;
         extern const TableView<char32_t, char32_t> pattern_syntax_table;
         extern const TableView<char32_t, char32_t> pattern_white_space_table;
+        extern const CharacterTrie<uint16_t> general_category_trie;
+        extern const CharacterTrie<bool> default_ignorable_trie;
+        extern const CharacterTrie<bool> soft_dotted_trie;
+        extern const CharacterTrie<bool> white_space_trie;
+        extern const CharacterTrie<bool> id_start_trie;
+        extern const CharacterTrie<bool> id_nonstart_trie;
+        extern const CharacterTrie<bool> xid_start_trie;
+        extern const CharacterTrie<bool> xid_nonstart_trie;
+        extern const CharacterTrie<bool> pattern_syntax_trie;
+        extern const CharacterTrie<bool> pattern_white_space_trie;
 
         // Arabic shaping property tables
 
         extern const TableView<char32_t, Joining_Type> joining_type_table;
         extern const TableView<char32_t, Joining_Group> joining_group_table;
+        extern const CharacterTrie<Joining_Type> joining_type_trie;
+        extern const CharacterTrie<Joining_Group> joining_group_trie;
 
         // Bidirectional property tables
 
@@ -126,10 +187,17 @@ namespace Unicorn {
         extern const TableView<char32_t, char32_t> bidi_mirroring_glyph_table;
         extern const TableView<char32_t, char32_t> bidi_paired_bracket_table;
         extern const TableView<char32_t, char32_t> bidi_paired_bracket_type_table;
+        extern const CharacterTrie<Bidi_Class> bidi_class_trie;
+        extern const CharacterTrie<bool> bidi_mirrored_trie;
+        extern const CharacterTrie<char32_t> bidi_mirroring_glyph_trie;
+        extern const CharacterTrie<char32_t> bidi_paired_bracket_trie;
+        extern const CharacterTrie<char> bidi_paired_bracket_type_trie;
 
         // Block tables
 
         extern const TableView<char32_t, char const*> blocks_table;
+        extern const CharacterTrie<uint16_t> blocks_trie;
+        extern const CharacterTrie<uint16_t> block_ids_trie;
 
         // Case folding tables
 
@@ -143,13 +211,60 @@ namespace Unicorn {
         extern const TableView<char32_t, std::array<char32_t, 3>> full_lowercase_table;
         extern const TableView<char32_t, std::array<char32_t, 3>> full_titlecase_table;
         extern const TableView<char32_t, std::array<char32_t, 3>> full_casefold_table;
+        extern const CharacterTrie<bool> uppercase_trie;
+        extern const CharacterTrie<bool> lowercase_trie;
+        extern const CharacterTrie<bool> cased_trie;
+        extern const CharacterTrie<bool> case_ignorable_trie;
+
+        // Case mapping tries, used by CaseTable in character.cpp; the
+        // exception lists hold the characters whose full mapping is not
+        // the same as their simple mapping
+
+        struct CaseException {
+            char32_t simple;
+            uint32_t length;
+            std::array<char32_t, 3> full;
+        };
+
+        extern const Irange<CaseException const*> uppercase_exceptions_table;
+        extern const Irange<CaseException const*> lowercase_exceptions_table;
+        extern const Irange<CaseException const*> titlecase_exceptions_table;
+        extern const Irange<CaseException const*> casefold_exceptions_table;
+        extern const CharacterTrie<int32_t> uppercase_mapping_trie;
+        extern const CharacterTrie<int32_t> lowercase_mapping_trie;
+        extern const CharacterTrie<int32_t> titlecase_mapping_trie;
+        extern const CharacterTrie<int32_t> casefold_mapping_trie;
 
         // Character name tables
 
         extern const char* const main_names_data;
         extern const size_t main_names_compressed;
-        extern const size_t main_names_expanded;
+        extern const size_t main_names_per_block;
+        extern const size_t main_names_max_block;
+        extern const Irange<uint32_t const*> main_names_offsets_table;
+        extern const TableView<char32_t, uint32_t> main_names_index_table;
         extern const TableView<char32_t, char const*> corrected_names_table;
+        extern const Irange<uint16_t const*> main_names_seed_table;
+        extern const Irange<uint16_t const*> main_names_hash_table;
+
+        // The name hash table is a perfect hash of the loose forms of the
+        // names in the main table, built the same way as the composition
+        // hash below; each slot holds the ordinal of the only name that can
+        // hash there, or 0xffff if the slot is empty. This must match the
+        // hash function in make-tables.
+
+        inline uint32_t character_name_hash(const std::string& key, uint32_t seed) noexcept {
+            uint32_t h = 0x811c9dc5u;
+            for (char c: key)
+                h = (h ^ uint8_t(c)) * 0x01000193u;
+            h ^= seed * 0x9e3779b1u;
+            h ^= h >> 16;
+            h *= 0x7feb352du;
+            h ^= h >> 15;
+            h *= 0x846ca68bu;
+            h ^= h >> 16;
+            return h;
+        }
 
         // Decomposition tables
 
@@ -158,21 +273,61 @@ namespace Unicorn {
         extern const TableView<char32_t, std::array<char32_t, 3>> short_compatibility_table;
         extern const TableView<char32_t, std::array<char32_t, 18>> long_compatibility_table;
         extern const TableView<std::array<char32_t, 2>, char32_t> composition_table;
+        extern const TableView<char32_t, std::array<char32_t, 4>> full_canonical_table;
+        extern const TableView<char32_t, std::array<char32_t, 4>> short_full_compatibility_table;
+        extern const TableView<char32_t, std::array<char32_t, 18>> long_full_compatibility_table;
+        extern const Irange<uint32_t const*> composition_seed_table;
+        extern const TableView<std::array<char32_t, 2>, char32_t> composition_hash_table;
+        extern const CharacterTrie<uint8_t> combining_class_trie;
+        extern const CharacterTrie<uint16_t> quick_check_trie;
+        extern const CharacterTrie<uint16_t> full_canonical_index_trie;
+        extern const CharacterTrie<uint16_t> full_compatibility_index_trie;
+
+        // The composition hash table is a perfect hash of the pairs in the
+        // composition table: the hash of the pair with a zero seed selects
+        // an entry in the seed table, and the hash with that seed selects
+        // the only slot where the pair can be. The table sizes are powers of
+        // two. This must match the hash function in make-tables.
+
+        inline uint32_t composition_hash(char32_t u1, char32_t u2, uint32_t seed) noexcept {
+            uint32_t h = (uint32_t(u1) * 0x9e3779b1u) ^ (uint32_t(u2) * 0x85ebca77u) ^ seed;
+            h ^= h >> 16;
+            h *= 0x7feb352du;
+            h ^= h >> 15;
+            h *= 0x846ca68bu;
+            h ^= h >> 16;
+            return h;
+        }
 
         // Indic property tables
 
         extern const TableView<char32_t, Indic_Positional_Category> indic_positional_category_table;
         extern const TableView<char32_t, Indic_Syllabic_Category> indic_syllabic_category_table;
+        extern const CharacterTrie<Indic_Positional_Category> indic_positional_category_trie;
+        extern const CharacterTrie<Indic_Syllabic_Category> indic_syllabic_category_trie;
 
         // Numeric property tables
 
         extern const TableView<char32_t, Numeric_Type> numeric_type_table;
         extern const TableView<char32_t, PackedPair<long long>> numeric_value_table;
+        extern const CharacterTrie<Numeric_Type> numeric_type_trie;
+        extern const CharacterTrie<uint16_t> numeric_value_trie;
+
+        // Packed property tables
+
+        extern const Irange<CharProps const*> property_records_table;
+        extern const CharacterTrie<uint16_t> property_records_trie;
 
         // Script tables
 
         extern const TableView<char32_t, uint32_t> scripts_table;
         extern const TableView<char32_t, char const*> script_extensions_table;
+        extern const CharacterTrie<uint32_t> scripts_trie;
+        extern const CharacterTrie<uint16_t> script_extensions_trie;
+        extern const Irange<char const* const*> script_codes_table;
+        extern const CharacterTrie<Script> script_ids_trie;
+        extern const Irange<std::array<uint64_t, 3> const*> script_sets_table;
+        extern const CharacterTrie<uint16_t> script_sets_trie;
 
         // Text segmentation property tables
 
@@ -180,11 +335,17 @@ namespace Unicorn {
         extern const TableView<char32_t, Line_Break> line_break_table;
         extern const TableView<char32_t, Sentence_Break> sentence_break_table;
         extern const TableView<char32_t, Word_Break> word_break_table;
+        extern const CharacterTrie<Grapheme_Cluster_Break> grapheme_cluster_break_trie;
+        extern const CharacterTrie<Line_Break> line_break_trie;
+        extern const CharacterTrie<Sentence_Break> sentence_break_trie;
+        extern const CharacterTrie<Word_Break> word_break_trie;
 
         // Other enumerated property tables
 
         extern const TableView<char32_t, East_Asian_Width> east_asian_width_table;
         extern const TableView<char32_t, Hangul_Syllable_Type> hangul_syllable_type_table;
+        extern const CharacterTrie<East_Asian_Width> east_asian_width_trie;
+        extern const CharacterTrie<Hangul_Syllable_Type> hangul_syllable_type_trie;
 
         // Normalization test tables
 
@@ -2,7 +2,9 @@
 #include "unicorn/character.hpp"
 #include "unicorn/utf.hpp"
 #include "prion/unit-test.hpp"
+#include <random>
 #include <string>
+#include <vector>
 
 using namespace std::literals;
 using namespace Unicorn;
@@ -579,6 +581,380 @@ namespace {
 
     }
 
+    void check_utf_views() {
+
+        u32string s32;
+        u8string s8;
+        Utf8View v8;
+        Utf16View v16;
+        UtfSpanIterator<char> i8;
+
+        TEST(v8.empty());
+        TEST_EQUAL(v8.size(), 0);
+        TEST(v8.begin() == v8.end());
+        TRY(v8 = Utf8View(nullptr, 10));
+        TEST(v8.empty());
+
+        TRY(v8 = utf_view(c8));
+        TEST_EQUAL(v8.data(), c8.data());
+        TEST_EQUAL(v8.size(), c8.size());
+        TEST_EQUAL(v8.str(), c8);
+        TRY(std::copy(v8.begin(), v8.end(), overwrite(s32)));
+        TEST_EQUAL(s32, c32);
+        TRY(v16 = Utf16View(c16.data(), c16.size()));
+        TRY(std::copy(v16.begin(), v16.end(), overwrite(s32)));
+        TEST_EQUAL(s32, c32);
+
+        // Reading from a buffer that is not null terminated
+        const char buf[] = {'a', '\xd0', '\xb0', 'b', '\xd0', '\xb0', 'c'};
+        TRY(v8 = utf_view(buf, 4));
+        TRY(std::copy(v8.begin(), v8.end(), overwrite(s32)));
+        TEST_EQUAL(s32, u32string({'a', 0x430, 'b'}));
+        TRY(v8 = utf_view(buf, 5));
+        TRY(std::copy(utf_begin(v8, err_replace), utf_end(v8, err_replace), overwrite(s32)));
+        TEST_EQUAL(s32, u32string({'a', 0x430, 'b', 0xfffd}));
+        TEST_THROW_EQUAL(std::copy(utf_begin(v8, err_throw), utf_end(v8, err_throw), overwrite(s32)),
+            EncodingError, "Encoding error (UTF-8); offset 4; hex d0");
+
+        TRY(i8 = utf_end(v8, err_replace));
+        TRY(--i8);  TEST_EQUAL(i8.offset(), 4);  TEST_EQUAL(i8.count(), 1);  TEST(! i8.valid());
+        TRY(--i8);  TEST_EQUAL(i8.offset(), 3);  TEST_EQUAL(*i8, U'b');       TEST_EQUAL(i8.str(), "b");
+        TRY(--i8);  TEST_EQUAL(i8.offset(), 1);  TEST_EQUAL(*i8, 0x430);      TEST_EQUAL(i8.str(), "\xd0\xb0");
+        TEST_EQUAL(u_str(utf_begin(v8), i8), "a");
+        TEST_EQUAL(u_str(utf_range(v8)), u8string(buf, 5));
+        TRY(i8 = utf_iterator(v8, 3));
+        TEST_EQUAL(*i8, U'b');
+        TEST_EQUAL(i8.source().data(), buf);
+        TEST_EQUAL(i8.range().first, buf + 3);
+
+        TRY(v8 = utf_view(buf, sizeof(buf)));
+        s8.clear();
+        TRY(std::copy(utf_begin(v8, err_replace), utf_end(v8, err_replace), utf_writer(s8)));
+        TEST_EQUAL(s8, "a\xd0\xb0" "b\xd0\xb0" "c");
+
+        #if __cplusplus >= 201703L
+            std::string_view sv(c8);
+            TRY(std::copy(utf_range(sv).begin(), utf_range(sv).end(), overwrite(s32)));
+            TEST_EQUAL(s32, c32);
+            TEST_EQUAL(utf_view(sv).size(), c8.size());
+        #endif
+
+    }
+
+    void check_ascii_fast_path() {
+
+        // Long ASCII runs are converted in bulk; make sure the results match
+        // the character by character iterators at every alignment.
+
+        static const std::vector<u8string> inserts {"\xd0\xb0", "\xf0\x90\x8c\x82", "\xff", "\xe4\xba", "\x80"};
+
+        u16string s16, t16;
+        u32string s32, t32;
+        wstring sw, tw;
+
+        for (size_t len: {0, 1, 15, 16, 17, 31, 32, 33, 100, 1023, 1024, 1025, 3000}) {
+            u8string ascii;
+            for (size_t i = 0; i < len; ++i)
+                ascii += char(0x20 + i % 95);
+            TEST_EQUAL(to_utf16(ascii), u16string(ascii.begin(), ascii.end()));
+            TEST_EQUAL(to_utf32(ascii), u32string(ascii.begin(), ascii.end()));
+            TEST_EQUAL(to_wstring(ascii), wstring(ascii.begin(), ascii.end()));
+            for (auto& insert: inserts) {
+                for (size_t pos: {size_t(0), len / 3, len / 2, len}) {
+                    auto src = ascii;
+                    src.insert(pos, insert);
+                    src += insert;
+                    bool valid = valid_string(src);
+                    s16.clear();
+                    s32.clear();
+                    sw.clear();
+                    std::copy(utf_begin(src, err_replace), utf_end(src, err_replace), utf_writer(s16));
+                    std::copy(utf_begin(src, err_replace), utf_end(src, err_replace), utf_writer(s32));
+                    std::copy(utf_begin(src, err_replace), utf_end(src, err_replace), utf_writer(sw));
+                    TRY(recode(src, t16, err_replace));  TEST_EQUAL(t16, s16);
+                    TRY(recode(src, t32, err_replace));  TEST_EQUAL(t32, s32);
+                    TRY(recode(src, tw, err_replace));   TEST(tw == sw);
+                    if (valid) {
+                        TRY(recode(src, t16));  TEST_EQUAL(t16, s16);
+                        TRY(recode(src, t32));  TEST_EQUAL(t32, s32);
+                        TRY(recode(src, tw));   TEST(tw == sw);
+                        TRY(recode(src, t16, err_throw));
+                        TRY(recode(src, t32, err_throw));
+                    } else {
+                        auto bad = valid_count(src);
+                        try {
+                            recode(src, t32, err_throw);
+                            FAIL("No exception");
+                        }
+                        catch (const EncodingError& ex) {
+                            TEST_EQUAL(ex.offset(), bad);
+                        }
+                    }
+                }
+            }
+        }
+
+    }
+
+    template <typename C1, typename C2>
+    void check_presized_recode(const basic_string<C1>& src, uint32_t flags) {
+        basic_string<C2> full, part;
+        TRY(recode(src, full, flags));
+        TEST_EQUAL(recode_length<C2>(src.data(), src.size(), flags), full.size());
+        for (size_t cap = 0; cap <= full.size() + 2; ++cap) {
+            part.assign(cap + 1, C2(0x5a));
+            size_t n = 0;
+            TRY(n = recode_into(src.data(), src.size(), &part[0], cap, flags));
+            TEST_COMPARE(n, <=, cap);
+            TEST(part.substr(0, n) == full.substr(0, n));
+            TEST_EQUAL(part[cap], C2(0x5a));
+            if (cap >= full.size())
+                TEST_EQUAL(n, full.size());
+            else
+                TEST_COMPARE(n + UnicornDetail::UtfEncoding<C2>::max_units, >, cap);
+        }
+    }
+
+    template <typename C1>
+    void check_presized_recode(const basic_string<C1>& src) {
+        for (auto flags: {err_ignore, err_replace}) {
+            check_presized_recode<C1, char>(src, flags);
+            check_presized_recode<C1, char16_t>(src, flags);
+            check_presized_recode<C1, char32_t>(src, flags);
+            check_presized_recode<C1, wchar_t>(src, flags);
+        }
+    }
+
+    void check_recode_into() {
+
+        check_presized_recode(a8);
+        check_presized_recode(b8);
+        check_presized_recode(c8);
+        check_presized_recode(x8);
+        check_presized_recode(a16);
+        check_presized_recode(b16);
+        check_presized_recode(c16);
+        check_presized_recode(x16);
+        check_presized_recode(a32);
+        check_presized_recode(b32);
+        check_presized_recode(c32);
+        check_presized_recode(x32);
+
+        u16string s16(20, u'*');
+        u8string s8(20, '*');
+
+        TEST_EQUAL(recode_length<char16_t>(c8.data(), c8.size()), c16.size());
+        TEST_EQUAL(recode_length<char>(c16.data(), c16.size()), c8.size());
+        TEST_EQUAL(recode_length<char>(c32.data(), c32.size()), c8.size());
+        TEST_EQUAL(recode_length<char16_t>(x8.data(), x8.size(), err_replace), y16.size());
+        TEST_EQUAL(recode_length<char16_t>(static_cast<const char*>(nullptr), 10), 0);
+        TEST_THROW(recode_length<char16_t>(x8.data(), x8.size(), err_throw), EncodingError);
+        TEST_EQUAL(recode_into(c8.data(), c8.size(), &s16[0], s16.size()), c16.size());
+        TEST_EQUAL(s16.substr(0, c16.size()), c16);
+        TEST_EQUAL(recode_into(c32.data(), c32.size(), &s8[0], 5), 3);
+        TEST_EQUAL(s8.substr(0, 3), c8.substr(0, 3));
+        TEST_EQUAL(recode_into(c32.data(), npos, &s8[0], s8.size()), c8.size());
+        TEST_EQUAL(s8.substr(0, c8.size()), c8);
+        TEST_THROW_EQUAL(recode_into(x16.data(), x16.size(), &s8[0], s8.size(), err_throw),
+            EncodingError, "Encoding error (UTF-16); offset 5; hex d800");
+
+    }
+
+    void check_recode_batch() {
+
+        std::vector<u8string> src8 {"", "Hello", c8, x8, "", "\xe4\xba", "\xf0\x90\x8c\x82"};
+        RecodedBatch<char16_t> batch16;
+        RecodedBatch<char32_t> batch32;
+
+        TEST(batch16.empty());
+        TEST_EQUAL(batch16.size(), 0);
+        TEST_EQUAL(batch16.units(), 0);
+
+        for (auto flags: {err_ignore, err_replace}) {
+            TRY(recode_batch(src8, batch16, flags));
+            TEST_EQUAL(batch16.size(), src8.size());
+            TEST_EQUAL(batch16.offsets().size(), src8.size() + 1);
+            size_t units = 0;
+            for (size_t i = 0; i < src8.size(); ++i) {
+                auto expect = recode<char16_t>(src8[i], flags);
+                TEST_EQUAL(batch16.str(i), expect);
+                TEST_EQUAL(batch16[i].str(), expect);
+                TEST_EQUAL(batch16[i].size(), expect.size());
+                TEST(batch16[i].data() == batch16.data() + units);
+                units += expect.size();
+            }
+            TEST_EQUAL(batch16.units(), units);
+        }
+
+        TEST_THROW(recode_batch(src8, batch16, err_throw), EncodingError);
+        TEST_EQUAL(batch16.size(), src8.size());
+        TRY(batch16.clear());
+        TEST(batch16.empty());
+
+        std::vector<u8string> big;
+        for (size_t i = 0; i < 20000; ++i)
+            big.push_back(dec(i) + (i % 3 ? "\xe4\xba\x8c"s : ""s) + (i % 5 ? "" : "\xf0\x90\x8c\x82") + "abcdefghij");
+        for (size_t threads: {1, 3, 0}) {
+            TRY(batch32 = recode_batch<char32_t>(big, 0, threads));
+            TEST_EQUAL(batch32.size(), big.size());
+            bool match = true;
+            for (size_t i = 0; i < big.size() && match; ++i)
+                match = batch32.str(i) == to_utf32(big[i]);
+            TEST(match);
+        }
+        big[15000] += "\xff";
+        TEST_THROW(recode_batch<char32_t>(big, err_throw, 4), EncodingError);
+        TRY(batch32 = recode_batch<char32_t>(big, err_replace, 4));
+        TEST_EQUAL(batch32.str(15000), to_utf32(big[15000], err_replace));
+        TEST_EQUAL(batch32.str(15000).back(), replacement_char);
+
+    }
+
+    template <typename C1, typename C2>
+    void check_stream_decoding(const basic_string<C1>& src, uint32_t flags, std::mt19937& mt) {
+        basic_string<C2> expect, result;
+        size_t error = npos;
+        try {
+            recode(src, expect, flags);
+        }
+        catch (const EncodingError& ex) {
+            error = ex.offset();
+        }
+        for (size_t max_chunk: {1, 2, 3, 5, 100}) {
+            std::uniform_int_distribution<size_t> chunks(0, max_chunk);
+            UtfStreamDecoder<C1, C2> dec(flags);
+            result.clear();
+            size_t pos = 0;
+            try {
+                while (pos < src.size()) {
+                    auto n = std::min(chunks(mt), src.size() - pos);
+                    dec.feed(src.data() + pos, n, result);
+                    pos += n;
+                    TEST_EQUAL(dec.offset(), pos);
+                    TEST_COMPARE(dec.pending(), <, UnicornDetail::UtfEncoding<C1>::max_units);
+                }
+                dec.finish(result);
+                TEST_EQUAL(error, npos);
+                TEST(result == expect);
+            }
+            catch (const EncodingError& ex) {
+                TEST_EQUAL(ex.offset(), error);
+            }
+        }
+    }
+
+    void check_stream_decoder() {
+
+        static const std::vector<u8string> tests8 {
+            "", "Hello", c8, x8, "\xe4\xba", "\xf0\x90\x8c", "\xf0\x90\x8c" "A", "\xe4\xe4\xba\x8c",
+            "\xe0\x80\x80", "\xed\xa0\x80", "\xf4\x90\x80\x80", "\xc3\xc3\xa9\xa9",
+            "a\xd0\xb0\xe4\xba\x8c\xf0\x90\x8c\x82\xff\xd0\xe4\xba" "b",
+        };
+        static const std::vector<u16string> tests16 {
+            u"", u"Hello", c16, x16, {0xd800}, {0xd800,0xd800,0xdc00}, {'a',0xdc00,'b'}, {0xdbff,0xdffd,0xd800},
+        };
+
+        std::mt19937 mt(42);
+
+        for (auto& s: tests8) {
+            for (auto flags: {err_replace, err_throw}) {
+                check_stream_decoding<char, char16_t>(s, flags, mt);
+                check_stream_decoding<char, char32_t>(s, flags, mt);
+                check_stream_decoding<char, char>(s, flags, mt);
+            }
+            if (valid_string(s)) {
+                check_stream_decoding<char, char16_t>(s, 0, mt);
+                check_stream_decoding<char, wchar_t>(s, 0, mt);
+            }
+        }
+
+        for (auto& s: tests16) {
+            for (auto flags: {err_replace, err_throw}) {
+                check_stream_decoding<char16_t, char>(s, flags, mt);
+                check_stream_decoding<char16_t, char32_t>(s, flags, mt);
+            }
+        }
+
+        UtfStreamDecoder<char, char32_t> dec(err_replace);
+        u32string s32;
+
+        TRY(dec.feed("A\xe4", 2, s32));   TEST_EQUAL(s32, U"A");         TEST_EQUAL(dec.pending(), 1);
+        TRY(dec.feed("\xba", 1, s32));    TEST_EQUAL(s32, U"A");         TEST_EQUAL(dec.pending(), 2);
+        TRY(dec.feed("\x8c" "B", 2, s32));  TEST_EQUAL(s32, U"A\u4e8c" "B");  TEST_EQUAL(dec.pending(), 0);
+        TRY(dec.feed("\xf0\x90", 2, s32));  TEST_EQUAL(dec.pending(), 2);
+        TRY(dec.finish(s32));              TEST_EQUAL(s32, U"A\u4e8c" "B\ufffd");
+        TEST_EQUAL(dec.pending(), 0);
+        TEST_EQUAL(dec.offset(), 0);
+
+    }
+
+    template <typename C>
+    string make_bytes(const basic_string<C>& src, bool big) {
+        string bytes;
+        for (auto c: src)
+            for (size_t i = 0; i < sizeof(C); ++i)
+                bytes += char(uint32_t(c) >> (8 * (big ? sizeof(C) - 1 - i : i)));
+        return bytes;
+    }
+
+    void check_byte_order() {
+
+        u32string s32, out32;
+        u16string s16, out16;
+        u8string s8;
+        string bytes;
+
+        for (size_t i = 0; i < 3000; ++i)
+            s32 += i % 7 == 0 ? char32_t(0x10000 + i) : i % 5 == 0 ? char32_t(0x4e00 + i) : char32_t('a' + i % 26);
+        TRY(recode(s32, s16));
+        TRY(recode(s32, s8));
+
+        for (bool big: {false, true}) {
+            auto order = big ? ByteOrder::big_endian : ByteOrder::little_endian;
+            auto b16 = make_bytes(s16, big);
+            auto b32 = make_bytes(s32, big);
+            TRY(recode_from_bytes<char16_t>(b16.data(), b16.size(), order, out32));  TEST_EQUAL(out32, s32);
+            TRY(recode_from_bytes<char32_t>(b32.data(), b32.size(), order, out16));  TEST_EQUAL(out16, s16);
+            TEST_EQUAL((recode_from_bytes<char16_t, char>(b16.data(), b16.size(), order)), s8);
+            TEST_EQUAL((recode_from_bytes<char32_t, char>(b32.data(), b32.size(), order)), s8);
+            auto unaligned = "x" + b16;
+            TEST_EQUAL((recode_from_bytes<char16_t, char32_t>(unaligned.data() + 1, b16.size(), order)), s32);
+            TRY(recode_to_bytes<char16_t>(s8, order, bytes));   TEST_EQUAL(bytes, b16);
+            TRY(recode_to_bytes<char32_t>(s16, order, bytes));  TEST_EQUAL(bytes, b32);
+            TRY(recode_to_bytes<char>(s32, order, bytes));      TEST_EQUAL(bytes, s8);
+            auto bad8 = s8.substr(0, 1000) + "\xff" + s8.substr(1000);
+            TRY(recode_to_bytes<char16_t>(bad8, order, bytes, err_replace));
+            TEST_EQUAL(bytes, make_bytes(recode<char16_t>(bad8, err_replace), big));
+            auto bom16 = make_bytes(u"\ufeff"s, big) + b16;
+            auto bom32 = make_bytes(U"\ufeff"s, big) + b32;
+            TEST_EQUAL((recode_from_bytes<char16_t, char32_t>(bom16.data(), bom16.size(), ByteOrder::detect)), s32);
+            TEST_EQUAL((recode_from_bytes<char32_t, char16_t>(bom32.data(), bom32.size(), ByteOrder::detect)), s16);
+            TEST_EQUAL((recode_from_bytes<char16_t, char32_t>(bom16.data(), bom16.size(), order)), U"\ufeff" + s32);
+        }
+
+        bytes = make_bytes(u"Hello\U00010302"s, true);
+        TEST_EQUAL((recode_from_bytes<char16_t, char32_t>(bytes.data(), bytes.size(), ByteOrder::detect)), U"Hello\U00010302");
+        TRY(recode_to_bytes<char16_t>(U"Hello"s, ByteOrder::detect, bytes));
+        TEST_EQUAL(bytes.size(), 12);
+        TEST_EQUAL((recode_from_bytes<char16_t, char32_t>(bytes.data(), bytes.size(), ByteOrder::detect)), U"Hello");
+        TRY(recode_to_bytes<char>(U"Hello"s, ByteOrder::detect, bytes));
+        TEST_EQUAL(bytes, "\xef\xbb\xbfHello");
+        TEST_EQUAL((recode_from_bytes<char, char32_t>(bytes.data(), bytes.size(), ByteOrder::detect)), U"Hello");
+        TEST_EQUAL((recode_from_bytes<char, char32_t>(bytes.data(), bytes.size(), ByteOrder::big_endian)), U"\ufeffHello");
+
+        bytes = "\0H\0i\xd8\x00\0!\0"s;
+        TEST_EQUAL((recode_from_bytes<char16_t, char32_t>(bytes.data(), bytes.size(), ByteOrder::big_endian, err_replace)), U"Hi\ufffd!\ufffd");
+        TEST_THROW_EQUAL((recode_from_bytes<char16_t, char32_t>(bytes.data(), bytes.size(), ByteOrder::big_endian, err_throw)),
+            EncodingError, "Encoding error (UTF-16); offset 2; hex d800");
+        bytes = "\0H\0i\0"s;
+        TEST_THROW_EQUAL((recode_from_bytes<char16_t, char32_t>(bytes.data(), bytes.size(), ByteOrder::big_endian, err_throw)),
+            EncodingError, "Encoding error (UTF-16); offset 4; hex 00");
+        bytes = "\0\0\0A\0\x11\0\0"s;
+        TEST_EQUAL((recode_from_bytes<char32_t, char32_t>(bytes.data(), bytes.size(), ByteOrder::big_endian, err_replace)), U"A\ufffd");
+        TEST_EQUAL((recode_from_bytes<char16_t, char32_t>(nullptr, 0, ByteOrder::detect)), U"");
+
+    }
+
     void check_string_validation() {
 
         u8string s8;
@@ -638,6 +1014,124 @@ namespace {
 
     }
 
+    template <typename C>
+    size_t reference_valid_count(const basic_string<C>& str) {
+        size_t pos = 0;
+        char32_t u = 0;
+        while (pos < str.size()) {
+            auto rc = UnicornDetail::UtfEncoding<C>::decode(str.data() + pos, str.size() - pos, u);
+            if (! char_is_unicode(u))
+                return pos;
+            pos += rc;
+        }
+        return npos;
+    }
+
+    void check_clean_input() {
+
+        u8string s8, t8;
+        u16string s16;
+        const char* ptr = nullptr;
+        char buf[10];
+
+        s8.assign(1000, 'x');
+        s8 += c8;
+        ptr = s8.data();
+        t8 = s8;
+        TRY(sanitize(s8));
+        TEST_EQUAL(s8, t8);
+        TEST(s8.data() == ptr);
+
+        s8[500] = '\xff';
+        t8 = s8;
+        TRY(sanitize(s8));
+        TEST_EQUAL(s8.size(), 1002 + c8.size());
+        TEST_EQUAL(s8.substr(0, 500), t8.substr(0, 500));
+        TEST_EQUAL(s8.substr(500, 3), "\xef\xbf\xbd");
+        TEST_EQUAL(s8, recode<char>(t8, err_replace));
+
+        s8.reserve(2000);
+        ptr = s8.data();
+        TRY(recode(c8, s8, err_replace));
+        TEST_EQUAL(s8, c8);
+        TEST(s8.data() == ptr);
+        TRY(recode(x8, s8, err_replace));
+        TEST_EQUAL(s8, y8);
+        TRY(recode(u"Hello"s, s8, err_replace));
+        TEST_EQUAL(s8, "Hello");
+        TEST(s8.data() == ptr);
+        TEST_THROW(recode(x8, s8, err_throw), EncodingError);
+        TEST_EQUAL(s8, "Hello");
+
+        s8 = "Hello world";
+        TRY(recode(s8.data() + 6, 5, s8));
+        TEST_EQUAL(s8, "world");
+        TRY(recode(s8, 1, s8, err_replace));
+        TEST_EQUAL(s8, "orld");
+        TRY(recode(s8, s8, err_replace));
+        TEST_EQUAL(s8, "orld");
+        s16 = u"Hello";
+        TRY(recode(s16, 10, s16));
+        TEST_EQUAL(s16, u"");
+
+        TEST_EQUAL(recode_into(c8.data(), c8.size(), buf, 4, err_replace), 3);
+        TEST_EQUAL(u8string(buf, 3), c8.substr(0, 3));
+        TEST_EQUAL(recode_into(x8.data(), x8.size(), buf, 10, err_replace), 10);
+        TEST_EQUAL(u8string(buf, 10), y8.substr(0, 10));
+
+    }
+
+    void check_bulk_validation() {
+
+        // Validation works on whole blocks at a time; compare it with a
+        // simple decoding loop on random mixtures of valid and invalid
+        // fragments, so errors land at every position relative to a block.
+
+        static const std::vector<u8string> fragments8 {
+            "Hello world", "a", "\xd0\xb0", "\xe4\xba\x8c", "\xf0\x90\x8c\x82", "\xf4\x8f\xbf\xbd",
+            "\x80", "\xbf", "\xc0\xaf", "\xc1\xbf", "\xe0\x80\xaf", "\xed\xa0\x80", "\xf0\x80\x80\xaf",
+            "\xf4\x90\x80\x80", "\xf5\x80\x80\x80", "\xff", "\xe4\xba", "\xf0\x90\x8c", "\xd0",
+        };
+        static const std::vector<u16string> fragments16 {
+            u"Hello world", u"a", {0x430}, {0x4e8c}, {0xd800,0xdf02}, {0xdbff,0xdffd},
+            {0xd800}, {0xdfff}, {0xdc00,0xd800}, {0xd800,0xd800},
+        };
+
+        std::mt19937 mt(42);
+        std::uniform_int_distribution<size_t> lengths(0, 40);
+        std::uniform_int_distribution<size_t> ascii_or_not(0, 9);
+        u8string s8;
+        u16string s16;
+
+        for (int i = 0; i < 2000; ++i) {
+            auto n = lengths(mt);
+            s8.clear();
+            s16.clear();
+            for (size_t j = 0; j < n; ++j) {
+                // Mostly valid text, so errors are sparse
+                size_t valid8 = ascii_or_not(mt) ? 6 : fragments8.size();
+                size_t valid16 = ascii_or_not(mt) ? 6 : fragments16.size();
+                s8 += fragments8[std::uniform_int_distribution<size_t>(0, valid8 - 1)(mt)];
+                s16 += fragments16[std::uniform_int_distribution<size_t>(0, valid16 - 1)(mt)];
+            }
+            auto count8 = reference_valid_count(s8), count16 = reference_valid_count(s16);
+            TEST_EQUAL(valid_count(s8), count8);
+            TEST_EQUAL(valid_string(s8), count8 == npos);
+            TEST_EQUAL(valid_count(s16), count16);
+            TEST_EQUAL(valid_string(s16), count16 == npos);
+            if (count8 != npos) {
+                try {
+                    check_string(s8);
+                    FAIL("No exception");
+                }
+                catch (const EncodingError& ex) {
+                    TEST_EQUAL(ex.offset(), count8);
+                }
+            }
+        }
+
+    }
+
     void check_error_handling() {
 
         u8string s8;
@@ -708,7 +1202,15 @@ TEST_MODULE(unicorn, utf) {
     check_decoding_ranges();
     check_implicit_recoding();
     check_explicit_recoding();
+    check_utf_views();
+    check_ascii_fast_path();
+    check_recode_into();
+    check_recode_batch();
+    check_stream_decoder();
+    check_byte_order();
     check_string_validation();
+    check_clean_input();
+    check_bulk_validation();
     check_error_handling();
 
 }
@@ -1,4 +1,11 @@
 #include "unicorn/utf.hpp"
+#include <cstring>
+#include <exception>
+#include <thread>
+
+#if defined(__SSE2__)
+    #include <immintrin.h>
+#endif
 
 using namespace std::literals;
 
@@ -8,10 +15,727 @@ namespace Unicorn {
 
         constexpr auto not_unicode = char32_t(-1);
 
+        // ASCII run kernels. The portable versions work a machine word at a
+        // time; the SSE2 and AVX2 versions 16 or 32 bytes at a time. The AVX2
+        // versions are compiled for that target regardless of the global
+        // compiler flags, and only called if the CPU reports support.
+
+        size_t ascii_span_word(const char* src, size_t n) noexcept {
+            static constexpr uint64_t high_bits = 0x8080808080808080ull;
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                uint64_t block;
+                memcpy(&block, src + i, 8);
+                if (block & high_bits)
+                    break;
+            }
+            while (i < n && uint8_t(src[i]) <= 0x7f)
+                ++i;
+            return i;
+        }
+
+        template <typename C>
+        void ascii_widen_word(const char* src, size_t n, C* dst) noexcept {
+            for (size_t i = 0; i < n; ++i)
+                dst[i] = C(src[i]);
+        }
+
+        // Validation kernels return a prefix length, always on a character
+        // boundary, that is known to be valid; the caller decodes from there
+        // to find the exact error position, if any. The portable versions
+        // simply return zero.
+
+        size_t utf8_span_none(const char* /*src*/, size_t /*n*/) noexcept {
+            return 0;
+        }
+
+        size_t utf16_span_none(const char16_t* /*src*/, size_t /*n*/) noexcept {
+            return 0;
+        }
+
+        // If all blocks before pos were valid, any lead byte in the last
+        // three bytes may start a character that runs past pos, so back up
+        // to it; otherwise pos is already on a character boundary.
+
+        size_t utf8_boundary(const char* src, size_t pos) noexcept {
+            for (size_t i = 1; i <= 3 && i <= pos; ++i)
+                if (uint8_t(src[pos - i]) >= 0xc0)
+                    return pos - i;
+            return pos;
+        }
+
+        size_t utf16_boundary(const char16_t* src, size_t pos) noexcept {
+            if (pos > 0 && (src[pos - 1] & 0xfc00) == 0xd800)
+                --pos;
+            return pos;
+        }
+
+        // Character counting kernels. In valid UTF-8, characters are counted
+        // by counting the bytes that are not continuation bytes (80-bf, which
+        // are less than -64 as signed bytes); in valid UTF-16, by counting
+        // units that are not low surrogates. The advance functions find the
+        // start of the k'th character, reducing k by the number of
+        // characters skipped.
+
+        size_t utf8_count_word(const char* src, size_t n) noexcept {
+            size_t count = 0;
+            for (size_t i = 0; i < n; ++i)
+                count += size_t(int8_t(src[i]) >= -64);
+            return count;
+        }
+
+        template <typename C>
+        size_t utf16_count_word(const C* src, size_t n) noexcept {
+            size_t count = 0;
+            for (size_t i = 0; i < n; ++i)
+                count += size_t((src[i] & 0xfc00) != 0xdc00);
+            return count;
+        }
+
+        size_t utf8_advance_word(const char* src, size_t n, size_t& k) noexcept {
+            for (size_t i = 0; i < n; ++i) {
+                if (int8_t(src[i]) >= -64) {
+                    if (k == 0)
+                        return i;
+                    --k;
+                }
+            }
+            return n;
+        }
+
+        template <typename C>
+        size_t utf16_advance_word(const C* src, size_t n, size_t& k) noexcept {
+            for (size_t i = 0; i < n; ++i) {
+                if ((src[i] & 0xfc00) != 0xdc00) {
+                    if (k == 0)
+                        return i;
+                    --k;
+                }
+            }
+            return n;
+        }
+
+        // Byte swapping kernels, for UTF-16 or 32 in the opposite byte order.
+        // The source is an arbitrary byte buffer, with no alignment assumed.
+
+        void swap16_word(const char* src, size_t n, char16_t* dst) noexcept {
+            for (size_t i = 0; i < n; ++i) {
+                uint16_t u;
+                memcpy(&u, src + 2 * i, 2);
+                dst[i] = char16_t(__builtin_bswap16(u));
+            }
+        }
+
+        void swap32_word(const char* src, size_t n, char32_t* dst) noexcept {
+            for (size_t i = 0; i < n; ++i) {
+                uint32_t u;
+                memcpy(&u, src + 4 * i, 4);
+                dst[i] = char32_t(__builtin_bswap32(u));
+            }
+        }
+
+        // Given a mask of character start positions in a block (with Bits
+        // bits for each code unit), find the index of the k'th one, or
+        // subtract the number present from k if there are not enough.
+
+        template <int Bits>
+        bool select_start(uint32_t mask, size_t& k, size_t& index) noexcept {
+            size_t count = size_t(__builtin_popcount(mask)) / Bits;
+            if (count <= k) {
+                k -= count;
+                return false;
+            }
+            for (size_t i = 0; i < k * Bits; ++i)
+                mask &= mask - 1;
+            index = size_t(__builtin_ctz(mask)) / Bits;
+            k = 0;
+            return true;
+        }
+
+        // UTF-8 block validation uses the lookup table method from Keiser &
+        // Lemire, "Validating UTF-8 in less than one instruction per byte".
+        // Each byte is classified by the high and low nibbles of the
+        // preceding byte and the high nibble of the byte itself; a nonzero
+        // AND of the three lookups flags an illegal pair. Lead bytes of three
+        // and four byte characters also require continuation bytes two and
+        // three places later, which is checked separately.
+
+        constexpr uint8_t u8_too_short = 1 << 0;     // 11______ 0_______ or 11______ 11______
+        constexpr uint8_t u8_too_long = 1 << 1;      // 0_______ 10______
+        constexpr uint8_t u8_overlong_3 = 1 << 2;    // 11100000 100_____
+        constexpr uint8_t u8_too_large = 1 << 3;     // 11110100 1001____ and up
+        constexpr uint8_t u8_surrogate = 1 << 4;     // 11101101 101_____
+        constexpr uint8_t u8_overlong_2 = 1 << 5;    // 1100000_ 10______
+        constexpr uint8_t u8_too_large_1000 = 1 << 6; // 11110101 1000____ and up
+        constexpr uint8_t u8_overlong_4 = 1 << 6;    // 11110000 1000____
+        constexpr uint8_t u8_two_conts = 1 << 7;     // 10______ 10______
+        constexpr uint8_t u8_carry = u8_too_short | u8_too_long | u8_two_conts;
+
+        alignas(16) constexpr uint8_t u8_byte_1_high[16] = {
+            u8_too_long, u8_too_long, u8_too_long, u8_too_long,
+            u8_too_long, u8_too_long, u8_too_long, u8_too_long,
+            u8_two_conts, u8_two_conts, u8_two_conts, u8_two_conts,
+            u8_too_short | u8_overlong_2,
+            u8_too_short,
+            u8_too_short | u8_overlong_3 | u8_surrogate,
+            u8_too_short | u8_too_large | u8_too_large_1000 | u8_overlong_4,
+        };
+
+        alignas(16) constexpr uint8_t u8_byte_1_low[16] = {
+            u8_carry | u8_overlong_3 | u8_overlong_2 | u8_overlong_4,
+            u8_carry | u8_overlong_2,
+            u8_carry,
+            u8_carry,
+            u8_carry | u8_too_large,
+            u8_carry | u8_too_large | u8_too_large_1000,
+            u8_carry | u8_too_large | u8_too_large_1000,
+            u8_carry | u8_too_large | u8_too_large_1000,
+            u8_carry | u8_too_large | u8_too_large_1000,
+            u8_carry | u8_too_large | u8_too_large_1000,
+            u8_carry | u8_too_large | u8_too_large_1000,
+            u8_carry | u8_too_large | u8_too_large_1000,
+            u8_carry | u8_too_large | u8_too_large_1000,
+            u8_carry | u8_too_large | u8_too_large_1000 | u8_surrogate,
+            u8_carry | u8_too_large | u8_too_large_1000,
+            u8_carry | u8_too_large | u8_too_large_1000,
+        };
+
+        alignas(16) constexpr uint8_t u8_byte_2_high[16] = {
+            u8_too_short, u8_too_short, u8_too_short, u8_too_short,
+            u8_too_short, u8_too_short, u8_too_short, u8_too_short,
+            u8_too_long | u8_overlong_2 | u8_two_conts | u8_overlong_3 | u8_too_large_1000 | u8_overlong_4,
+            u8_too_long | u8_overlong_2 | u8_two_conts | u8_overlong_3 | u8_too_large,
+            u8_too_long | u8_overlong_2 | u8_two_conts | u8_surrogate | u8_too_large,
+            u8_too_long | u8_overlong_2 | u8_two_conts | u8_surrogate | u8_too_large,
+            u8_too_short, u8_too_short, u8_too_short, u8_too_short,
+        };
+
+        #if defined(__SSE2__)
+
+            size_t ascii_span_sse2(const char* src, size_t n) noexcept {
+                size_t i = 0;
+                for (; i + 16 <= n; i += 16) {
+                    auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                    int mask = _mm_movemask_epi8(block);
+                    if (mask)
+                        return i + __builtin_ctz(mask);
+                }
+                return i + ascii_span_word(src + i, n - i);
+            }
+
+            void ascii_widen_sse2(const char* src, size_t n, char16_t* dst) noexcept {
+                auto zero = _mm_setzero_si128();
+                size_t i = 0;
+                for (; i + 16 <= n; i += 16) {
+                    auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                    auto out = reinterpret_cast<__m128i*>(dst + i);
+                    _mm_storeu_si128(out, _mm_unpacklo_epi8(block, zero));
+                    _mm_storeu_si128(out + 1, _mm_unpackhi_epi8(block, zero));
+                }
+                ascii_widen_word(src + i, n - i, dst + i);
+            }
+
+            void ascii_widen_sse2(const char* src, size_t n, char32_t* dst) noexcept {
+                auto zero = _mm_setzero_si128();
+                size_t i = 0;
+                for (; i + 16 <= n; i += 16) {
+                    auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                    auto lo = _mm_unpacklo_epi8(block, zero);
+                    auto hi = _mm_unpackhi_epi8(block, zero);
+                    auto out = reinterpret_cast<__m128i*>(dst + i);
+                    _mm_storeu_si128(out, _mm_unpacklo_epi16(lo, zero));
+                    _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo, zero));
+                    _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi, zero));
+                    _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi, zero));
+                }
+                ascii_widen_word(src + i, n - i, dst + i);
+            }
+
+            __attribute__((__target__("avx2")))
+            size_t ascii_span_avx2(const char* src, size_t n) noexcept {
+                size_t i = 0;
+                for (; i + 32 <= n; i += 32) {
+                    auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                    unsigned mask = unsigned(_mm256_movemask_epi8(block));
+                    if (mask)
+                        return i + __builtin_ctz(mask);
+                }
+                return i + ascii_span_sse2(src + i, n - i);
+            }
+
+            __attribute__((__target__("avx2")))
+            void ascii_widen_avx2(const char* src, size_t n, char16_t* dst) noexcept {
+                size_t i = 0;
+                for (; i + 16 <= n; i += 16) {
+                    auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_cvtepu8_epi16(block));
+                }
+                ascii_widen_word(src + i, n - i, dst + i);
+            }
+
+            __attribute__((__target__("avx2")))
+            void ascii_widen_avx2(const char* src, size_t n, char32_t* dst) noexcept {
+                size_t i = 0;
+                for (; i + 8 <= n; i += 8) {
+                    auto block = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_cvtepu8_epi32(block));
+                }
+                ascii_widen_word(src + i, n - i, dst + i);
+            }
+
+            __attribute__((__target__("ssse3")))
+            size_t utf8_span_ssse3(const char* src, size_t n) noexcept {
+                auto table1 = _mm_load_si128(reinterpret_cast<const __m128i*>(u8_byte_1_high));
+                auto table2 = _mm_load_si128(reinterpret_cast<const __m128i*>(u8_byte_1_low));
+                auto table3 = _mm_load_si128(reinterpret_cast<const __m128i*>(u8_byte_2_high));
+                auto nibble = _mm_set1_epi8(0x0f);
+                auto high_bit = _mm_set1_epi8(char(0x80));
+                auto third = _mm_set1_epi8(char(0xe0 - 0x80));
+                auto fourth = _mm_set1_epi8(char(0xf0 - 0x80));
+                auto zero = _mm_setzero_si128();
+                auto prev = zero;
+                size_t i = 0;
+                for (; i + 16 <= n; i += 16) {
+                    auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                    auto prev1 = _mm_alignr_epi8(input, prev, 15);
+                    auto prev2 = _mm_alignr_epi8(input, prev, 14);
+                    auto prev3 = _mm_alignr_epi8(input, prev, 13);
+                    auto byte_1_high = _mm_shuffle_epi8(table1, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+                    auto byte_1_low = _mm_shuffle_epi8(table2, _mm_and_si128(prev1, nibble));
+                    auto byte_2_high = _mm_shuffle_epi8(table3, _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+                    auto special = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+                    auto must_23 = _mm_or_si128(_mm_subs_epu8(prev2, third), _mm_subs_epu8(prev3, fourth));
+                    auto error = _mm_xor_si128(_mm_and_si128(must_23, high_bit), special);
+                    if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, zero)) != 0xffff)
+                        break;
+                    prev = input;
+                }
+                return utf8_boundary(src, i);
+            }
+
+            __attribute__((__target__("avx2")))
+            size_t utf8_span_avx2(const char* src, size_t n) noexcept {
+                auto table1 = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(u8_byte_1_high)));
+                auto table2 = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(u8_byte_1_low)));
+                auto table3 = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(u8_byte_2_high)));
+                auto nibble = _mm256_set1_epi8(0x0f);
+                auto high_bit = _mm256_set1_epi8(char(0x80));
+                auto third = _mm256_set1_epi8(char(0xe0 - 0x80));
+                auto fourth = _mm256_set1_epi8(char(0xf0 - 0x80));
+                auto zero = _mm256_setzero_si256();
+                auto prev = zero;
+                size_t i = 0;
+                for (; i + 32 <= n; i += 32) {
+                    auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                    auto shifted = _mm256_permute2x128_si256(prev, input, 0x21);
+                    auto prev1 = _mm256_alignr_epi8(input, shifted, 15);
+                    auto prev2 = _mm256_alignr_epi8(input, shifted, 14);
+                    auto prev3 = _mm256_alignr_epi8(input, shifted, 13);
+                    auto byte_1_high = _mm256_shuffle_epi8(table1, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+                    auto byte_1_low = _mm256_shuffle_epi8(table2, _mm256_and_si256(prev1, nibble));
+                    auto byte_2_high = _mm256_shuffle_epi8(table3, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+                    auto special = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+                    auto must_23 = _mm256_or_si256(_mm256_subs_epu8(prev2, third), _mm256_subs_epu8(prev3, fourth));
+                    auto error = _mm256_xor_si256(_mm256_and_si256(must_23, high_bit), special);
+                    if (! _mm256_testz_si256(error, error))
+                        break;
+                    prev = input;
+                }
+                return utf8_boundary(src, i);
+            }
+
+            // A UTF-16 block is valid if every high surrogate is followed by a
+            // low surrogate and vice versa, checked by comparing each unit's
+            // high flag with the next unit's low flag.
+
+            size_t utf16_span_sse2(const char16_t* src, size_t n) noexcept {
+                if (n == 0 || (src[0] & 0xfc00) == 0xdc00)
+                    return 0;
+                auto mask = _mm_set1_epi16(short(0xfc00));
+                auto high = _mm_set1_epi16(short(0xd800));
+                auto low = _mm_set1_epi16(short(0xdc00));
+                size_t i = 0;
+                for (; i + 9 <= n; i += 8) {
+                    auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                    auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 1));
+                    auto a_high = _mm_cmpeq_epi16(_mm_and_si128(a, mask), high);
+                    auto b_low = _mm_cmpeq_epi16(_mm_and_si128(b, mask), low);
+                    if (_mm_movemask_epi8(_mm_cmpeq_epi16(a_high, b_low)) != 0xffff)
+                        break;
+                }
+                return utf16_boundary(src, i);
+            }
+
+            __attribute__((__target__("avx2")))
+            size_t utf16_span_avx2(const char16_t* src, size_t n) noexcept {
+                if (n == 0 || (src[0] & 0xfc00) == 0xdc00)
+                    return 0;
+                auto mask = _mm256_set1_epi16(short(0xfc00));
+                auto high = _mm256_set1_epi16(short(0xd800));
+                auto low = _mm256_set1_epi16(short(0xdc00));
+                size_t i = 0;
+                for (; i + 17 <= n; i += 16) {
+                    auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                    auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 1));
+                    auto a_high = _mm256_cmpeq_epi16(_mm256_and_si256(a, mask), high);
+                    auto b_low = _mm256_cmpeq_epi16(_mm256_and_si256(b, mask), low);
+                    if (unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi16(a_high, b_low))) != 0xffffffffu)
+                        break;
+                }
+                return utf16_boundary(src, i);
+            }
+
+            size_t utf8_count_sse2(const char* src, size_t n) noexcept {
+                auto limit = _mm_set1_epi8(-65);
+                size_t count = 0, i = 0;
+                for (; i + 16 <= n; i += 16) {
+                    auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                    count += __builtin_popcount(unsigned(_mm_movemask_epi8(_mm_cmpgt_epi8(block, limit))));
+                }
+                return count + utf8_count_word(src + i, n - i);
+            }
+
+            size_t utf16_count_sse2(const char16_t* src, size_t n) noexcept {
+                auto mask = _mm_set1_epi16(short(0xfc00));
+                auto low = _mm_set1_epi16(short(0xdc00));
+                size_t count = 0, i = 0;
+                for (; i + 8 <= n; i += 8) {
+                    auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                    auto lows = _mm_cmpeq_epi16(_mm_and_si128(block, mask), low);
+                    count += 8 - __builtin_popcount(unsigned(_mm_movemask_epi8(lows))) / 2;
+                }
+                return count + utf16_count_word(src + i, n - i);
+            }
+
+            size_t utf8_advance_sse2(const char* src, size_t n, size_t& k) noexcept {
+                auto limit = _mm_set1_epi8(-65);
+                size_t i = 0, index = 0;
+                for (; i + 16 <= n; i += 16) {
+                    auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                    auto starts = uint32_t(_mm_movemask_epi8(_mm_cmpgt_epi8(block, limit)));
+                    if (select_start<1>(starts, k, index))
+                        return i + index;
+                }
+                return i + utf8_advance_word(src + i, n - i, k);
+            }
+
+            size_t utf16_advance_sse2(const char16_t* src, size_t n, size_t& k) noexcept {
+                auto mask = _mm_set1_epi16(short(0xfc00));
+                auto low = _mm_set1_epi16(short(0xdc00));
+                size_t i = 0, index = 0;
+                for (; i + 8 <= n; i += 8) {
+                    auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                    auto lows = _mm_cmpeq_epi16(_mm_and_si128(block, mask), low);
+                    auto starts = ~ uint32_t(_mm_movemask_epi8(lows)) & 0xffff;
+                    if (select_start<2>(starts, k, index))
+                        return i + index;
+                }
+                return i + utf16_advance_word(src + i, n - i, k);
+            }
+
+            __attribute__((__target__("avx2,popcnt")))
+            size_t utf8_count_avx2(const char* src, size_t n) noexcept {
+                auto limit = _mm256_set1_epi8(-65);
+                size_t count = 0, i = 0;
+                for (; i + 32 <= n; i += 32) {
+                    auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                    count += __builtin_popcount(unsigned(_mm256_movemask_epi8(_mm256_cmpgt_epi8(block, limit))));
+                }
+                return count + utf8_count_word(src + i, n - i);
+            }
+
+            __attribute__((__target__("avx2,popcnt")))
+            size_t utf16_count_avx2(const char16_t* src, size_t n) noexcept {
+                auto mask = _mm256_set1_epi16(short(0xfc00));
+                auto low = _mm256_set1_epi16(short(0xdc00));
+                size_t count = 0, i = 0;
+                for (; i + 16 <= n; i += 16) {
+                    auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                    auto lows = _mm256_cmpeq_epi16(_mm256_and_si256(block, mask), low);
+                    count += 16 - __builtin_popcount(unsigned(_mm256_movemask_epi8(lows))) / 2;
+                }
+                return count + utf16_count_word(src + i, n - i);
+            }
+
+            __attribute__((__target__("avx2,popcnt")))
+            size_t utf8_advance_avx2(const char* src, size_t n, size_t& k) noexcept {
+                auto limit = _mm256_set1_epi8(-65);
+                size_t i = 0, index = 0;
+                for (; i + 32 <= n; i += 32) {
+                    auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                    auto starts = uint32_t(_mm256_movemask_epi8(_mm256_cmpgt_epi8(block, limit)));
+                    if (select_start<1>(starts, k, index))
+                        return i + index;
+                }
+                return i + utf8_advance_word(src + i, n - i, k);
+            }
+
+            __attribute__((__target__("avx2,popcnt")))
+            size_t utf16_advance_avx2(const char16_t* src, size_t n, size_t& k) noexcept {
+                auto mask = _mm256_set1_epi16(short(0xfc00));
+                auto low = _mm256_set1_epi16(short(0xdc00));
+                size_t i = 0, index = 0;
+                for (; i + 16 <= n; i += 16) {
+                    auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                    auto lows = _mm256_cmpeq_epi16(_mm256_and_si256(block, mask), low);
+                    auto starts = ~ uint32_t(_mm256_movemask_epi8(lows));
+                    if (select_start<2>(starts, k, index))
+                        return i + index;
+                }
+                return i + utf16_advance_word(src + i, n - i, k);
+            }
+
+            void swap16_sse2(const char* src, size_t n, char16_t* dst) noexcept {
+                size_t i = 0;
+                for (; i + 8 <= n; i += 8) {
+                    auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * i));
+                    block = _mm_or_si128(_mm_slli_epi16(block, 8), _mm_srli_epi16(block, 8));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), block);
+                }
+                swap16_word(src + 2 * i, n - i, dst + i);
+            }
+
+            void swap32_sse2(const char* src, size_t n, char32_t* dst) noexcept {
+                size_t i = 0;
+                for (; i + 4 <= n; i += 4) {
+                    auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4 * i));
+                    block = _mm_or_si128(_mm_slli_epi16(block, 8), _mm_srli_epi16(block, 8));
+                    block = _mm_shufflehi_epi16(_mm_shufflelo_epi16(block, 0xb1), 0xb1);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), block);
+                }
+                swap32_word(src + 4 * i, n - i, dst + i);
+            }
+
+            __attribute__((__target__("avx2")))
+            void swap16_avx2(const char* src, size_t n, char16_t* dst) noexcept {
+                auto order = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                    1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+                size_t i = 0;
+                for (; i + 16 <= n; i += 16) {
+                    auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 2 * i));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_shuffle_epi8(block, order));
+                }
+                swap16_sse2(src + 2 * i, n - i, dst + i);
+            }
+
+            __attribute__((__target__("avx2")))
+            void swap32_avx2(const char* src, size_t n, char32_t* dst) noexcept {
+                auto order = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+                size_t i = 0;
+                for (; i + 8 <= n; i += 8) {
+                    auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 4 * i));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_shuffle_epi8(block, order));
+                }
+                swap32_sse2(src + 4 * i, n - i, dst + i);
+            }
+
+        #endif
+
+        struct UtfKernels {
+            size_t (*span)(const char*, size_t) noexcept;
+            void (*widen16)(const char*, size_t, char16_t*) noexcept;
+            void (*widen32)(const char*, size_t, char32_t*) noexcept;
+            size_t (*utf8_span)(const char*, size_t) noexcept;
+            size_t (*utf16_span)(const char16_t*, size_t) noexcept;
+            size_t (*utf8_count)(const char*, size_t) noexcept;
+            size_t (*utf16_count)(const char16_t*, size_t) noexcept;
+            size_t (*utf8_advance)(const char*, size_t, size_t&) noexcept;
+            size_t (*utf16_advance)(const char16_t*, size_t, size_t&) noexcept;
+            void (*swap16)(const char*, size_t, char16_t*) noexcept;
+            void (*swap32)(const char*, size_t, char32_t*) noexcept;
+            UtfKernels() noexcept;
+        };
+
+        UtfKernels::UtfKernels() noexcept:
+        span(ascii_span_word), widen16(ascii_widen_word<char16_t>), widen32(ascii_widen_word<char32_t>),
+        utf8_span(utf8_span_none), utf16_span(utf16_span_none),
+        utf8_count(utf8_count_word), utf16_count(utf16_count_word<char16_t>),
+        utf8_advance(utf8_advance_word), utf16_advance(utf16_advance_word<char16_t>),
+        swap16(swap16_word), swap32(swap32_word) {
+            #if defined(__SSE2__)
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx2")) {
+                    span = ascii_span_avx2;
+                    widen16 = ascii_widen_avx2;
+                    widen32 = ascii_widen_avx2;
+                    utf8_span = utf8_span_avx2;
+                    utf16_span = utf16_span_avx2;
+                    utf8_count = utf8_count_avx2;
+                    utf16_count = utf16_count_avx2;
+                    utf8_advance = utf8_advance_avx2;
+                    utf16_advance = utf16_advance_avx2;
+                    swap16 = swap16_avx2;
+                    swap32 = swap32_avx2;
+                } else {
+                    span = ascii_span_sse2;
+                    widen16 = ascii_widen_sse2;
+                    widen32 = ascii_widen_sse2;
+                    utf16_span = utf16_span_sse2;
+                    utf8_count = utf8_count_sse2;
+                    utf16_count = utf16_count_sse2;
+                    utf8_advance = utf8_advance_sse2;
+                    utf16_advance = utf16_advance_sse2;
+                    swap16 = swap16_sse2;
+                    swap32 = swap32_sse2;
+                    if (__builtin_cpu_supports("ssse3"))
+                        utf8_span = utf8_span_ssse3;
+                }
+            #endif
+        }
+
+        const UtfKernels& utf_kernels() noexcept {
+            static const UtfKernels kernels;
+            return kernels;
+        }
+
     }
 
     namespace UnicornDetail {
 
+        size_t ascii_span(const char* src, size_t n) noexcept {
+            return utf_kernels().span(src, n);
+        }
+
+        void ascii_widen(const char* src, size_t n, char16_t* dst) noexcept {
+            utf_kernels().widen16(src, n, dst);
+        }
+
+        void ascii_widen(const char* src, size_t n, char32_t* dst) noexcept {
+            utf_kernels().widen32(src, n, dst);
+        }
+
+        void ascii_widen(const char* src, size_t n, wchar_t* dst) noexcept {
+            static constexpr size_t block = 256;
+            WcharEquivalent buf[block];
+            for (size_t i = 0; i < n; i += block) {
+                size_t len = std::min(n - i, block);
+                ascii_widen(src + i, len, buf);
+                memcpy(dst + i, buf, len * sizeof(wchar_t));
+            }
+        }
+
+        size_t utf_error_offset(const char* src, size_t n) noexcept {
+            size_t pos = utf_kernels().utf8_span(src, n);
+            char32_t u = 0;
+            while (pos < n) {
+                if (uint8_t(src[pos]) <= 0x7f) {
+                    pos += ascii_span(src + pos, n - pos);
+                    continue;
+                }
+                auto rc = UtfEncoding<char>::decode(src + pos, n - pos, u);
+                if (! char_is_unicode(u))
+                    return pos;
+                pos += rc;
+            }
+            return npos;
+        }
+
+        size_t utf_error_offset(const char16_t* src, size_t n) noexcept {
+            size_t pos = utf_kernels().utf16_span(src, n);
+            char32_t u = 0;
+            while (pos < n) {
+                auto rc = UtfEncoding<char16_t>::decode(src + pos, n - pos, u);
+                if (! char_is_unicode(u))
+                    return pos;
+                pos += rc;
+            }
+            return npos;
+        }
+
+        size_t utf_error_offset(const wchar_t* src, size_t n) noexcept {
+            for (size_t pos = 0; pos < n; ++pos) {
+                auto u = char32_t(src[pos]);
+                if (sizeof(wchar_t) == 2 && char_is_high_surrogate(u) && pos + 1 < n && char_is_low_surrogate(char32_t(src[pos + 1])))
+                    ++pos;
+                else if (! char_is_unicode(u))
+                    return pos;
+            }
+            return npos;
+        }
+
+        size_t utf_char_count(const char* src, size_t n) noexcept {
+            return utf_kernels().utf8_count(src, n);
+        }
+
+        size_t utf_char_count(const char16_t* src, size_t n) noexcept {
+            return utf_kernels().utf16_count(src, n);
+        }
+
+        size_t utf_char_count(const wchar_t* src, size_t n) noexcept {
+            return sizeof(wchar_t) == 2 ? utf16_count_word(src, n) : n;
+        }
+
+        size_t utf_char_advance(const char* src, size_t n, size_t& k) noexcept {
+            return utf_kernels().utf8_advance(src, n, k);
+        }
+
+        size_t utf_char_advance(const char16_t* src, size_t n, size_t& k) noexcept {
+            return utf_kernels().utf16_advance(src, n, k);
+        }
+
+        size_t utf_char_advance(const wchar_t* src, size_t n, size_t& k) noexcept {
+            if (sizeof(wchar_t) == 2)
+                return utf16_advance_word(src, n, k);
+            auto ofs = std::min(n, k);
+            k -= ofs;
+            return ofs;
+        }
+
+        size_t hardware_threads() noexcept {
+            return std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        void parallel_blocks(size_t n, size_t threads, const std::function<void(size_t, size_t)>& f) {
+            threads = std::min(threads, n);
+            if (threads <= 1) {
+                f(0, n);
+                return;
+            }
+            std::vector<std::thread> workers;
+            std::vector<std::exception_ptr> errors(threads);
+            auto block = [&f, &errors, n, threads] (size_t t) {
+                try {
+                    f(n * t / threads, n * (t + 1) / threads);
+                }
+                catch (...) {
+                    errors[t] = std::current_exception();
+                }
+            };
+            size_t t = 0;
+            try {
+                workers.reserve(threads);
+                for (; t < threads; ++t)
+                    workers.emplace_back(block, t);
+            }
+            catch (...) {
+                // Any blocks that could not be given a thread of their own
+                // are run here, so the threads already started are always
+                // joined
+                for (; t < threads; ++t)
+                    block(t);
+            }
+            for (auto& w: workers)
+                w.join();
+            for (auto& e: errors)
+                if (e)
+                    std::rethrow_exception(e);
+        }
+
+        void utf_load_units(const char* src, size_t n, bool swap, char16_t* dst) noexcept {
+            if (swap)
+                utf_kernels().swap16(src, n, dst);
+            else
+                memmove(dst, src, 2 * n);
+        }
+
+        void utf_load_units(const char* src, size_t n, bool swap, char32_t* dst) noexcept {
+            if (swap)
+                utf_kernels().swap32(src, n, dst);
+            else
+                memmove(dst, src, 4 * n);
+        }
+
         //  UTF-8 byte distribution:
         //      00-7f = Single byte character
         //      80-bf = Second or later byte of a multibyte character
@@ -3,11 +3,17 @@
 #include "unicorn/core.hpp"
 #include "unicorn/character.hpp"
 #include <algorithm>
+#include <cstring>
+#include <functional>
 #include <iterator>
 #include <string>
 #include <type_traits>
 #include <vector>
 
+#if __cplusplus >= 201703L
+    #include <string_view>
+#endif
+
 namespace Unicorn {
 
     // Constants
@@ -132,6 +138,62 @@ namespace Unicorn {
             { str += static_cast<C>(replacement_char); }
         inline void append_error(u8string& str) { str += utf8_replacement; }
 
+        // ascii_span() returns the number of leading bytes in src (up to n)
+        // that are ASCII. ascii_widen() copies n bytes, which must all be
+        // ASCII, into a UTF-16 or UTF-32 buffer. These use SSE2 or AVX2
+        // when available, selected at run time by CPU feature detection.
+        // The wchar_t versions of these and the functions below never
+        // access a wchar_t buffer through a pointer to the equivalent
+        // character type, which would break the aliasing rules.
+
+        size_t ascii_span(const char* src, size_t n) noexcept;
+        void ascii_widen(const char* src, size_t n, char16_t* dst) noexcept;
+        void ascii_widen(const char* src, size_t n, char32_t* dst) noexcept;
+        void ascii_widen(const char* src, size_t n, wchar_t* dst) noexcept;
+
+        // utf_error_offset() returns the offset of the first invalid code
+        // unit in src, or npos if the whole buffer is valid; this is the
+        // same position at which decoding would first fail. UTF-8 and UTF-16
+        // are checked in bulk with SIMD where the CPU supports it, and only
+        // the neighbourhood of an error is decoded one character at a time.
+
+        size_t utf_error_offset(const char* src, size_t n) noexcept;
+        size_t utf_error_offset(const char16_t* src, size_t n) noexcept;
+
+        inline size_t utf_error_offset(const char32_t* src, size_t n) noexcept {
+            for (size_t pos = 0; pos < n; ++pos)
+                if (! char_is_unicode(src[pos]))
+                    return pos;
+            return npos;
+        }
+
+        size_t utf_error_offset(const wchar_t* src, size_t n) noexcept;
+
+        // utf_char_count() returns the number of characters in src.
+        // utf_char_advance() returns the offset of the start of the k'th
+        // character (counting from zero), and reduces k by the number of
+        // characters skipped; if there are fewer than k characters, it
+        // returns n and leaves the shortfall in k. These assume the input
+        // is valid and src starts on a character boundary.
+
+        size_t utf_char_count(const char* src, size_t n) noexcept;
+        size_t utf_char_count(const char16_t* src, size_t n) noexcept;
+        size_t utf_char_advance(const char* src, size_t n, size_t& k) noexcept;
+        size_t utf_char_advance(const char16_t* src, size_t n, size_t& k) noexcept;
+
+        inline size_t utf_char_count(const char32_t* /*src*/, size_t n) noexcept {
+            return n;
+        }
+
+        inline size_t utf_char_advance(const char32_t* /*src*/, size_t n, size_t& k) noexcept {
+            auto ofs = std::min(n, k);
+            k -= ofs;
+            return ofs;
+        }
+
+        size_t utf_char_count(const wchar_t* src, size_t n) noexcept;
+        size_t utf_char_advance(const wchar_t* src, size_t n, size_t& k) noexcept;
+
     }
 
     // Utility functions
@@ -196,6 +258,7 @@ namespace Unicorn {
         Irange<const C*> range() const noexcept;
         string_type str() const { return sptr ? sptr->substr(ofs, units) : string_type(); }
         bool valid() const noexcept { return ok; }
+        uint32_t flags() const noexcept { return fset; }
         friend bool operator==(const UtfIterator& lhs, const UtfIterator& rhs) noexcept
             { return lhs.ofs == rhs.ofs; }
     private:
@@ -297,6 +360,214 @@ namespace Unicorn {
         return u_str(range.begin(), range.end());
     }
 
+    // Non-owning UTF decoding iterator and view
+
+    // UtfSpanIterator behaves exactly like UtfIterator, except that it works
+    // on a code unit pointer and length instead of a string object, so text
+    // can be decoded without copying it into a string first. The caller is
+    // responsible for keeping the underlying buffer alive.
+
+    template <typename C> class UtfView;
+
+    template <typename C>
+    class UtfSpanIterator:
+    public BidirectionalIterator<UtfSpanIterator<C>, const char32_t> {
+    public:
+        using code_unit = C;
+        using string_type = basic_string<C>;
+        UtfSpanIterator() = default;
+        UtfSpanIterator(const C* src, size_t n, size_t offset = 0, uint32_t flags = 0):
+            ptr(src), len(src ? n : 0), ofs(std::min(offset, len)), fset(flags)
+            { if (bits_set(fset & err_flags) == 0) fset |= err_ignore; ++*this; }
+        const char32_t& operator*() const noexcept { return u; }
+        UtfSpanIterator& operator++();
+        UtfSpanIterator& operator--();
+        UtfView<C> source() const noexcept { return {ptr, len}; }
+        size_t offset() const noexcept { return ofs; }
+        size_t count() const noexcept { return units; }
+        Irange<const C*> range() const noexcept { return {ptr + ofs, ptr + ofs + units}; }
+        string_type str() const { return ptr ? string_type(ptr + ofs, units) : string_type(); }
+        bool valid() const noexcept { return ok; }
+        uint32_t flags() const noexcept { return fset; }
+        friend bool operator==(const UtfSpanIterator& lhs, const UtfSpanIterator& rhs) noexcept
+            { return lhs.ofs == rhs.ofs; }
+    private:
+        const C* ptr = nullptr;      // Source data
+        size_t len = 0;              // Length of source data
+        size_t ofs = 0;              // Offset of current character in source
+        size_t units = 0;            // Code units in current character
+        char32_t u = 0;              // Current decoded character
+        uint32_t fset = err_ignore;  // Error handling flag
+        bool ok = false;             // Current character is valid
+    };
+
+    template <typename C>
+    UtfSpanIterator<C>& UtfSpanIterator<C>::operator++() {
+        using namespace UnicornDetail;
+        ofs = std::min(ofs + units, len);
+        units = 0;
+        u = 0;
+        ok = false;
+        if (ofs == len)
+            return *this;
+        if (fset & err_ignore) {
+            units = UtfEncoding<C>::decode_fast(ptr + ofs, len - ofs, u);
+            ok = true;
+        } else {
+            units = UtfEncoding<C>::decode(ptr + ofs, len - ofs, u);
+            ok = char_is_unicode(u);
+            if (! ok) {
+                u = replacement_char;
+                if (fset & err_throw)
+                    throw EncodingError(UtfEncoding<C>::name(), ofs, ptr + ofs, units);
+            }
+        }
+        return *this;
+    }
+
+    template <typename C>
+    UtfSpanIterator<C>& UtfSpanIterator<C>::operator--() {
+        using namespace UnicornDetail;
+        units = 0;
+        u = 0;
+        ok = false;
+        if (ofs == 0)
+            return *this;
+        units = UtfEncoding<C>::decode_prev(ptr, ofs, u);
+        ofs -= units;
+        ok = (fset & err_ignore) || char_is_unicode(u);
+        if (! ok) {
+            u = replacement_char;
+            if (fset & err_throw)
+                throw EncodingError(UtfEncoding<C>::name(), ofs, ptr + ofs, units);
+        }
+        return *this;
+    }
+
+    template <typename C>
+    class UtfView {
+    public:
+        using code_unit = C;
+        using iterator = UtfSpanIterator<C>;
+        using const_iterator = UtfSpanIterator<C>;
+        using string_type = basic_string<C>;
+        UtfView() = default;
+        UtfView(const C* src, size_t n) noexcept: ptr(src), len(src ? n : 0) {}
+        UtfView(const string_type& src) noexcept: ptr(src.data()), len(src.size()) {}
+        #if __cplusplus >= 201703L
+            UtfView(std::basic_string_view<C> src) noexcept: ptr(src.data()), len(src.size()) {}
+        #endif
+        iterator begin() const { return {ptr, len, 0}; }
+        iterator end() const { return {ptr, len, len}; }
+        const C* data() const noexcept { return ptr; }
+        size_t size() const noexcept { return len; }
+        bool empty() const noexcept { return len == 0; }
+        string_type str() const { return ptr ? string_type(ptr, len) : string_type(); }
+    private:
+        const C* ptr = nullptr;
+        size_t len = 0;
+    };
+
+    using Utf8View = UtfView<char>;
+    using Utf8SpanIterator = UtfSpanIterator<char>;
+    using Utf16View = UtfView<char16_t>;
+    using Utf16SpanIterator = UtfSpanIterator<char16_t>;
+    using Utf32View = UtfView<char32_t>;
+    using Utf32SpanIterator = UtfSpanIterator<char32_t>;
+    using WcharView = UtfView<wchar_t>;
+    using WcharSpanIterator = UtfSpanIterator<wchar_t>;
+
+    template <typename C>
+    UtfView<C> utf_view(const C* src, size_t n) noexcept {
+        return {src, n};
+    }
+
+    template <typename C>
+    UtfView<C> utf_view(const basic_string<C>& src) noexcept {
+        return {src};
+    }
+
+    #if __cplusplus >= 201703L
+
+        template <typename C>
+        UtfView<C> utf_view(std::basic_string_view<C> src) noexcept {
+            return {src};
+        }
+
+    #endif
+
+    template <typename C>
+    UtfSpanIterator<C> utf_begin(const UtfView<C>& src, uint32_t flags = 0) {
+        return {src.data(), src.size(), 0, flags};
+    }
+
+    template <typename C>
+    UtfSpanIterator<C> utf_end(const UtfView<C>& src, uint32_t flags = 0) {
+        return {src.data(), src.size(), src.size(), flags};
+    }
+
+    template <typename C>
+    UtfSpanIterator<C> utf_iterator(const UtfView<C>& src, size_t offset, uint32_t flags = 0) {
+        return {src.data(), src.size(), offset, flags};
+    }
+
+    template <typename C>
+    Irange<UtfSpanIterator<C>> utf_range(const UtfView<C>& src, uint32_t flags = 0) {
+        return {utf_begin(src, flags), utf_end(src, flags)};
+    }
+
+    #if __cplusplus >= 201703L
+
+        template <typename C>
+        UtfSpanIterator<C> utf_begin(std::basic_string_view<C> src, uint32_t flags = 0) {
+            return utf_begin(UtfView<C>(src), flags);
+        }
+
+        template <typename C>
+        UtfSpanIterator<C> utf_end(std::basic_string_view<C> src, uint32_t flags = 0) {
+            return utf_end(UtfView<C>(src), flags);
+        }
+
+        template <typename C>
+        UtfSpanIterator<C> utf_iterator(std::basic_string_view<C> src, size_t offset, uint32_t flags = 0) {
+            return utf_iterator(UtfView<C>(src), offset, flags);
+        }
+
+        template <typename C>
+        Irange<UtfSpanIterator<C>> utf_range(std::basic_string_view<C> src, uint32_t flags = 0) {
+            return utf_range(UtfView<C>(src), flags);
+        }
+
+    #endif
+
+    template <typename C>
+    basic_string<C> u_str(const UtfSpanIterator<C>& i, const UtfSpanIterator<C>& j) {
+        return basic_string<C>(i.source().data() + i.offset(), j.offset() - i.offset());
+    }
+
+    template <typename C>
+    basic_string<C> u_str(const Irange<UtfSpanIterator<C>>& range) {
+        return u_str(range.begin(), range.end());
+    }
+
+    namespace UnicornDetail {
+
+        // Construct an iterator on the same source as i, at a different
+        // offset, which must be on a character boundary
+
+        template <typename C>
+        UtfIterator<C> utf_iterator_at(const UtfIterator<C>& i, size_t offset) {
+            return {i.source(), offset, i.flags()};
+        }
+
+        template <typename C>
+        UtfSpanIterator<C> utf_iterator_at(const UtfSpanIterator<C>& i, size_t offset) {
+            auto src = i.source();
+            return {src.data(), src.size(), offset, i.flags()};
+        }
+
+    }
+
     // UTF encoding iterator
 
     template <typename C>
@@ -325,11 +596,12 @@ namespace Unicorn {
             return *this;
         bool fast = fset & err_ignore;
         auto pos = sptr->size();
-        sptr->resize(pos + UtfEncoding<C>::max_units);
         size_t rc = 0;
-        if (fast || char_is_unicode(u))
-            rc = UtfEncoding<C>::encode(u, &(*sptr)[pos]);
-        sptr->resize(pos + rc);
+        if (fast || char_is_unicode(u)) {
+            C buf[UtfEncoding<C>::max_units];
+            rc = UtfEncoding<C>::encode(u, buf);
+            sptr->append(buf, rc);
+        }
         if (fast) {
             ok = true;
         } else {
@@ -358,14 +630,135 @@ namespace Unicorn {
 
     namespace UnicornDetail {
 
+        // utf_incomplete_tail() returns the number of code units at the end
+        // of the buffer that form the start of a valid encoded character
+        // that is not yet complete (always less than max_units).
+
+        inline size_t utf_incomplete_tail(const char* src, size_t n) noexcept {
+            auto code = reinterpret_cast<const uint8_t*>(src);
+            for (size_t k = 1; k <= 3 && k <= n; ++k) {
+                auto c = code[n - k];
+                if (c >= 0x80 && c <= 0xbf)
+                    continue;
+                if (c < 0xc2 || c > 0xf4)
+                    return 0;
+                size_t len = c <= 0xdf ? 2 : c <= 0xef ? 3 : 4;
+                if (len <= k)
+                    return 0;
+                if (k >= 2) {
+                    auto c2 = code[n - k + 1];
+                    if ((c == 0xe0 && c2 < 0xa0) || (c == 0xed && c2 > 0x9f)
+                            || (c == 0xf0 && c2 < 0x90) || (c == 0xf4 && c2 > 0x8f))
+                        return 0;
+                }
+                return k;
+            }
+            return 0;
+        }
+
+        inline size_t utf_incomplete_tail(const char16_t* src, size_t n) noexcept {
+            return n > 0 && char_is_high_surrogate(src[n - 1]) ? 1 : 0;
+        }
+
+        inline size_t utf_incomplete_tail(const char32_t* /*src*/, size_t /*n*/) noexcept {
+            return 0;
+        }
+
+        inline size_t utf_incomplete_tail(const wchar_t* src, size_t n) noexcept {
+            return sizeof(wchar_t) == 2 && n > 0 && char_is_high_surrogate(char32_t(src[n - 1])) ? 1 : 0;
+        }
+
+        // ValidLength returns the number of output code units needed to
+        // convert a string that is already known to be valid. These are
+        // simple branch free counting loops that the compiler can vectorize.
+        // They are selected by the code unit sizes, but read the input
+        // through its own code unit type, so a wchar_t buffer is never
+        // accessed through a pointer to the equivalent character type.
+
+        template <typename C1, typename C2, size_t S1 = sizeof(C1), size_t S2 = sizeof(C2)>
+        struct ValidLength {
+            size_t operator()(const C1* /*src*/, size_t n) const noexcept { return n; }
+        };
+
         template <typename C1, typename C2>
-        struct Recode {
-            void operator()(const C1* src, size_t n, basic_string<C2>& dst, uint32_t flags) const {
-                if (! src)
-                    return;
-                if (bits_set(flags & err_flags) == 0)
-                    flags |= err_ignore;
-                size_t pos = 0;
+        struct ValidLength<C1, C2, 1, 2> {
+            size_t operator()(const C1* src, size_t n) const noexcept {
+                size_t len = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    auto code = uint8_t(src[i]);
+                    len += size_t((code & 0xc0) != 0x80) + size_t(code >= 0xf0);
+                }
+                return len;
+            }
+        };
+
+        template <typename C1, typename C2>
+        struct ValidLength<C1, C2, 1, 4> {
+            size_t operator()(const C1* src, size_t n) const noexcept {
+                size_t len = 0;
+                for (size_t i = 0; i < n; ++i)
+                    len += size_t((uint8_t(src[i]) & 0xc0) != 0x80);
+                return len;
+            }
+        };
+
+        template <typename C1, typename C2>
+        struct ValidLength<C1, C2, 2, 1> {
+            size_t operator()(const C1* src, size_t n) const noexcept {
+                size_t len = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    auto code = char16_t(src[i]);
+                    len += 1 + size_t(code >= 0x80) + size_t(code >= 0x800)
+                        - size_t(code >= 0xd800 && code <= 0xdfff);
+                }
+                return len;
+            }
+        };
+
+        template <typename C1, typename C2>
+        struct ValidLength<C1, C2, 2, 4> {
+            size_t operator()(const C1* src, size_t n) const noexcept {
+                size_t len = n;
+                for (size_t i = 0; i < n; ++i)
+                    len -= size_t((char16_t(src[i]) & 0xfc00) == 0xdc00);
+                return len;
+            }
+        };
+
+        template <typename C1, typename C2>
+        struct ValidLength<C1, C2, 4, 1> {
+            size_t operator()(const C1* src, size_t n) const noexcept {
+                size_t len = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    auto code = char32_t(src[i]);
+                    len += 1 + size_t(code >= 0x80) + size_t(code >= 0x800) + size_t(code >= 0x10000);
+                }
+                return len;
+            }
+        };
+
+        template <typename C1, typename C2>
+        struct ValidLength<C1, C2, 4, 2> {
+            size_t operator()(const C1* src, size_t n) const noexcept {
+                size_t len = n;
+                for (size_t i = 0; i < n; ++i)
+                    len += size_t(char32_t(src[i]) >= 0x10000);
+                return len;
+            }
+        };
+
+        // RecodeInto converts as many complete characters as will fit in
+        // the output buffer, and returns the number of code units written;
+        // if used is not null, the number of input units consumed is stored
+        // there. If dst is null, nothing is written and the return value is
+        // the full output length (this is used to measure invalid input,
+        // where the error handling affects the length). The flags are
+        // assumed to have already been defaulted.
+
+        template <typename C1, typename C2>
+        struct RecodeInto {
+            size_t operator()(const C1* src, size_t n, C2* dst, size_t cap, uint32_t flags, size_t* used = nullptr) const {
+                size_t pos = 0, len = 0;
                 char32_t u = 0;
                 C2 buf[UtfEncoding<C2>::max_units];
                 while (pos < n) {
@@ -375,143 +768,244 @@ namespace Unicorn {
                             throw EncodingError(UtfEncoding<C1>::name(), pos, src + pos, rc);
                         u = replacement_char;
                     }
-                    pos += rc;
-                    rc = UtfEncoding<C2>::encode(u, buf);
-                    dst.append(buf, rc);
-                }
-            }
-        };
-
-        template <typename C1>
-        struct Recode<C1, char32_t> {
-            void operator()(const C1* src, size_t n, u32string& dst, uint32_t flags) const {
-                if (! src)
-                    return;
-                if (bits_set(flags & err_flags) == 0)
-                    flags |= err_ignore;
-                size_t pos = 0;
-                char32_t u = 0;
-                if (flags & err_ignore) {
-                    while (pos < n) {
-                        pos += UtfEncoding<C1>::decode(src + pos, n - pos, u);
-                        dst += u;
-                    }
-                } else {
-                    while (pos < n) {
-                        auto rc = UtfEncoding<C1>::decode(src + pos, n - pos, u);
-                        if (char_is_unicode(u))
-                            dst += u;
-                        else if (flags & err_throw)
-                            throw EncodingError(UtfEncoding<C1>::name(), pos, src + pos, rc);
-                        else
-                            dst += replacement_char;
-                        pos += rc;
+                    if (dst && cap - len >= UtfEncoding<C2>::max_units) {
+                        len += UtfEncoding<C2>::encode(u, dst + len);
+                    } else {
+                        auto units = UtfEncoding<C2>::encode(u, buf);
+                        if (dst) {
+                            if (units > cap - len)
+                                break;
+                            std::copy_n(buf, units, dst + len);
+                        }
+                        len += units;
                     }
+                    pos += rc;
                 }
+                if (used)
+                    *used = pos;
+                return len;
             }
         };
 
         template <typename C2>
-        struct Recode<char32_t, C2> {
-            void operator()(const char32_t* src, size_t n, basic_string<C2>& dst, uint32_t flags) const {
-                if (! src)
-                    return;
-                if (bits_set(flags & err_flags) == 0)
-                    flags |= err_ignore;
+        struct RecodeInto<char32_t, C2> {
+            size_t operator()(const char32_t* src, size_t n, C2* dst, size_t cap, uint32_t flags, size_t* used = nullptr) const {
+                size_t pos = 0, len = 0;
                 char32_t u = 0;
                 C2 buf[UtfEncoding<C2>::max_units];
-                for (size_t pos = 0; pos < n; ++pos) {
-                    if (n == npos && src[pos] == 0)
-                        break;
-                    else if ((flags & err_ignore) || char_is_unicode(src[pos]))
+                for (; pos < n; ++pos) {
+                    if ((flags & err_ignore) || char_is_unicode(src[pos]))
                         u = src[pos];
                     else if (flags & err_throw)
                         throw EncodingError(UtfEncoding<char32_t>::name(), pos, src + pos);
                     else
                         u = replacement_char;
-                    auto rc = UtfEncoding<C2>::encode(u, buf);
-                    dst.append(buf, rc);
+                    auto units = UtfEncoding<C2>::encode(u, buf);
+                    if (dst) {
+                        if (units > cap - len)
+                            break;
+                        std::copy_n(buf, units, dst + len);
+                    }
+                    len += units;
                 }
+                if (used)
+                    *used = pos;
+                return len;
             }
         };
 
+        // Same encoding conversion copies the valid prefix in bulk, and only
+        // decodes from the first invalid code unit onward.
+
         template <typename C>
-        struct Recode<C, C> {
-            void operator()(const C* src, size_t n, basic_string<C>& dst, uint32_t flags) const {
-                if (! src)
-                    return;
-                if (bits_set(flags & err_flags) == 0)
-                    flags |= err_ignore;
-                size_t pos = 0;
+        struct RecodeSame {
+            size_t operator()(const C* src, size_t n, C* dst, size_t cap, uint32_t flags, size_t* used = nullptr) const {
+                size_t pos = flags & err_ignore ? n : std::min(utf_error_offset(src, n), n);
+                if (dst) {
+                    pos = std::min(pos, cap);
+                    pos -= utf_incomplete_tail(src, pos);
+                    std::copy_n(src, pos, dst);
+                }
+                size_t len = pos;
                 char32_t u = 0;
                 C buf[UtfEncoding<C>::max_units];
-                if (flags & err_ignore) {
-                    while (pos < n) {
-                        auto rc = UtfEncoding<C>::decode(src + pos, n - pos, u);
-                        dst.append(src + pos, rc);
-                        pos += rc;
-                    }
-                } else {
-                    while (pos < n) {
-                        auto rc = UtfEncoding<C>::decode(src + pos, n - pos, u);
-                        if (char_is_unicode(u)) {
-                            dst.append(src + pos, rc);
-                        } else if (flags & err_throw) {
+                while (pos < n) {
+                    auto rc = UtfEncoding<C>::decode(src + pos, n - pos, u);
+                    auto ptr = src + pos, units = rc;
+                    if (! (flags & err_ignore) && ! char_is_unicode(u)) {
+                        if (flags & err_throw)
                             throw EncodingError(UtfEncoding<C>::name(), pos, src + pos, rc);
-                        } else {
-                            auto rc2 = UtfEncoding<C>::encode(replacement_char, buf);
-                            dst.append(buf, rc2);
-                        }
-                        pos += rc;
+                        units = UtfEncoding<C>::encode(replacement_char, buf);
+                        ptr = buf;
                     }
+                    if (dst) {
+                        if (units > cap - len)
+                            break;
+                        std::copy_n(ptr, units, dst + len);
+                    }
+                    len += units;
+                    pos += rc;
                 }
+                if (used)
+                    *used = pos;
+                return len;
             }
         };
 
-        template <>
-        struct Recode<char32_t, char32_t> {
-            void operator()(const char32_t* src, size_t n, u32string& dst, uint32_t flags) const {
+        template <> struct RecodeInto<char, char>: RecodeSame<char> {};
+        template <> struct RecodeInto<char16_t, char16_t>: RecodeSame<char16_t> {};
+        template <> struct RecodeInto<char32_t, char32_t>: RecodeSame<char32_t> {};
+        template <> struct RecodeInto<wchar_t, wchar_t>: RecodeSame<wchar_t> {};
+
+        // UTF-8 to UTF-16/32 conversion skips ASCII runs in bulk, only
+        // falling back on the general decoder at non-ASCII bytes. Runs are
+        // handled in limited blocks so the scan and copy stay in cache.
+
+        template <typename C2>
+        struct RecodeFromUtf8 {
+            size_t operator()(const char* src, size_t n, C2* dst, size_t cap, uint32_t flags, size_t* used = nullptr) const {
+                static constexpr size_t block = 1024;
+                size_t pos = 0, len = 0;
+                char32_t u = 0;
+                C2 buf[UtfEncoding<C2>::max_units];
+                while (pos < n) {
+                    if (uint8_t(src[pos]) <= 0x7f) {
+                        auto limit = std::min(n - pos, block);
+                        if (dst)
+                            limit = std::min(limit, cap - len);
+                        if (limit == 0)
+                            break;
+                        auto run = ascii_span(src + pos, limit);
+                        if (dst)
+                            ascii_widen(src + pos, run, dst + len);
+                        pos += run;
+                        len += run;
+                        continue;
+                    }
+                    auto rc = UtfEncoding<char>::decode(src + pos, n - pos, u);
+                    if (! (flags & err_ignore) && ! char_is_unicode(u)) {
+                        if (flags & err_throw)
+                            throw EncodingError(UtfEncoding<char>::name(), pos, src + pos, rc);
+                        u = replacement_char;
+                    }
+                    auto units = UtfEncoding<C2>::encode(u, buf);
+                    if (dst) {
+                        if (units > cap - len)
+                            break;
+                        std::copy_n(buf, units, dst + len);
+                    }
+                    len += units;
+                    pos += rc;
+                }
+                if (used)
+                    *used = pos;
+                return len;
+            }
+        };
+
+        template <> struct RecodeInto<char, char16_t>: RecodeFromUtf8<char16_t> {};
+        template <> struct RecodeInto<char, char32_t>: RecodeFromUtf8<char32_t> {};
+        template <> struct RecodeInto<char, wchar_t>: RecodeFromUtf8<wchar_t> {};
+
+        // Valid input is measured by the fast counting loops; anything else
+        // needs a full decoding pass with the error handling applied.
+
+        template <typename C1, typename C2>
+        size_t recode_length_of(const C1* src, size_t n, uint32_t flags) {
+            if (utf_error_offset(src, n) == npos)
+                return ValidLength<C1, C2>()(src, n);
+            else
+                return RecodeInto<C1, C2>()(src, n, nullptr, 0, flags);
+        }
+
+        // recode_measure() returns the exact output length, and adjusts the
+        // flags for the conversion pass: if the input is valid, the error
+        // handling makes no difference and is switched off.
+
+        template <typename C1, typename C2>
+        size_t recode_measure(const C1* src, size_t n, uint32_t& flags) {
+            if (utf_error_offset(src, n) == npos) {
+                flags = err_ignore;
+                return ValidLength<C1, C2>()(src, n);
+            }
+            if (bits_set(flags & err_flags) == 0)
+                flags |= err_ignore;
+            return RecodeInto<C1, C2>()(src, n, nullptr, 0, flags);
+        }
+
+        // Recode measures the output length first, then converts straight
+        // into the presized string, after truncating it to the given size
+        // (default is to append). With err_ignore the input is assumed to be
+        // valid and is measured without checking it; if that estimate turns
+        // out to be short, the rest is measured and converted separately.
+        // Otherwise the input is validated once, and any exception is thrown
+        // by the measuring pass before dst is modified. The source must not
+        // overlap the destination.
+
+        template <typename C1, typename C2>
+        struct Recode {
+            void operator()(const C1* src, size_t n, basic_string<C2>& dst, uint32_t flags, size_t size = npos) const {
                 if (! src)
                     return;
+                if (n == npos)
+                    n = std::char_traits<C1>::length(src);
                 if (bits_set(flags & err_flags) == 0)
                     flags |= err_ignore;
-                for (size_t pos = 0; pos < n; ++pos) {
-                    if (n == npos && src[pos] == 0)
-                        break;
-                    else if ((flags & err_throw) || char_is_unicode(src[pos]))
-                        dst += src[pos];
-                    else if (flags & err_throw)
-                        throw EncodingError(UtfEncoding<char32_t>::name(), pos, src + pos);
-                    else
-                        dst += replacement_char;
+                auto len = flags & err_ignore ? ValidLength<C1, C2>()(src, n)
+                    : recode_measure<C1, C2>(src, n, flags);
+                size = std::min(size, dst.size());
+                dst.resize(size + len);
+                size_t used = 0;
+                len = RecodeInto<C1, C2>()(src, n, &dst[0] + size, len, flags, &used);
+                if (used < n) {
+                    // Invalid input under err_ignore can outrun the estimate
+                    auto more = RecodeInto<C1, C2>()(src + used, n - used, nullptr, 0, flags);
+                    dst.resize(size + len + more);
+                    len += RecodeInto<C1, C2>()(src + used, n - used, &dst[0] + size + len, more, flags);
                 }
+                dst.resize(size + len);
             }
         };
 
+        // Conversions that replace the destination string write into it
+        // directly, reusing its capacity, unless the source lies within it.
+
+        template <typename C1, typename C2>
+        void recode_replace(const C1* src, size_t n, basic_string<C2>& dst, uint32_t flags) {
+            std::less<const void*> lt;
+            const void* ptr = src;
+            if (! src || lt(ptr, dst.data()) || ! lt(ptr, dst.data() + dst.size() + 1)) {
+                Recode<C1, C2>()(src, n, dst, flags, 0);
+            } else {
+                basic_string<C2> result;
+                Recode<C1, C2>()(src, n, result, flags);
+                dst.swap(result);
+            }
+        }
+
     };
 
     template <typename C1, typename C2>
     void recode(const basic_string<C1>& src, basic_string<C2>& dst,
             uint32_t flags = 0) {
-        basic_string<C2> result;
-        UnicornDetail::Recode<C1, C2>()(src.data(), src.size(), result, flags);
-        dst.swap(result);
+        UnicornDetail::recode_replace(src.data(), src.size(), dst, flags);
     }
 
     template <typename C1, typename C2>
     void recode(const basic_string<C1>& src, size_t offset, basic_string<C2>& dst,
             uint32_t flags = 0) {
-        basic_string<C2> result;
         if (offset < src.size())
-            UnicornDetail::Recode<C1, C2>()(src.data() + offset, src.size() - offset, result, flags);
-        dst.swap(result);
+            UnicornDetail::recode_replace(src.data() + offset, src.size() - offset, dst, flags);
+        else
+            dst.clear();
     }
 
     template <typename C1, typename C2>
     void recode(const C1* src, size_t count, basic_string<C2>& dst, uint32_t flags = 0) {
-        basic_string<C2> result;
-        UnicornDetail::Recode<C1, C2>()(src, count, result, flags);
-        dst.swap(result);
+        if (src)
+            UnicornDetail::recode_replace(src, count, dst, flags);
+        else
+            dst.clear();
     }
 
     template <typename C2, typename C1>
@@ -529,6 +1023,28 @@ namespace Unicorn {
         return result;
     }
 
+    template <typename C2, typename C1>
+    size_t recode_length(const C1* src, size_t count, uint32_t flags = 0) {
+        if (! src)
+            return 0;
+        if (count == npos)
+            count = std::char_traits<C1>::length(src);
+        if (bits_set(flags & err_flags) == 0)
+            flags |= err_ignore;
+        return UnicornDetail::recode_length_of<C1, C2>(src, count, flags);
+    }
+
+    template <typename C1, typename C2>
+    size_t recode_into(const C1* src, size_t count, C2* dst, size_t cap, uint32_t flags = 0) {
+        if (! src || ! dst)
+            return 0;
+        if (count == npos)
+            count = std::char_traits<C1>::length(src);
+        if (bits_set(flags & err_flags) == 0)
+            flags |= err_ignore;
+        return UnicornDetail::RecodeInto<C1, C2>()(src, count, dst, cap, flags);
+    }
+
     template <typename C>
     u8string to_utf8(const basic_string<C>& src, uint32_t flags = 0) {
         return recode<char>(src, flags);
@@ -554,58 +1070,324 @@ namespace Unicorn {
         return recode<NativeCharacter>(src, flags);
     }
 
+    // Batch UTF conversion
+
+    namespace UnicornDetail {
+
+        // parallel_blocks() splits the range [0,n) into contiguous blocks
+        // and calls f(begin,end) on each, using up to the given number of
+        // threads. If a thread cannot be started, the remaining blocks are
+        // run on the calling thread. The first exception thrown by any block
+        // is rethrown after all have finished.
+
+        size_t hardware_threads() noexcept;
+        void parallel_blocks(size_t n, size_t threads, const std::function<void(size_t, size_t)>& f);
+
+    }
+
+    template <typename C> class RecodedBatch;
+
+    template <typename C1, typename C2>
+    void recode_batch(const std::vector<basic_string<C1>>& src, RecodedBatch<C2>& dst, uint32_t flags = 0, size_t threads = 1);
+
+    template <typename C>
+    class RecodedBatch {
+    public:
+        using code_unit = C;
+        using string_type = basic_string<C>;
+        RecodedBatch() = default;
+        UtfView<C> operator[](size_t i) const noexcept { return {buf.data() + ofs[i], ofs[i + 1] - ofs[i]}; }
+        const C* data() const noexcept { return buf.data(); }
+        bool empty() const noexcept { return ofs.size() == 1; }
+        const std::vector<size_t>& offsets() const noexcept { return ofs; }
+        size_t size() const noexcept { return ofs.size() - 1; }
+        string_type str(size_t i) const { return buf.substr(ofs[i], ofs[i + 1] - ofs[i]); }
+        size_t units() const noexcept { return buf.size(); }
+        void clear() noexcept { buf.clear(); ofs.assign(1, 0); }
+    private:
+        template <typename C1, typename C2> friend void recode_batch(const std::vector<basic_string<C1>>& src,
+            RecodedBatch<C2>& dst, uint32_t flags, size_t threads);
+        string_type buf;                // Arena holding all converted strings
+        std::vector<size_t> ofs {0};    // Start of each string, plus end of the last
+    };
+
+    // Small batches are not worth the cost of starting threads; this is the
+    // minimum number of input code units per thread.
+
+    constexpr size_t recode_batch_grain = 1 << 16;
+
+    template <typename C1, typename C2>
+    void recode_batch(const std::vector<basic_string<C1>>& src, RecodedBatch<C2>& dst, uint32_t flags, size_t threads) {
+        using namespace UnicornDetail;
+        size_t n = src.size(), total = 0;
+        for (auto& s: src)
+            total += s.size();
+        if (threads == 0)
+            threads = hardware_threads();
+        threads = std::min(threads, total / recode_batch_grain + 1);
+        std::vector<size_t> ofs(n + 1, 0);
+        std::vector<uint32_t> fset(n, flags);
+        parallel_blocks(n, threads, [&] (size_t i, size_t j) {
+            for (; i < j; ++i)
+                ofs[i + 1] = recode_measure<C1, C2>(src[i].data(), src[i].size(), fset[i]);
+        });
+        for (size_t i = 0; i < n; ++i)
+            ofs[i + 1] += ofs[i];
+        dst.buf.resize(ofs[n]);
+        parallel_blocks(n, threads, [&] (size_t i, size_t j) {
+            for (; i < j; ++i)
+                RecodeInto<C1, C2>()(src[i].data(), src[i].size(), &dst.buf[0] + ofs[i], ofs[i + 1] - ofs[i], fset[i]);
+        });
+        dst.ofs.swap(ofs);
+    }
+
+    template <typename C2, typename C1>
+    RecodedBatch<C2> recode_batch(const std::vector<basic_string<C1>>& src, uint32_t flags = 0, size_t threads = 1) {
+        RecodedBatch<C2> dst;
+        recode_batch(src, dst, flags, threads);
+        return dst;
+    }
+
+    // Incremental UTF conversion
+
+    template <typename C1, typename C2>
+    class UtfStreamDecoder {
+    public:
+        using input_unit = C1;
+        using output_unit = C2;
+        using output_string = basic_string<C2>;
+        UtfStreamDecoder() noexcept {}
+        explicit UtfStreamDecoder(uint32_t flags) noexcept:
+            fset(flags) { if (bits_set(fset & err_flags) == 0) fset |= err_ignore; }
+        void feed(const C1* src, size_t n, output_string& dst);
+        void feed(const basic_string<C1>& src, output_string& dst) { feed(src.data(), src.size(), dst); }
+        void finish(output_string& dst);
+        size_t offset() const noexcept { return base + npend; }
+        size_t pending() const noexcept { return npend; }
+        void reset() noexcept { base = npend = 0; }
+    private:
+        static constexpr size_t max_pending = UnicornDetail::UtfEncoding<C1>::max_units;
+        C1 pend[max_pending] = {};     // Incomplete character carried over
+        size_t npend = 0;              // Number of units pending
+        size_t base = 0;               // Stream offset of first pending unit
+        uint32_t fset = err_ignore;    // Error handling flag
+        void convert(const C1* src, size_t n, output_string& dst);
+    };
+
+    template <typename C1, typename C2>
+    void UtfStreamDecoder<C1, C2>::feed(const C1* src, size_t n, output_string& dst) {
+        using namespace UnicornDetail;
+        if (! src || n == 0)
+            return;
+        size_t taken = 0;
+        if (npend > 0) {
+            // Complete the pending character first; any units that start a
+            // new incomplete character go back to the input
+            while (taken < n && npend < max_pending) {
+                pend[npend++] = src[taken++];
+                if (utf_incomplete_tail(pend, npend) < npend)
+                    break;
+            }
+            auto tail = utf_incomplete_tail(pend, npend);
+            if (tail == npend)
+                return;
+            npend -= tail;
+            taken -= tail;
+            convert(pend, npend, dst);
+            npend = 0;
+        }
+        src += taken;
+        n -= taken;
+        auto tail = utf_incomplete_tail(src, n);
+        convert(src, n - tail, dst);
+        std::copy_n(src + n - tail, tail, pend);
+        npend = tail;
+    }
+
+    template <typename C1, typename C2>
+    void UtfStreamDecoder<C1, C2>::finish(output_string& dst) {
+        auto n = npend;
+        npend = 0;
+        convert(pend, n, dst);
+        base = 0;
+    }
+
+    template <typename C1, typename C2>
+    void UtfStreamDecoder<C1, C2>::convert(const C1* src, size_t n, output_string& dst) {
+        using namespace UnicornDetail;
+        if (n == 0)
+            return;
+        if (fset & err_throw) {
+            auto pos = utf_error_offset(src, n);
+            if (pos != npos) {
+                char32_t u = 0;
+                auto rc = UtfEncoding<C1>::decode(src + pos, n - pos, u);
+                throw EncodingError(UtfEncoding<C1>::name(), base + pos, src + pos, rc);
+            }
+        }
+        Recode<C1, C2>()(src, n, dst, fset);
+        base += n;
+    }
+
+    // Byte order aware conversion
+
+    enum class ByteOrder { big_endian, little_endian, detect };
+
+    namespace UnicornDetail {
+
+        // utf_load_units() copies n code units from a byte buffer of any
+        // alignment, reversing the byte order of each unit if requested. The
+        // source and destination may be the same buffer; without swapping
+        // they may also overlap in any other way.
+
+        void utf_load_units(const char* src, size_t n, bool swap, char16_t* dst) noexcept;
+        void utf_load_units(const char* src, size_t n, bool swap, char32_t* dst) noexcept;
+
+        inline void utf_load_units(const char* src, size_t n, bool /*swap*/, char* dst) noexcept {
+            std::copy_n(src, n, dst);
+        }
+
+        inline bool native_big_endian() noexcept {
+            static constexpr uint16_t x = 1;
+            return *reinterpret_cast<const uint8_t*>(&x) == 0;
+        }
+
+        // Resolve the byte order of a buffer, returning true if the units
+        // need to be swapped; if a BOM is detected its length is returned
+        // in skip.
+
+        template <typename C>
+        bool byte_order_swap(const char* src, size_t bytes, ByteOrder order, size_t& skip) noexcept {
+            skip = 0;
+            if (order == ByteOrder::detect) {
+                if (sizeof(C) == 1) {
+                    if (bytes >= 3 && memcmp(src, utf8_bom, 3) == 0)
+                        skip = 3;
+                    return false;
+                }
+                order = ByteOrder::big_endian;
+                if (bytes >= sizeof(C)) {
+                    C unit[2];
+                    utf_load_units(src, 1, false, unit);
+                    utf_load_units(src, 1, true, unit + 1);
+                    if (unit[0] == byte_order_mark || unit[1] == byte_order_mark) {
+                        skip = sizeof(C);
+                        return unit[1] == byte_order_mark;
+                    }
+                }
+            }
+            return sizeof(C) > 1 && (order == ByteOrder::big_endian) != native_big_endian();
+        }
+
+    }
+
+    template <typename C1, typename C2>
+    void recode_from_bytes(const void* src, size_t bytes, ByteOrder order, basic_string<C2>& dst, uint32_t flags = 0) {
+        using namespace UnicornDetail;
+        static_assert(std::is_same<C1, char>::value || std::is_same<C1, char16_t>::value || std::is_same<C1, char32_t>::value,
+            "Byte buffer encoding must be UTF-8, 16, or 32");
+        static constexpr size_t block = 1024;
+        dst.clear();
+        auto ptr = static_cast<const char*>(src);
+        if (! ptr)
+            return;
+        size_t skip = 0;
+        bool swap = byte_order_swap<C1>(ptr, bytes, order, skip);
+        ptr += skip;
+        bytes -= skip;
+        size_t n = bytes / sizeof(C1), extra = bytes % sizeof(C1);
+        dst.reserve(n);
+        UtfStreamDecoder<C1, C2> decoder(flags);
+        if (! swap && reinterpret_cast<uintptr_t>(ptr) % alignof(C1) == 0) {
+            decoder.feed(reinterpret_cast<const C1*>(ptr), n, dst);
+        } else {
+            C1 buf[block];
+            for (size_t i = 0; i < n; i += block) {
+                size_t m = std::min(block, n - i);
+                utf_load_units(ptr + i * sizeof(C1), m, swap, buf);
+                decoder.feed(buf, m, dst);
+            }
+        }
+        decoder.finish(dst);
+        if (extra > 0) {
+            if (flags & err_throw)
+                throw EncodingError(UtfEncoding<C1>::name(), skip + n * sizeof(C1), ptr + n * sizeof(C1), extra);
+            append_error(dst);
+        }
+    }
+
+    template <typename C1, typename C2>
+    basic_string<C2> recode_from_bytes(const void* src, size_t bytes, ByteOrder order, uint32_t flags = 0) {
+        basic_string<C2> dst;
+        recode_from_bytes<C1>(src, bytes, order, dst, flags);
+        return dst;
+    }
+
+    template <typename C2, typename C1>
+    void recode_to_bytes(const basic_string<C1>& src, ByteOrder order, string& dst, uint32_t flags = 0) {
+        using namespace UnicornDetail;
+        static_assert(std::is_same<C2, char>::value || std::is_same<C2, char16_t>::value || std::is_same<C2, char32_t>::value,
+            "Byte buffer encoding must be UTF-8, 16, or 32");
+        static constexpr size_t block = 1024;
+        static constexpr size_t step = block / UtfEncoding<C2>::max_units;
+        C2 buf[block];
+        size_t units = 0;
+        if (order == ByteOrder::detect) {
+            units = UtfEncoding<C2>::encode(byte_order_mark, buf);
+            order = native_big_endian() ? ByteOrder::big_endian : ByteOrder::little_endian;
+        }
+        bool swap = sizeof(C2) > 1 && (order == ByteOrder::big_endian) != native_big_endian();
+        auto len = recode_measure<C1, C2>(src.data(), src.size(), flags);
+        dst.resize((units + len) * sizeof(C2));
+        size_t pos = 0, out = 0;
+        for (;;) {
+            if (swap)
+                utf_load_units(reinterpret_cast<const char*>(buf), units, true, buf);
+            memcpy(&dst[0] + out, buf, units * sizeof(C2));
+            out += units * sizeof(C2);
+            if (pos == src.size())
+                break;
+            size_t n = std::min(src.size() - pos, step);
+            if (n < src.size() - pos)
+                n -= utf_incomplete_tail(src.data() + pos, n);
+            units = RecodeInto<C1, C2>()(src.data() + pos, n, buf, block, flags);
+            pos += n;
+        }
+        dst.resize(out);
+    }
+
     // UTF validation functions
 
     template <typename C>
     void sanitize(basic_string<C>& str) {
-        basic_string<C> result;
-        recode(str, result, err_replace);
-        str.swap(result);
+        auto pos = UnicornDetail::utf_error_offset(str.data(), str.size());
+        if (pos == npos)
+            return;
+        basic_string<C> tail;
+        UnicornDetail::Recode<C, C>()(str.data() + pos, str.size() - pos, tail, err_replace);
+        str.replace(pos, npos, tail);
     }
 
     template <typename C>
     bool valid_string(const basic_string<C>& str) {
-        using namespace UnicornDetail;
-        auto data = str.data();
-        size_t pos = 0, size = str.size();
-        char32_t u = 0;
-        while (pos < size) {
-            auto rc = UtfEncoding<C>::decode(data + pos, size - pos, u);
-            if (char_is_unicode(u))
-                pos += rc;
-            else
-                return false;
-        }
-        return true;
+        return UnicornDetail::utf_error_offset(str.data(), str.size()) == npos;
     }
 
     template <typename C>
     void check_string(const basic_string<C>& str) {
         using namespace UnicornDetail;
         auto data = str.data();
-        size_t pos = 0, size = str.size();
-        char32_t u = 0;
-        while (pos < size) {
-            auto rc = UtfEncoding<C>::decode(data + pos, size - pos, u);
-            if (! char_is_unicode(u))
-                throw EncodingError(UtfEncoding<C>::name(), pos, data + pos, rc);
-            pos += rc;
+        size_t pos = utf_error_offset(data, str.size());
+        if (pos != npos) {
+            char32_t u = 0;
+            auto rc = UtfEncoding<C>::decode(data + pos, str.size() - pos, u);
+            throw EncodingError(UtfEncoding<C>::name(), pos, data + pos, rc);
         }
     }
 
     template <typename C>
     size_t valid_count(const basic_string<C>& str) noexcept {
-        using namespace UnicornDetail;
-        auto data = str.data();
-        size_t pos = 0, size = str.size();
-        char32_t u = 0;
-        while (pos < size) {
-            auto rc = UtfEncoding<C>::decode(data + pos, size - pos, u);
-            if (! char_is_unicode(u))
-                return pos;
-            pos += rc;
-        }
-        return npos;
+        return UnicornDetail::utf_error_offset(str.data(), str.size());
     }
 
 }